@@ -115,6 +115,31 @@
 #	endif
 #endif
 
+#if defined(__cpp_lib_is_constant_evaluated)
+#	define EUCCONSTANT_EVALUATED()		_STD is_constant_evaluated()
+#elif (defined(__clang__) && __clang_major__ >= 9) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#	define EUCCONSTANT_EVALUATED()		__builtin_is_constant_evaluated()
+#else
+#	define EUCCONSTANT_EVALUATED()		false
+#endif
+
+#if !defined(THL_EUC_NO_CONCEPTS) && defined(__cpp_concepts) && (__cpp_concepts >= 201907L)
+#	define THL_EUC_CONCEPTS
+#endif
+
+#if defined(THL_EUC_INSTRUMENT)
+#	include "EuclideanVectorInstrument.hpp"
+#	define EUCINSTRUMENT(op, dim)			do { if (!EUCCONSTANT_EVALUATED()) ::thl::vector::detail::instrument_record<E, dim>(::thl::vector::EucOp::op); } while (0)
+#	define EUCINSTRUMENT_PACKER(dim)		::thl::vector::detail::InstrumentPackerTag<E, dim> instrument_ = {}
+#	define EUCINSTRUMENT_CONCAT_(a, b)		a##b
+#	define EUCINSTRUMENT_CONCAT(a, b)		EUCINSTRUMENT_CONCAT_(a, b)
+#	define EUCINSTRUMENT_SCOPE(name)		::thl::vector::EucInstrumentScope EUCINSTRUMENT_CONCAT(euc_instrument_scope_, __LINE__)([] { static const size_t slot = ::thl::vector::detail::instrument_register_scope(name); return slot; }())
+#else
+#	define EUCINSTRUMENT(op, dim)
+#	define EUCINSTRUMENT_PACKER(dim)
+#	define EUCINSTRUMENT_SCOPE(name)
+#endif
+
 //name space begin.
 namespace thl::vector {
 
@@ -150,6 +175,83 @@ namespace meta {
 		static constexpr bool value = _STD is_constructible_v<C, Head>;
 	};
 
+	template<class To, class... Any>
+	constexpr bool is_constructible_anynum_param_v = is_constructible_anynum_param<To, Any...>::value;
+
+#if defined(THL_EUC_CONCEPTS)
+	// !=.
+	template<class Left, class Right>
+	constexpr bool is_invoke_not_equal_v = requires { _STD declval<Left>() != _STD declval<Right>(); };
+
+	// +=.
+	template<class Left, class Right>
+	constexpr bool is_invoke_add_equal_v = requires { _STD declval<Left>() += _STD declval<Right>(); };
+
+	// -=.
+	template<class Left, class Right>
+	constexpr bool is_invoke_sub_equal_v = requires { _STD declval<Left>() -= _STD declval<Right>(); };
+
+	// *=.
+	template<class Left, class Right>
+	constexpr bool is_invoke_mul_equal_v = requires { _STD declval<Left>() *= _STD declval<Right>(); };
+
+	// /=.
+	template<class Left, class Right>
+	constexpr bool is_invoke_div_equal_v = requires { _STD declval<Left>() /= _STD declval<Right>(); };
+
+	/*
+		Element operations used by the vector operators, each with the fallback the C++17 overload pairs provide.
+		l != r, else !(l == r).
+	*/
+	template<class Left, class Right>
+	concept not_equal_comparable = requires(Left&& l, Right&& r) { bool(_STD forward<Left>(l) != _STD forward<Right>(r)); }
+		|| requires(Left&& l, Right&& r) { bool(!(_STD forward<Left>(l) == _STD forward<Right>(r))); };
+
+	// l += r, else l = l + r.
+	template<class Left, class Right>
+	concept add_assignable = requires(Left& l, Right&& r) { l += _STD forward<Right>(r); }
+		|| requires(Left& l, Right&& r) { l = l + _STD forward<Right>(r); };
+
+	// l -= r, else l = l - r.
+	template<class Left, class Right>
+	concept sub_assignable = requires(Left& l, Right&& r) { l -= _STD forward<Right>(r); }
+		|| requires(Left& l, Right&& r) { l = l - _STD forward<Right>(r); };
+
+	// l *= r, else l = l * r.
+	template<class Left, class Right>
+	concept mul_assignable = requires(Left& l, Right&& r) { l *= _STD forward<Right>(r); }
+		|| requires(Left& l, Right&& r) { l = l * _STD forward<Right>(r); };
+
+	// l /= r, else l = l / r.
+	template<class Left, class Right>
+	concept div_assignable = requires(Left& l, Right&& r) { l /= _STD forward<Right>(r); }
+		|| requires(Left& l, Right&& r) { l = l / _STD forward<Right>(r); };
+
+	template<class Left, class Right>
+	constexpr bool is_nothrow_not_equal_v = is_invoke_not_equal_v<Left, Right>
+		? requires(Left&& l, Right&& r) { { bool(_STD forward<Left>(l) != _STD forward<Right>(r)) } noexcept; }
+		: requires(Left&& l, Right&& r) { { bool(!(_STD forward<Left>(l) == _STD forward<Right>(r))) } noexcept; };
+
+	template<class Left, class Right>
+	constexpr bool is_nothrow_add_assign_v = is_invoke_add_equal_v<Left&, Right>
+		? requires(Left& l, Right&& r) { { l += _STD forward<Right>(r) } noexcept; }
+		: requires(Left& l, Right&& r) { { l = l + _STD forward<Right>(r) } noexcept; };
+
+	template<class Left, class Right>
+	constexpr bool is_nothrow_sub_assign_v = is_invoke_sub_equal_v<Left&, Right>
+		? requires(Left& l, Right&& r) { { l -= _STD forward<Right>(r) } noexcept; }
+		: requires(Left& l, Right&& r) { { l = l - _STD forward<Right>(r) } noexcept; };
+
+	template<class Left, class Right>
+	constexpr bool is_nothrow_mul_assign_v = is_invoke_mul_equal_v<Left&, Right>
+		? requires(Left& l, Right&& r) { { l *= _STD forward<Right>(r) } noexcept; }
+		: requires(Left& l, Right&& r) { { l = l * _STD forward<Right>(r) } noexcept; };
+
+	template<class Left, class Right>
+	constexpr bool is_nothrow_div_assign_v = is_invoke_div_equal_v<Left&, Right>
+		? requires(Left& l, Right&& r) { { l /= _STD forward<Right>(r) } noexcept; }
+		: requires(Left& l, Right&& r) { { l = l / _STD forward<Right>(r) } noexcept; };
+#else
 	class not_equal_info {
 
 		template<class L, class R>
@@ -215,9 +317,6 @@ namespace meta {
 		static constexpr bool value = decltype(can<L, R>(0))::value;
 	};
 
-	template<class To, class... Any>
-	constexpr bool is_constructible_anynum_param_v = is_constructible_anynum_param<To, Any...>::value;
-
 	// !=.
 	template<class Left, class Right>
 	constexpr bool is_invoke_not_equal_v = not_equal_info::value<Left, Right>;
@@ -237,80 +336,168 @@ namespace meta {
 	// /=.
 	template<class Left, class Right>
 	constexpr bool is_invoke_div_equal_v = div_equal_info::value<Left, Right>;
+#endif
 
 }
 
 //details.
 namespace detail {
 
+#if defined(THL_EUC_CONCEPTS)
+	/*
+		@brief
+			Element operations behind the single C++20 operator overloads. Each picks the compound form when the
+			element type has it, and the expanded form otherwise.
+	*/
+	template<class L, class R>
+	EUCNODISCARD EUCVECTORINLINE constexpr bool euc_not_equal(L&& l, R&& r) noexcept(meta::is_nothrow_not_equal_v<L, R>) {
+		if constexpr (meta::is_invoke_not_equal_v<L, R>) return bool(_STD forward<L>(l) != _STD forward<R>(r));
+		else return bool(!(_STD forward<L>(l) == _STD forward<R>(r)));
+	}
+
+	template<class L, class R>
+	EUCVECTORINLINE constexpr void euc_add_assign(L& l, R&& r) noexcept(meta::is_nothrow_add_assign_v<L, R>) {
+		if constexpr (meta::is_invoke_add_equal_v<L&, R>) l += _STD forward<R>(r);
+		else l = l + _STD forward<R>(r);
+	}
+
+	template<class L, class R>
+	EUCVECTORINLINE constexpr void euc_sub_assign(L& l, R&& r) noexcept(meta::is_nothrow_sub_assign_v<L, R>) {
+		if constexpr (meta::is_invoke_sub_equal_v<L&, R>) l -= _STD forward<R>(r);
+		else l = l - _STD forward<R>(r);
+	}
+
+	template<class L, class R>
+	EUCVECTORINLINE constexpr void euc_mul_assign(L& l, R&& r) noexcept(meta::is_nothrow_mul_assign_v<L, R>) {
+		if constexpr (meta::is_invoke_mul_equal_v<L&, R>) l *= _STD forward<R>(r);
+		else l = l * _STD forward<R>(r);
+	}
+
+	template<class L, class R>
+	EUCVECTORINLINE constexpr void euc_div_assign(L& l, R&& r) noexcept(meta::is_nothrow_div_assign_v<L, R>) {
+		if constexpr (meta::is_invoke_div_equal_v<L&, R>) l /= _STD forward<R>(r);
+		else l = l / _STD forward<R>(r);
+	}
+#endif
+
+	/*
+		@brief
+			Square root for constant evaluation. Newton iteration from above in the next wider type, stopped once the
+			estimate no longer decreases. Exact for float; double may differ from _STD sqrt in the last bit.
+			Negative input is not a constant expression.
+	*/
+	template<class R>
+	EUCNODISCARD EUCVECTORINLINE constexpr R euc_constexpr_sqrt(R v) noexcept {
+		using W = _STD conditional_t<_STD is_same_v<R, float>, double, long double>;
+		if (v < R(0)) return _STD sqrt(v);
+		if (v != v || v == R(0) || v + v == v) return v;	// NaN, zero, inf.
+		const W w = v;
+		W x = w > W(1) ? w : W(1);
+		for (;;) {
+			const W next = W(0.5) * (x + w / x);
+			if (!(next < x)) return static_cast<R>(x);
+			x = next;
+		}
+	}
+
+	namespace sqrt_lookup {
+
+		using _STD sqrt;
+
+		/*
+			@brief
+				sqrt found by argument-dependent lookup as well, so element types can provide their own (EucFixed).
+		*/
+		template<class T>
+		EUCNODISCARD EUCVECTORINLINE constexpr auto euc_sqrt_call(T v) noexcept(noexcept(sqrt(v)))
+			-> decltype(sqrt(v)) {
+			return sqrt(v);
+		}
+
+	}
+
+	/*
+		@brief
+			sqrt at run time, euc_constexpr_sqrt during constant evaluation of floating point values.
+	*/
+	template<class T>
+	EUCNODISCARD EUCVECTORINLINE constexpr auto euc_sqrt(T v) noexcept(noexcept(sqrt_lookup::euc_sqrt_call(v)))
+		-> decltype(sqrt_lookup::euc_sqrt_call(v)) {
+		if constexpr (_STD is_floating_point_v<decltype(sqrt_lookup::euc_sqrt_call(v))>) {
+			if (EUCCONSTANT_EVALUATED()) return euc_constexpr_sqrt(static_cast<decltype(sqrt_lookup::euc_sqrt_call(v))>(v));
+		}
+		return sqrt_lookup::euc_sqrt_call(v);
+	}
+
 	template<class E>
 	struct ResultPacker_1 {
 		E x;
+		EUCINSTRUMENT_PACKER(1);
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-			EUCVECTORINLINE auto operator+(ResultPacker_1<T>&& pack) const noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator+(ResultPacker_1<T>&& pack) const noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
 			->decltype(ResultPacker_1<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}) {
 			return { _STD move(x) + _STD move(pack.x) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-			EUCVECTORINLINE auto operator-(ResultPacker_1<T>&& pack) const noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator-(ResultPacker_1<T>&& pack) const noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
 			->decltype(ResultPacker_1<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}) {
 			return { _STD move(x) - _STD move(pack.x) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE auto operator*(T&& scl) noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(x * scl)>>{x * scl}))
+			EUCVECTORINLINE constexpr auto operator*(T&& scl) noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(x * scl)>>{x * scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_1<meta::no_ref<decltype(x* scl)>>{x* scl}) {
 			return { x * scl };
 		}
 
 		template<class T>
 		friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE static auto operator*(T&& scl, ResultPacker_1<E>&& right) noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(right.x * scl)>>{right.x * scl}))
+			EUCVECTORINLINE static constexpr auto operator*(T&& scl, ResultPacker_1<E>&& right) noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(right.x * scl)>>{right.x * scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_1<meta::no_ref<decltype(right.x * scl)>>{right.x * scl}) {
 			return { right.x * scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-			EUCVECTORINLINE auto operator/(T&& scl) noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(x / scl)>>{x / scl}))
+			EUCVECTORINLINE constexpr auto operator/(T&& scl) noexcept(noexcept(ResultPacker_1<meta::no_ref<decltype(x / scl)>>{x / scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_1<meta::no_ref<decltype(x / scl)>>{x / scl}) {
 			return { x / scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator==(ResultPacker_1<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator==(ResultPacker_1<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
 			-> decltype(bool(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return _STD move(x) == _STD move(right.x);
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_1<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_1<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
 			-> decltype(bool(_STD move(x) != _STD move(right.x)), _STD declval<bool>()) {
 			return _STD move(x) != _STD move(right.x);
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_1<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_1<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
 			-> decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), !(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return  !(_STD move(x) == _STD move(right.x));
 		}
 
-		EUCNODISCARD EUCVECTORINLINE ResultPacker_1<E>& operator+() noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr ResultPacker_1<E>& operator+() noexcept {
 			return *this;
 		}
-		EUCNODISCARD EUCVECTORINLINE const ResultPacker_1<E>& operator+() const noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr const ResultPacker_1<E>& operator+() const noexcept {
 			return *this;
 		}
 		template<class T = E>
-		EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(ResultPacker_1<T>() * -1))
+		EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(ResultPacker_1<T>() * -1))
 			->decltype(ResultPacker_1<T>() * -1) {
 			return { x * -1 };
 		}
@@ -322,71 +509,72 @@ namespace detail {
 	template<class E>
 	struct ResultPacker_2 {
 		E x,y;
+		EUCINSTRUMENT_PACKER(2);
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-			EUCVECTORINLINE auto operator+(ResultPacker_2<T>&& pack) const noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator+(ResultPacker_2<T>&& pack) const noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
 			->decltype(ResultPacker_2<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}) {
 			return { _STD move(x) + _STD move(pack.x), _STD move(y) + _STD move(pack.y) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-			EUCVECTORINLINE auto operator-(ResultPacker_2<T>&& pack) const noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator-(ResultPacker_2<T>&& pack) const noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
 			->decltype(ResultPacker_2<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}) {
 			return { _STD move(x) - _STD move(pack.x), _STD move(y) - _STD move(pack.y) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE auto operator*(T&& scl) noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(x * scl)>>{x * scl}))
+			EUCVECTORINLINE constexpr auto operator*(T&& scl) noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(x * scl)>>{x * scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_2<meta::no_ref<decltype(x * scl)>>{x * scl}) {
 			return { x * scl,y * scl };
 		}
 
 		template<class T>
 		friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE static auto operator*(T&& scl, ResultPacker_2<E>&& right) noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}))
+			EUCVECTORINLINE static constexpr auto operator*(T&& scl, ResultPacker_2<E>&& right) noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_2<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}) {
 			return { right.x * scl,right.y * scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-			EUCVECTORINLINE auto operator/(T&& scl) noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(x / scl)>>{x / scl}))
+			EUCVECTORINLINE constexpr auto operator/(T&& scl) noexcept(noexcept(ResultPacker_2<meta::no_ref<decltype(x / scl)>>{x / scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_2<meta::no_ref<decltype(x / scl)>>{x / scl}) {
 			return { x / scl,y / scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator==(ResultPacker_2<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator==(ResultPacker_2<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
 			-> decltype(bool(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return (_STD move(x) == _STD move(right.x)) && (_STD move(y) == _STD move(right.y));
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_2<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_2<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
 			-> decltype(bool(_STD move(x) != _STD move(right.x)), _STD declval<bool>()) {
 			return (_STD move(x) != _STD move(right.x)) || (_STD move(y) != _STD move(right.y));
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_2<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_2<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
 			-> decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), !(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return  (!(_STD move(x) == _STD move(right.x))) || (!(_STD move(y) == _STD move(right.y)));
 		}
 
-		EUCNODISCARD EUCVECTORINLINE ResultPacker_2<E>& operator+() noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr ResultPacker_2<E>& operator+() noexcept {
 			return *this;
 		}
-		EUCNODISCARD EUCVECTORINLINE const ResultPacker_2<E>& operator+() const noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr const ResultPacker_2<E>& operator+() const noexcept {
 			return *this;
 		}
 		template<class T = E>
-		EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(ResultPacker_2<T>() * -1))
+		EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(ResultPacker_2<T>() * -1))
 			->decltype(ResultPacker_2<T>() * -1) {
 			return { x * -1, y * -1 };
 		}
@@ -398,71 +586,72 @@ namespace detail {
 	template<class E>
 	struct ResultPacker_3 {
 		E x,y,z;
+		EUCINSTRUMENT_PACKER(3);
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-			EUCVECTORINLINE auto operator+(ResultPacker_3<T>&& pack) const noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator+(ResultPacker_3<T>&& pack) const noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
 			->decltype(ResultPacker_3<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}) {
 			return { _STD move(x) + _STD move(pack.x), _STD move(y) + _STD move(pack.y), _STD move(z) + _STD move(pack.z) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-			EUCVECTORINLINE auto operator-(ResultPacker_3<T>&& pack) const noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator-(ResultPacker_3<T>&& pack) const noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
 			->decltype(ResultPacker_3<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}) {
 			return { _STD move(x) - _STD move(pack.x), _STD move(y) - _STD move(pack.y), _STD move(z) - _STD move(pack.z) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE auto operator*(T&& scl) noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(x * _STD forward<T>(scl))>>{x * _STD forward<T>(scl)}))
+			EUCVECTORINLINE constexpr auto operator*(T&& scl) noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(x * _STD forward<T>(scl))>>{x * _STD forward<T>(scl)}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_3<meta::no_ref<decltype(x * _STD forward<T>(scl))>>{x * _STD forward<T>(scl)}) {
 			return { x * scl,y * scl,z * scl };
 		}
 
 		template<class T>
 		friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE static auto operator*(T&& scl, ResultPacker_3<E>&& right) noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}))
+			EUCVECTORINLINE static constexpr auto operator*(T&& scl, ResultPacker_3<E>&& right) noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_3<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}) {
 			return { right.x * scl,right.y * scl,right.z * scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-			EUCVECTORINLINE auto operator/(T&& scl) noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(x / _STD forward<T>(scl))>>{x / _STD forward<T>(scl)}))
+			EUCVECTORINLINE constexpr auto operator/(T&& scl) noexcept(noexcept(ResultPacker_3<meta::no_ref<decltype(x / _STD forward<T>(scl))>>{x / _STD forward<T>(scl)}))
 			->decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_3<meta::no_ref<decltype(x / _STD forward<T>(scl))>>{x / _STD forward<T>(scl)}) {
 			return { x * scl,y * scl,z * scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator==(ResultPacker_3<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator==(ResultPacker_3<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
 			-> decltype(bool(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return (_STD move(x) == _STD move(right.x)) && (_STD move(y) == _STD move(right.y)) && (_STD move(z) == _STD move(right.z));
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_3<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_3<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
 			-> decltype(bool(_STD move(x) != _STD move(right.x)), _STD declval<bool>()) {
 			return (_STD move(x) != _STD move(right.x)) || (_STD move(y) != _STD move(right.y)) || (_STD move(z) != _STD move(right.z));
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_3<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_3<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
 			-> decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), !(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return  (!(_STD move(x) == _STD move(right.x))) || (!(_STD move(y) == _STD move(right.y))) || (!(_STD move(z) == _STD move(right.z)));
 		}
 
-		EUCNODISCARD EUCVECTORINLINE ResultPacker_3<E>& operator+() noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr ResultPacker_3<E>& operator+() noexcept {
 			return *this;
 		}
-		EUCNODISCARD EUCVECTORINLINE const ResultPacker_3<E>& operator+() const noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr const ResultPacker_3<E>& operator+() const noexcept {
 			return *this;
 		}
 		template<class T = E>
-		EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(ResultPacker_3<T>() * -1))
+		EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(ResultPacker_3<T>() * -1))
 			->decltype(ResultPacker_3<T>() * -1) {
 			return { x * -1, y * -1, z * -1 };
 		}
@@ -474,71 +663,72 @@ namespace detail {
 	template<class E>
 	struct ResultPacker_4 {
 		E x,y,z,w;
+		EUCINSTRUMENT_PACKER(4);
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-			EUCVECTORINLINE auto operator+(ResultPacker_4<T>&& pack) const noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator+(ResultPacker_4<T>&& pack) const noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)}))
 			-> decltype(ResultPacker_4<meta::no_ref<decltype(_STD move(x) + _STD move(pack.x))>>{_STD move(x) + _STD move(pack.x)})  {
 			return { _STD move(x) + _STD move(pack.x), _STD move(y) + _STD move(pack.y), _STD move(z) + _STD move(pack.z), _STD move(w) + _STD move(pack.w) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-			EUCVECTORINLINE auto operator-(ResultPacker_4<T>&& pack) const noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
+			EUCVECTORINLINE constexpr auto operator-(ResultPacker_4<T>&& pack) const noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}))
 			-> decltype(ResultPacker_4<meta::no_ref<decltype(_STD move(x) - _STD move(pack.x))>>{_STD move(x) - _STD move(pack.x)}) {
 			return { _STD move(x) - _STD move(pack.x), _STD move(y) - _STD move(pack.y), _STD move(z) - _STD move(pack.z), _STD move(w) - _STD move(pack.w) };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE auto operator*(T&& scl) noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(x * _STD forward<T>(scl))>>{x * _STD forward<T>(scl)}))
+			EUCVECTORINLINE constexpr auto operator*(T&& scl) noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(x * _STD forward<T>(scl))>>{x * _STD forward<T>(scl)}))
 			-> decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_4<meta::no_ref<decltype(x * _STD forward<T>(scl))>>{x * _STD forward<T>(scl)}) {
 			return { x * scl,y * scl,z * scl,w * scl };
 		}
 
 		template<class T>
 		friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-			EUCVECTORINLINE static auto operator*(T&& scl, ResultPacker_4<E>&& right) noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}))
+			EUCVECTORINLINE static constexpr auto operator*(T&& scl, ResultPacker_4<E>&& right) noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(right.x* scl)>>{right.x* scl}))
 			-> decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_4<meta::no_ref<decltype(right.x* scl)>>{right.x* scl})  {
 			return { right.x * scl,right.y * scl,right.z * scl,right.w * scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-			EUCVECTORINLINE auto operator/(T&& scl) noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(x / _STD forward<T>(scl))>>{x / _STD forward<T>(scl)}))
+			EUCVECTORINLINE constexpr auto operator/(T&& scl) noexcept(noexcept(ResultPacker_4<meta::no_ref<decltype(x / _STD forward<T>(scl))>>{x / _STD forward<T>(scl)}))
 			-> decltype(meta::when_true<!_STD is_base_of_v<meta::evd_euc_vec, meta::no_ref<T>>>(), ResultPacker_4<meta::no_ref<decltype(x / _STD forward<T>(scl))>>{x / _STD forward<T>(scl)}) {
 			return { x * scl,y * scl,z * scl,w * scl };
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator==(ResultPacker_4<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator==(ResultPacker_4<T>&& right) noexcept(noexcept(bool(_STD move(x) == _STD move(right.x))))
 			-> decltype(bool(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return (_STD move(x) == _STD move(right.x)) && (_STD move(y) == _STD move(right.y)) && (_STD move(z) == _STD move(right.z)) && (_STD move(w) == _STD move(right.w));
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_4<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_4<T>&& right) noexcept(noexcept(bool(_STD move(x) != _STD move(right.x))))
 			-> decltype(bool(_STD move(x) != _STD move(right.x)), _STD declval<bool>()) {
 			return (_STD move(x) != _STD move(right.x)) || (_STD move(y) != _STD move(right.y)) || (_STD move(z) != _STD move(right.z)) || (_STD move(w) != _STD move(right.w));
 		}
 
 		template<class T>
 		EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-			EUCVECTORINLINE auto operator!=(ResultPacker_4<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
+			EUCVECTORINLINE constexpr auto operator!=(ResultPacker_4<T>&& right) const noexcept(noexcept(bool(!(_STD move(x) == _STD move(right.x)))))
 			-> decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), !(_STD move(x) == _STD move(right.x)), _STD declval<bool>()) {
 			return  (!(_STD move(x) == _STD move(right.x))) || (!(_STD move(y) == _STD move(right.y))) || (!(_STD move(z) == _STD move(right.z))) || (!(_STD move(w) == _STD move(right.w)));
 		}
 
-		EUCNODISCARD EUCVECTORINLINE ResultPacker_4<E>& operator+() noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr ResultPacker_4<E>& operator+() noexcept {
 			return *this;
 		}
-		EUCNODISCARD EUCVECTORINLINE const ResultPacker_4<E>& operator+() const noexcept {
+		EUCNODISCARD EUCVECTORINLINE constexpr const ResultPacker_4<E>& operator+() const noexcept {
 			return *this;
 		}
 		template<class T = E>
-		EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(ResultPacker_4<T>() * -1))
+		EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(ResultPacker_4<T>() * -1))
 			->decltype(ResultPacker_4<T>() * -1) {
 			return { x * -1, y * -1, z * -1, w * -1 };
 		}
@@ -817,8 +1007,8 @@ public:
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.x_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.x_) == _STD move(left.x))), _STD declval<bool>())> {
 		return !(_STD move(right.x_) == _STD move(left.x));
 	}
 	/*
@@ -1030,18 +1220,21 @@ public:
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(const EuclideanVector1<T>& vector) const noexcept(noexcept(decltype(x_* vector.x_)(x_* vector.x_)))
 		-> decltype(decltype(x_* vector.x_)(x_* vector.x_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * vector.x_;
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(EuclideanVector1<T>&& vector) const noexcept(noexcept(decltype(x_* _STD move(vector.x_))(x_* _STD move(vector.x_))))
 		-> decltype(decltype(x_* _STD move(vector.x_))(x_* _STD move(vector.x_))) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(vector.x_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(decltype(x_* _STD move(pack.x))(x_* _STD move(pack.x))))
 		-> decltype(decltype(x_* _STD move(pack.x))(x_* _STD move(pack.x))) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(pack.x);
 	}
 	/*
@@ -1056,6 +1249,7 @@ public:
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return x_ * x_;
 	}
 	/*
@@ -1068,8 +1262,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
+		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
 		return x_;
 	}
 	/*
@@ -1082,6 +1277,7 @@ public:
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
 		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{x_ / eucnorm<T>()}))
 		->decltype(Packer<T>{x_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { x_ / norm };
 	}
@@ -1094,6 +1290,7 @@ public:
 	template<class T = ElemType>
 	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		auto&& norm = eucnorm<T>();
 		x_ /= norm;
 		return *this;
@@ -1316,6 +1513,42 @@ public:
 		return (_STD move(right.x_) == _STD move(left.x)) && (_STD move(right.y_) == _STD move(left.y));
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(const EuclideanRecVector2<T>& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, const T&>)
+		requires meta::not_equal_comparable<LRefConstElemType, const T&> {
+		return detail::euc_not_equal(MX::x_, right.x_) || detail::euc_not_equal(y_, right.y_);
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(EuclideanRecVector2<T>&& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(MX::x_, _STD move(right.x_)) || detail::euc_not_equal(y_, _STD move(right.y_));
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(RRefPacker<T> right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(MX::x_, _STD move(right.x)) || detail::euc_not_equal(y_, _STD move(right.y));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static bool operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(right.x_, _STD move(left.x)) || detail::euc_not_equal(right.y_, _STD move(left.y));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static bool operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(meta::is_nothrow_not_equal_v<ElemType, T>)
+		requires meta::not_equal_comparable<ElemType, T> {
+		return detail::euc_not_equal(_STD move(right.x_), _STD move(left.x)) || detail::euc_not_equal(_STD move(right.y_), _STD move(left.y));
+	}
+#else
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
 		EUCVECTORINLINE auto operator!=(const EuclideanRecVector2<T>& right) const noexcept(noexcept(bool(y_ != right.y_)))
@@ -1381,10 +1614,11 @@ public:
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.y_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.y_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.y_) == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(_STD move(right.x_) == _STD move(left.x))) || (!(_STD move(right.y_) == _STD move(left.y)));
 	}
+#endif
 	/*
 		Unary Operators.
 	*/
@@ -1427,6 +1661,71 @@ public:
 		return *this;
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(const EuclideanRecVector2<T>& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, const T&>)
+		requires meta::add_assignable<ElemType, const T&> {
+		detail::euc_add_assign(MX::x_, vector.x_);
+		detail::euc_add_assign(y_, vector.y_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(EuclideanRecVector2<T>&& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(MX::x_, _STD move(vector.x_));
+		detail::euc_add_assign(y_, _STD move(vector.y_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(MX::x_, _STD move(pack.x));
+		detail::euc_add_assign(y_, _STD move(pack.y));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(const EuclideanRecVector2<T>& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, const T&>)
+		requires meta::sub_assignable<ElemType, const T&> {
+		detail::euc_sub_assign(MX::x_, vector.x_);
+		detail::euc_sub_assign(y_, vector.y_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(EuclideanRecVector2<T>&& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(MX::x_, _STD move(vector.x_));
+		detail::euc_sub_assign(y_, _STD move(vector.y_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(MX::x_, _STD move(pack.x));
+		detail::euc_sub_assign(y_, _STD move(pack.y));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator*=(T&& scl) & noexcept(meta::is_nothrow_mul_assign_v<ElemType, T&>)
+		requires meta::mul_assignable<ElemType, T&> {
+		detail::euc_mul_assign(MX::x_, scl);
+		detail::euc_mul_assign(y_, scl);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator/=(T&& scl) & noexcept(meta::is_nothrow_div_assign_v<ElemType, T&>)
+		requires meta::div_assignable<ElemType, T&> {
+		detail::euc_div_assign(MX::x_, scl);
+		detail::euc_div_assign(y_, scl);
+		return *this;
+	}
+#else
 	template<class T>
 	EUCVECTORINLINE auto operator+=(const EuclideanRecVector2<T>& vector) & noexcept(noexcept(y_ += vector.y_))
 		-> decltype(y_ += vector.y_, _STD declval<LRefEucVector>()) {
@@ -1555,6 +1854,7 @@ public:
 		y_ = y_ / scl;
 		return *this;
 	}
+#endif
 
 	/*
 		Client Function.
@@ -1627,18 +1927,21 @@ public:
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(const EuclideanRecVector2<T>& vector) const noexcept(noexcept(MX::dot(vector) + decltype(y_ * vector.y_)(y_ * vector.y_)))
 		-> decltype(MX::dot(vector) + decltype(y_ * vector.y_)(y_ * vector.y_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * vector.x_) + (y_ * vector.y_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(EuclideanRecVector2<T>&& vector) const noexcept(noexcept(MX::dot(_STD move(vector)) + decltype(y_ * _STD move(vector.y_))(y_ * _STD move(vector.y_))))
 		-> decltype(MX::dot(_STD move(vector)) + decltype(y_ * _STD move(vector.y_))(y_ * _STD move(vector.y_))) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * _STD move(vector.x_)) + (y_ * _STD move(vector.y_));
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(MX::dot(_STD move(pack)) + decltype(y_* _STD move(pack.x))(y_* _STD move(pack.x))))
 		-> decltype(MX::dot(_STD move(pack)) + decltype(y_ * _STD move(pack.x))(y_ * _STD move(pack.x))) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * _STD move(pack.x)) + (y_ * _STD move(pack.y));
 	}
 	/*
@@ -1653,6 +1956,7 @@ public:
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return (MX::x_* MX::x_) + (y_ * y_);
 	}
 	/*
@@ -1665,9 +1969,10 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
-		return _STD sqrt((MX::x_ * MX::x_) + (y_ * y_));
+		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
+		return detail::euc_sqrt((MX::x_ * MX::x_) + (y_ * y_));
 	}
 	/*
 		@brief
@@ -1679,6 +1984,7 @@ public:
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
 		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{y_ / eucnorm<T>()}))
 		->decltype(Packer<T>{y_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { MX::x_ / norm, y_ / norm };
 	}
@@ -1691,6 +1997,7 @@ public:
 	template<class T = ElemType>
 	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		return *this /= eucnorm<T>();
 	}
 
@@ -1910,6 +2217,42 @@ public:
 		return (_STD move(right.x_) == _STD move(left.x)) && (_STD move(right.y_) == _STD move(left.y)) && (_STD move(right.z_) == _STD move(left.z));
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(const EuclideanRecVector3<T>& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, const T&>)
+		requires meta::not_equal_comparable<LRefConstElemType, const T&> {
+		return detail::euc_not_equal(MX::x_, right.x_) || detail::euc_not_equal(MXY::y_, right.y_) || detail::euc_not_equal(z_, right.z_);
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(EuclideanRecVector3<T>&& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(MX::x_, _STD move(right.x_)) || detail::euc_not_equal(MXY::y_, _STD move(right.y_)) || detail::euc_not_equal(z_, _STD move(right.z_));
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(RRefPacker<T> right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(MX::x_, _STD move(right.x)) || detail::euc_not_equal(MXY::y_, _STD move(right.y)) || detail::euc_not_equal(z_, _STD move(right.z));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static bool operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(right.x_, _STD move(left.x)) || detail::euc_not_equal(right.y_, _STD move(left.y)) || detail::euc_not_equal(right.z_, _STD move(left.z));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static bool operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(meta::is_nothrow_not_equal_v<ElemType, T>)
+		requires meta::not_equal_comparable<ElemType, T> {
+		return detail::euc_not_equal(_STD move(right.x_), _STD move(left.x)) || detail::euc_not_equal(_STD move(right.y_), _STD move(left.y)) || detail::euc_not_equal(_STD move(right.z_), _STD move(left.z));
+	}
+#else
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
 		EUCVECTORINLINE auto operator!=(const EuclideanRecVector3<T>& right) const noexcept(noexcept(bool(z_ != right.z_)))
@@ -1975,10 +2318,11 @@ public:
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.z_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.z_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.z_) == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(_STD move(right.x_) == _STD move(left.x))) || (!(_STD move(right.y_) == _STD move(left.y))) || (!(_STD move(right.z_) == _STD move(left.z)));
 	}
+#endif
 	/*
 		Unary Operators.
 	*/
@@ -2024,6 +2368,79 @@ public:
 		return *this;
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(const EuclideanRecVector3<T>& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, const T&>)
+		requires meta::add_assignable<ElemType, const T&> {
+		detail::euc_add_assign(MX::x_, vector.x_);
+		detail::euc_add_assign(MXY::y_, vector.y_);
+		detail::euc_add_assign(z_, vector.z_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(EuclideanRecVector3<T>&& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(MX::x_, _STD move(vector.x_));
+		detail::euc_add_assign(MXY::y_, _STD move(vector.y_));
+		detail::euc_add_assign(z_, _STD move(vector.z_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(MX::x_, _STD move(pack.x));
+		detail::euc_add_assign(MXY::y_, _STD move(pack.y));
+		detail::euc_add_assign(z_, _STD move(pack.z));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(const EuclideanRecVector3<T>& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, const T&>)
+		requires meta::sub_assignable<ElemType, const T&> {
+		detail::euc_sub_assign(MX::x_, vector.x_);
+		detail::euc_sub_assign(MXY::y_, vector.y_);
+		detail::euc_sub_assign(z_, vector.z_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(EuclideanRecVector3<T>&& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(MX::x_, _STD move(vector.x_));
+		detail::euc_sub_assign(MXY::y_, _STD move(vector.y_));
+		detail::euc_sub_assign(z_, _STD move(vector.z_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(MX::x_, _STD move(pack.x));
+		detail::euc_sub_assign(MXY::y_, _STD move(pack.y));
+		detail::euc_sub_assign(z_, _STD move(pack.z));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator*=(T&& scl) & noexcept(meta::is_nothrow_mul_assign_v<ElemType, T&>)
+		requires meta::mul_assignable<ElemType, T&> {
+		detail::euc_mul_assign(MX::x_, scl);
+		detail::euc_mul_assign(MXY::y_, scl);
+		detail::euc_mul_assign(z_, scl);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator/=(T&& scl) & noexcept(meta::is_nothrow_div_assign_v<ElemType, T&>)
+		requires meta::div_assignable<ElemType, T&> {
+		detail::euc_div_assign(MX::x_, scl);
+		detail::euc_div_assign(MXY::y_, scl);
+		detail::euc_div_assign(z_, scl);
+		return *this;
+	}
+#else
 	template<class T>
 	EUCVECTORINLINE auto operator+=(const EuclideanRecVector3<T>& vector) & noexcept(noexcept(z_ += vector.z_))
 		-> decltype(z_ += vector.z_, _STD declval<LRefEucVector>()) {
@@ -2168,6 +2585,7 @@ public:
 		z_ = z_ / scl;
 		return *this;
 	}
+#endif
 
 	/*
 		Client Function.
@@ -2318,18 +2736,21 @@ public:
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(const EuclideanRecVector3<T>& vector) const noexcept(noexcept(MXY::dot(vector) + decltype(z_ * vector.z_)(z_ * vector.z_)))
 		-> decltype(MXY::dot(vector) + decltype(z_ * vector.z_)(z_ * vector.z_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * vector.x_) + (MXY::y_ * vector.y_) + (z_ * vector.z_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(EuclideanRecVector3<T>&& vector) const noexcept(noexcept(MXY::dot(_STD move(vector)) + decltype(z_ * _STD move(vector.z_))(z_ * _STD move(vector.z_))))
 		-> decltype(MXY::dot(_STD move(vector)) + decltype(z_ * _STD move(vector.z_))(z_ * _STD move(vector.z_))) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * _STD move(vector.x_)) + (MXY::y_ * _STD move(vector.y_)) + (z_ * _STD move(vector.z_));
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(MXY::dot(_STD move(pack)) + decltype(z_ * _STD move(pack.x))(z_ * _STD move(pack.x))))
 		-> decltype(MXY::dot(_STD move(pack)) + decltype(z_ * _STD move(pack.x))(z_ * _STD move(pack.x))) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * _STD move(pack.x)) + (MXY::y_ * _STD move(pack.y)) + (z_ * _STD move(pack.z));
 	}
 	/*
@@ -2344,6 +2765,7 @@ public:
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return (MX::x_ * MX::x_) + (MXY::y_ * MXY::y_) + (z_ * z_);
 	}
 	/*
@@ -2356,9 +2778,10 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
-		return _STD sqrt((MX::x_ * MX::x_) + (MXY::y_ * MXY::y_) + (z_ * z_));
+		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
+		return detail::euc_sqrt((MX::x_ * MX::x_) + (MXY::y_ * MXY::y_) + (z_ * z_));
 	}
 	/*
 		@brief
@@ -2370,6 +2793,7 @@ public:
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
 		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{z_ / eucnorm<T>()}))
 		->decltype(Packer<T>{z_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { MX::x_ / norm, MXY::y_ / norm, z_ / norm };
 	}
@@ -2382,6 +2806,7 @@ public:
 	template<class T = ElemType>
 	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		return *this /= eucnorm<T>();
 	}
 	/*
@@ -2395,6 +2820,7 @@ public:
 		EUCVECTORINLINE auto cross(const EuclideanRecVector3<T>& right) const noexcept(
 			noexcept(Packer<decltype(z_* right.z_ - z_ * right.z_)>{ z_* right.z_ - z_ * right.z_ }))
 		-> decltype(Packer<decltype(z_* right.z_ - z_ * right.z_)>{ z_* right.z_ - z_ * right.z_ }) {
+		EUCINSTRUMENT(cross, EucD);
 		return { MXY::y_ * right.z_ - z_ * right.y_, z_ * right.x_ - MX::x_ * right.z_, MX::x_ * right.y_ - MXY::y_ * right.x_ };
 	}
 	template<class T>
@@ -2402,6 +2828,7 @@ public:
 		EUCVECTORINLINE auto cross(EuclideanRecVector3<T>&& right) const noexcept(
 			noexcept(Packer<decltype(z_* _STD move(right.z_) - z_ * _STD move(right.z_))>{ z_* _STD move(right.z_) - z_ * _STD move(right.z_) }))
 		-> decltype(Packer<decltype(z_* _STD move(right.z_) - z_ * _STD move(right.z_))>{ z_* _STD move(right.z_) - z_ * _STD move(right.z_) }) {
+		EUCINSTRUMENT(cross, EucD);
 		return { MXY::y_ * _STD move(right.z_) - z_ * _STD move(right.y_), z_ * _STD move(right.x_) - MX::x_ * _STD move(right.z_), MX::x_ * _STD move(right.y_) - MXY::y_ * _STD move(right.x_) };
 	}
 	template<class T>
@@ -2409,6 +2836,7 @@ public:
 		EUCVECTORINLINE auto cross(RRefPacker<T> right) const noexcept(
 			noexcept(Packer<decltype(z_* _STD move(right.z) - z_ * _STD move(right.z))>{ z_* _STD move(right.z) - z_ * _STD move(right.z) }))
 		-> decltype(Packer<decltype(z_* _STD move(right.z) - z_ * _STD move(right.z))>{ z_* _STD move(right.z) - z_ * _STD move(right.z) }) {
+		EUCINSTRUMENT(cross, EucD);
 		return { MXY::y_ * _STD move(right.z) - z_ * _STD move(right.y), z_ * _STD move(right.x) - MX::x_ * _STD move(right.z), MX::x_ * _STD move(right.y) - MXY::y_ * _STD move(right.x) };
 	}
 };
@@ -2630,6 +3058,42 @@ public:
 		return (_STD move(right.x_) == _STD move(left.x)) && (_STD move(right.y_) == _STD move(left.y)) && (_STD move(right.z_) == _STD move(left.z)) && (_STD move(right.w_) == _STD move(left.w));
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(const EuclideanRecVector4<T>& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, const T&>)
+		requires meta::not_equal_comparable<LRefConstElemType, const T&> {
+		return detail::euc_not_equal(MX::x_, right.x_) || detail::euc_not_equal(MXY::y_, right.y_) || detail::euc_not_equal(MXYZ::z_, right.z_) || detail::euc_not_equal(w_, right.w_);
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(EuclideanRecVector4<T>&& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(MX::x_, _STD move(right.x_)) || detail::euc_not_equal(MXY::y_, _STD move(right.y_)) || detail::euc_not_equal(MXYZ::z_, _STD move(right.z_)) || detail::euc_not_equal(w_, _STD move(right.w_));
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE bool operator!=(RRefPacker<T> right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(MX::x_, _STD move(right.x)) || detail::euc_not_equal(MXY::y_, _STD move(right.y)) || detail::euc_not_equal(MXYZ::z_, _STD move(right.z)) || detail::euc_not_equal(w_, _STD move(right.w));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static bool operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(right.x_, _STD move(left.x)) || detail::euc_not_equal(right.y_, _STD move(left.y)) || detail::euc_not_equal(right.z_, _STD move(left.z)) || detail::euc_not_equal(right.w_, _STD move(left.w));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static bool operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(meta::is_nothrow_not_equal_v<ElemType, T>)
+		requires meta::not_equal_comparable<ElemType, T> {
+		return detail::euc_not_equal(_STD move(right.x_), _STD move(left.x)) || detail::euc_not_equal(_STD move(right.y_), _STD move(left.y)) || detail::euc_not_equal(_STD move(right.z_), _STD move(left.z)) || detail::euc_not_equal(_STD move(right.w_), _STD move(left.w));
+	}
+#else
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
 		EUCVECTORINLINE auto operator!=(const EuclideanRecVector4<T>& right) const noexcept(noexcept(bool(w_ != right.w_)))
@@ -2695,10 +3159,11 @@ public:
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.w_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.w_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.w_) == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(_STD move(right.x_) == _STD move(left.x))) || (!(_STD move(right.y_) == _STD move(left.y))) || (!(_STD move(right.z_) == _STD move(left.z))) || (!(_STD move(right.w_) == _STD move(left.w)));
 	}
+#endif
 	/*
 		Unary Operators.
 	*/
@@ -2747,6 +3212,87 @@ public:
 		return *this;
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(const EuclideanRecVector4<T>& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, const T&>)
+		requires meta::add_assignable<ElemType, const T&> {
+		detail::euc_add_assign(MX::x_, vector.x_);
+		detail::euc_add_assign(MXY::y_, vector.y_);
+		detail::euc_add_assign(MXYZ::z_, vector.z_);
+		detail::euc_add_assign(w_, vector.w_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(EuclideanRecVector4<T>&& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(MX::x_, _STD move(vector.x_));
+		detail::euc_add_assign(MXY::y_, _STD move(vector.y_));
+		detail::euc_add_assign(MXYZ::z_, _STD move(vector.z_));
+		detail::euc_add_assign(w_, _STD move(vector.w_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator+=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(MX::x_, _STD move(pack.x));
+		detail::euc_add_assign(MXY::y_, _STD move(pack.y));
+		detail::euc_add_assign(MXYZ::z_, _STD move(pack.z));
+		detail::euc_add_assign(w_, _STD move(pack.w));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(const EuclideanRecVector4<T>& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, const T&>)
+		requires meta::sub_assignable<ElemType, const T&> {
+		detail::euc_sub_assign(MX::x_, vector.x_);
+		detail::euc_sub_assign(MXY::y_, vector.y_);
+		detail::euc_sub_assign(MXYZ::z_, vector.z_);
+		detail::euc_sub_assign(w_, vector.w_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(EuclideanRecVector4<T>&& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(MX::x_, _STD move(vector.x_));
+		detail::euc_sub_assign(MXY::y_, _STD move(vector.y_));
+		detail::euc_sub_assign(MXYZ::z_, _STD move(vector.z_));
+		detail::euc_sub_assign(w_, _STD move(vector.w_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator-=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(MX::x_, _STD move(pack.x));
+		detail::euc_sub_assign(MXY::y_, _STD move(pack.y));
+		detail::euc_sub_assign(MXYZ::z_, _STD move(pack.z));
+		detail::euc_sub_assign(w_, _STD move(pack.w));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator*=(T&& scl) & noexcept(meta::is_nothrow_mul_assign_v<ElemType, T&>)
+		requires meta::mul_assignable<ElemType, T&> {
+		detail::euc_mul_assign(MX::x_, scl);
+		detail::euc_mul_assign(MXY::y_, scl);
+		detail::euc_mul_assign(MXYZ::z_, scl);
+		detail::euc_mul_assign(w_, scl);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE LRefEucVector operator/=(T&& scl) & noexcept(meta::is_nothrow_div_assign_v<ElemType, T&>)
+		requires meta::div_assignable<ElemType, T&> {
+		detail::euc_div_assign(MX::x_, scl);
+		detail::euc_div_assign(MXY::y_, scl);
+		detail::euc_div_assign(MXYZ::z_, scl);
+		detail::euc_div_assign(w_, scl);
+		return *this;
+	}
+#else
 	template<class T>
 	EUCVECTORINLINE auto operator+=(const EuclideanRecVector4<T>& vector) & noexcept(noexcept(w_ += vector.w_))
 		-> decltype(w_ += vector.w_, _STD declval<LRefEucVector>()) {
@@ -2907,6 +3453,7 @@ public:
 		w_ = w_ / scl;
 		return *this;
 	}
+#endif
 
 	/*
 		Client Function.
@@ -3749,18 +4296,21 @@ public:
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(const EuclideanRecVector4<T>& vector) const noexcept(noexcept(MXYZ::dot(vector) + decltype(w_ * vector.w_)(w_ * vector.w_)))
 		-> decltype(MXYZ::dot(vector) + decltype(w_ * vector.w_)(w_ * vector.w_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * vector.x_) + (MXY::y_ * vector.y_) + (MXYZ::z_ * vector.z_) + (w_ * vector.w_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(EuclideanRecVector4<T>&& vector) const noexcept(noexcept(MXYZ::dot(_STD move(vector)) + decltype(w_ * _STD move(vector.w_))(w_ * _STD move(vector.w_))))
 		-> decltype(MXYZ::dot(_STD move(vector)) + decltype(w_ * _STD move(vector.w_))(w_ * _STD move(vector.w_))) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * _STD move(vector.x_)) + (MXY::y_ * _STD move(vector.y_)) + (MXYZ::z_ * _STD move(vector.z_)) + (w_ * _STD move(vector.w_));
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(MXYZ::dot(_STD move(pack)) + decltype(w_ * _STD move(pack.x))(w_ * _STD move(pack.x))))
 		-> decltype(MXYZ::dot(_STD move(pack)) + decltype(w_ * _STD move(pack.x))(w_ * _STD move(pack.x))) {
+		EUCINSTRUMENT(dot, EucD);
 		return (MX::x_ * _STD move(pack.x)) + (MXY::y_ * _STD move(pack.y)) + (MXYZ::z_ * _STD move(pack.z)) + (w_ * _STD move(pack.w));
 	}
 	/*
@@ -3775,6 +4325,7 @@ public:
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
 		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return (MX::x_ * MX::x_) + (MXY::y_ * MXY::y_) + (MXYZ::z_ * MXYZ::z_) + (w_ * w_);
 	}
 	/*
@@ -3787,9 +4338,10 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
-		return _STD sqrt((MX::x_ * MX::x_) + (MXY::y_ * MXY::y_) + (MXYZ::z_ * MXYZ::z_) + (w_ * w_));
+		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
+		return detail::euc_sqrt((MX::x_ * MX::x_) + (MXY::y_ * MXY::y_) + (MXYZ::z_ * MXYZ::z_) + (w_ * w_));
 	}
 	/*
 		@brief
@@ -3801,6 +4353,7 @@ public:
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
 		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{w_ / eucnorm<T>()}))
 		->decltype(Packer<T>{w_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { MX::x_ / norm, MXY::y_ / norm, MXYZ::z_ / norm, w_ / norm };
 	}
@@ -3813,6 +4366,7 @@ public:
 	template<class T = ElemType>
 	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		return *this /= eucnorm<T>();
 	}
 
@@ -3864,31 +4418,31 @@ public:
 	/*
 		Constructors.
 	*/
-	EuclideanCmplVector2() noexcept(_STD is_nothrow_constructible_v<ElemType>)
+	constexpr EuclideanCmplVector2() noexcept(_STD is_nothrow_constructible_v<ElemType>)
 		: x_()
 		, y_()
 	{}
 
 	template<class T = ElemType, meta::co_inst_if_t<T, ElemType, _STD is_constructible_v<ElemType, ConstElemType>> = 0>
-	EuclideanCmplVector2(const EuclideanCmplVector2& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ConstElemType>)
+	constexpr EuclideanCmplVector2(const EuclideanCmplVector2& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ConstElemType>)
 		: x_(vector.x_)
 		, y_(vector.y_)
 	{}
 
 	template<class T = ElemType, meta::co_inst_if_t<T, ElemType, _STD is_constructible_v<ElemType, ElemType>> = 0>
-	EuclideanCmplVector2(EuclideanCmplVector2&& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ElemType>)
+	constexpr EuclideanCmplVector2(EuclideanCmplVector2&& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ElemType>)
 		: x_(_STD move(vector.x_))
 		, y_(_STD move(vector.y_))
 	{}
 
 	template<class T, meta::if_t<_STD is_constructible_v<ElemType, T>> = 0>
-	EuclideanCmplVector2(RRefPacker<T> pack) noexcept(_STD is_nothrow_constructible_v<ElemType, T>)
+	constexpr EuclideanCmplVector2(RRefPacker<T> pack) noexcept(_STD is_nothrow_constructible_v<ElemType, T>)
 		: x_(_STD move(pack.x))
 		, y_(_STD move(pack.y))
 	{}
 
 	template<class X, class Y, meta::if_t<meta::is_constructible_anynum_param_v<ElemType, X, Y>> = 0>
-	EuclideanCmplVector2(X&& x, Y&& y) noexcept(noexcept(MX(_STD forward<X>(x))) && _STD is_nothrow_constructible_v<ElemType, Y>)
+	constexpr EuclideanCmplVector2(X&& x, Y&& y) noexcept(_STD is_nothrow_constructible_v<ElemType, X> && _STD is_nothrow_constructible_v<ElemType, Y>)
 		: x_(_STD forward<X>(x))
 		, y_(_STD forward<Y>(y))
 	{}
@@ -3898,218 +4452,255 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(const EuclideanCmplVector2<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ + vector.y_)>>{y_ + vector.y_}))
+		EUCVECTORINLINE constexpr auto operator+(const EuclideanCmplVector2<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ + vector.y_)>>{y_ + vector.y_}))
 		->decltype(Packer<meta::no_ref<decltype(y_ + vector.y_)>>{y_ + vector.y_}) {
 		return { x_ + vector.x_, y_ + vector.y_ };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(EuclideanCmplVector2<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ + _STD move(vector.y_))>>{y_ + _STD move(vector.y_)}))
+		EUCVECTORINLINE constexpr auto operator+(EuclideanCmplVector2<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ + _STD move(vector.y_))>>{y_ + _STD move(vector.y_)}))
 		->decltype(Packer<meta::no_ref<decltype(y_ + _STD move(vector.y_))>>{y_ + _STD move(vector.y_)}) {
 		return { x_ + _STD move(vector.x_), y_ + _STD move(vector.y_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ + _STD move(pack.x))>>{y_ + _STD move(pack.x)}))
+		EUCVECTORINLINE constexpr auto operator+(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ + _STD move(pack.x))>>{y_ + _STD move(pack.x)}))
 		->decltype(Packer<meta::no_ref<decltype(y_ + _STD move(pack.x))>>{y_ + _STD move(pack.x)}) {
 		return { x_ + _STD move(pack.x), y_ + _STD move(pack.y) };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE static auto operator+(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.y_)>>{_STD move(pack.x) + vector.y_}))
+		EUCVECTORINLINE static constexpr auto operator+(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.y_)>>{_STD move(pack.x) + vector.y_}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.y_)>>{_STD move(pack.x) + vector.y_}) {
 		return { _STD move(pack.x) + vector.x_ , _STD move(pack.y) + vector.y_ };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE static auto operator+(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.y_))>>{_STD move(pack.x) + _STD move(vector.y_)}))
+		EUCVECTORINLINE static constexpr auto operator+(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.y_))>>{_STD move(pack.x) + _STD move(vector.y_)}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.y_))>>{_STD move(pack.x) + _STD move(vector.y_)}) {
 		return { _STD move(pack.x) + _STD move(vector.x_),_STD move(pack.y) + _STD move(vector.y_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(const EuclideanCmplVector2<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ - vector.y_)>>{y_ - vector.y_}))
+		EUCVECTORINLINE constexpr auto operator-(const EuclideanCmplVector2<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ - vector.y_)>>{y_ - vector.y_}))
 		->decltype(Packer<meta::no_ref<decltype(y_ - vector.y_)>>{y_ - vector.y_}) {
 		return { x_ - vector.x_, y_ - vector.y_ };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(EuclideanCmplVector2<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ - _STD move(vector.y_))>>{y_ - _STD move(vector.y_)}))
+		EUCVECTORINLINE constexpr auto operator-(EuclideanCmplVector2<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ - _STD move(vector.y_))>>{y_ - _STD move(vector.y_)}))
 		->decltype(Packer<meta::no_ref<decltype(y_ - _STD move(vector.y_))>>{y_ - _STD move(vector.y_)}) {
 		return { x_ - _STD move(vector.x_), y_ - _STD move(vector.y_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ - _STD move(pack.x))>>{y_ - _STD move(pack.x)}))
+		EUCVECTORINLINE constexpr auto operator-(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ - _STD move(pack.x))>>{y_ - _STD move(pack.x)}))
 		->decltype(Packer<meta::no_ref<decltype(y_ - _STD move(pack.x))>>{y_ - _STD move(pack.x)}) {
 		return { x_ - _STD move(pack.x), y_ - _STD move(pack.y) };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE static auto operator-(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.y_)>>{_STD move(pack.x) - vector.y_}))
+		EUCVECTORINLINE static constexpr auto operator-(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.y_)>>{_STD move(pack.x) - vector.y_}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.y_)>>{_STD move(pack.x) - vector.y_}) {
 		return { _STD move(pack.x) - vector.x_ , _STD move(pack.y) - vector.y_ };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE static auto operator-(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.y_))>>{_STD move(pack.x) - _STD move(vector.y_)}))
+		EUCVECTORINLINE static constexpr auto operator-(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.y_))>>{_STD move(pack.x) - _STD move(vector.y_)}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.y_))>>{_STD move(pack.x) - _STD move(vector.y_)}) {
 		return { _STD move(pack.x) - _STD move(vector.x_),_STD move(pack.y) - _STD move(vector.y_) };
 	}
 
 	template<class S>
 	EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE auto operator*(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_* scl)>>{y_* scl}))
+		EUCVECTORINLINE constexpr auto operator*(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_* scl)>>{y_* scl}))
 		->decltype(Packer<meta::no_ref<decltype(y_* scl)>>{y_* scl}) {
 		return { x_ * scl, y_ * scl };
 	}
 
 	template<class S>
 	friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE static auto operator*(S&& scl, LRefConstEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(right.y_* scl)>>{right.y_* scl}))
+		EUCVECTORINLINE static constexpr auto operator*(S&& scl, LRefConstEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(right.y_* scl)>>{right.y_* scl}))
 		->decltype(Packer<meta::no_ref<decltype(right.y_* scl)>>{right.y_* scl}) {
 		return { right.x_ * scl, right.y_ * scl };
 	}
 
 	template<class S>
 	friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE static auto operator*(S&& scl, RRefEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(right.y_)* scl)>>{_STD move(right.y_)* scl}))
+		EUCVECTORINLINE static constexpr auto operator*(S&& scl, RRefEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(right.y_)* scl)>>{_STD move(right.y_)* scl}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(right.y_)* scl)>>{_STD move(right.y_)* scl}) {
 		return { _STD move(right.x_) * scl, _STD move(right.y_) * scl };
 	}
 
 	template<class S>
 	EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-		EUCVECTORINLINE auto operator/(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ / scl)>>{y_ / scl}))
+		EUCVECTORINLINE constexpr auto operator/(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(y_ / scl)>>{y_ / scl}))
 		->decltype(Packer<meta::no_ref<decltype(y_ / scl)>>{y_ / scl}) {
 		return { x_ / scl, y_ / scl };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(const EuclideanCmplVector2<T>& right) const noexcept(noexcept(bool(y_ == right.y_)))
+		EUCVECTORINLINE constexpr auto operator==(const EuclideanCmplVector2<T>& right) const noexcept(noexcept(bool(y_ == right.y_)))
 		-> meta::no_ref<decltype(bool(y_ == right.y_))> {
 		return (x_ == right.x_) && (y_ == right.y_);
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(EuclideanCmplVector2<T>&& right) const noexcept(noexcept(bool(y_ == _STD move(right.y_))))
+		EUCVECTORINLINE constexpr auto operator==(EuclideanCmplVector2<T>&& right) const noexcept(noexcept(bool(y_ == _STD move(right.y_))))
 		-> meta::no_ref<decltype(bool(y_ == _STD move(right.y_)))> {
 		return (x_ == _STD move(right.x_)) && (y_ == _STD move(right.y_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(RRefPacker<T> right) const noexcept(noexcept(bool(y_ == _STD move(right.x))))
+		EUCVECTORINLINE constexpr auto operator==(RRefPacker<T> right) const noexcept(noexcept(bool(y_ == _STD move(right.x))))
 		-> meta::no_ref<decltype(bool(y_ == _STD move(right.x)))> {
 		return (x_ == _STD move(right.x)) && (y_ == _STD move(right.y));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator==(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.y_ == _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator==(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.y_ == _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(right.y_ == _STD move(left.x)))> {
 		return (right.x_ == _STD move(left.x)) && (right.y_ == _STD move(left.y));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator==(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.y_) == _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator==(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.y_) == _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(_STD move(right.y_) == _STD move(left.x)))> {
 		return (_STD move(right.x_) == _STD move(left.x)) && (_STD move(right.y_) == _STD move(left.y));
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr bool operator!=(const EuclideanCmplVector2<T>& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, const T&>)
+		requires meta::not_equal_comparable<LRefConstElemType, const T&> {
+		return detail::euc_not_equal(x_, right.x_) || detail::euc_not_equal(y_, right.y_);
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr bool operator!=(EuclideanCmplVector2<T>&& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(x_, _STD move(right.x_)) || detail::euc_not_equal(y_, _STD move(right.y_));
+	}
+
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(const EuclideanCmplVector2<T>& right) const noexcept(noexcept(bool(y_ != right.y_)))
+		EUCVECTORINLINE constexpr bool operator!=(RRefPacker<T> right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(x_, _STD move(right.x)) || detail::euc_not_equal(y_, _STD move(right.y));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static constexpr bool operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(right.x_, _STD move(left.x)) || detail::euc_not_equal(right.y_, _STD move(left.y));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static constexpr bool operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(meta::is_nothrow_not_equal_v<ElemType, T>)
+		requires meta::not_equal_comparable<ElemType, T> {
+		return detail::euc_not_equal(_STD move(right.x_), _STD move(left.x)) || detail::euc_not_equal(_STD move(right.y_), _STD move(left.y));
+	}
+#else
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr auto operator!=(const EuclideanCmplVector2<T>& right) const noexcept(noexcept(bool(y_ != right.y_)))
 		-> meta::no_ref<decltype(bool(y_ != right.y_))> {
 		return (x_ != right.x_) || (y_ != right.y_);
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(EuclideanCmplVector2<T>&& right) const noexcept(noexcept(bool(y_ != _STD move(right.y_))))
+		EUCVECTORINLINE constexpr auto operator!=(EuclideanCmplVector2<T>&& right) const noexcept(noexcept(bool(y_ != _STD move(right.y_))))
 		-> meta::no_ref<decltype(bool(y_ != _STD move(right.y_)))> {
 		return (x_ != _STD move(right.x_)) || (y_ != _STD move(right.y_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(y_ != _STD move(right.x))))
+		EUCVECTORINLINE constexpr auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(y_ != _STD move(right.x))))
 		-> meta::no_ref<decltype(bool(y_ != _STD move(right.x)), _STD declval<bool>())> {
 		return (x_ != _STD move(right.x)) || (y_ != _STD move(right.y));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.y_ != _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.y_ != _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(right.y_ != _STD move(left.x)), _STD declval<bool>())> {
 		return (right.x_ != _STD move(left.x)) || (right.y_ != _STD move(left.y));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.y_) != _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.y_) != _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(_STD move(right.y_) != _STD move(left.x)), _STD declval<bool>())> {
 		return (_STD move(right.x_) != _STD move(left.x)) || (_STD move(right.y_) != _STD move(left.y));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(const EuclideanCmplVector2<T>& right) const noexcept(noexcept(bool(!(y_ == right.y_))))
+		EUCVECTORINLINE constexpr auto operator!=(const EuclideanCmplVector2<T>& right) const noexcept(noexcept(bool(!(y_ == right.y_))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(right)>>(), bool(!(y_ == right.y_)), _STD declval<bool>())> {
 		return (!(x_ == right.x_)) || (!(y_ == right.y_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(EuclideanCmplVector2<T>&& right) const noexcept(noexcept(bool(!(y_ == _STD move(right.y_)))))
+		EUCVECTORINLINE constexpr auto operator!=(EuclideanCmplVector2<T>&& right) const noexcept(noexcept(bool(!(y_ == _STD move(right.y_)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), bool(!(y_ == _STD move(right.y_))), _STD declval<bool>())> {
 		return (!(x_ == _STD move(right.x_))) || (!(y_ == _STD move(right.y_)));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(!(y_ == _STD move(right.x)))))
+		EUCVECTORINLINE constexpr auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(!(y_ == _STD move(right.x)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), bool(!(y_ == _STD move(right.x))), _STD declval<bool>())> {
 		return (!(x_ == _STD move(right.x))) || (!(y_ == _STD move(right.y)));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(!(right.y_ == _STD move(left.x)))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(!(right.y_ == _STD move(left.x)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(right)>>(), bool(!(right.y_ == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(right.x_ == _STD move(left.x))) || (!(right.y_ == _STD move(left.y)));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.y_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.y_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.y_) == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(_STD move(right.x_) == _STD move(left.x))) || (!(_STD move(right.y_) == _STD move(left.y)));
 	}
+#endif
 	/*
 		Unary Operators.
 	*/
-	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector2<ElemType>& operator+() noexcept {
+	EUCNODISCARD EUCVECTORINLINE constexpr EuclideanCmplVector2<ElemType>& operator+() noexcept {
 		return *this;
 	}
-	EUCNODISCARD EUCVECTORINLINE const EuclideanCmplVector2<ElemType>& operator+() const noexcept {
+	EUCNODISCARD EUCVECTORINLINE constexpr const EuclideanCmplVector2<ElemType>& operator+() const noexcept {
 		return *this;
 	}
 
 	template<class T = ElemType>
-	EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(EuclideanCmplVector2<T>() * -1))
+	EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(EuclideanCmplVector2<T>() * -1))
 		->decltype(EuclideanCmplVector2<T>() * -1) {
 		return { x_ * -1, y_ * -1 };
 	}
@@ -4117,7 +4708,7 @@ public:
 		Assignment Operators.
 	*/
 	template<class T>
-	EUCVECTORINLINE auto operator=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ = vector.y_))
+	EUCVECTORINLINE constexpr auto operator=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ = vector.y_))
 		-> decltype(y_ = vector.y_, _STD declval<LRefEucVector>()) {
 		x_ = vector.x_;
 		y_ = vector.y_;
@@ -4125,7 +4716,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ = _STD move(vector.y_)))
+	EUCVECTORINLINE constexpr auto operator=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ = _STD move(vector.y_)))
 		-> decltype(y_ = _STD move(vector.y_), _STD declval<LRefEucVector>()) {
 		x_ = _STD move(vector.x_);
 		y_ = _STD move(vector.y_);
@@ -4133,15 +4724,80 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator=(RRefPacker<T> pack) & noexcept(noexcept(y_ = _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator=(RRefPacker<T> pack) & noexcept(noexcept(y_ = _STD move(pack.x)))
 		-> decltype(y_ = _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = _STD move(pack.x);
 		y_ = _STD move(pack.y);
 		return *this;
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(const EuclideanCmplVector2<T>& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, const T&>)
+		requires meta::add_assignable<ElemType, const T&> {
+		detail::euc_add_assign(x_, vector.x_);
+		detail::euc_add_assign(y_, vector.y_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(EuclideanCmplVector2<T>&& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(x_, _STD move(vector.x_));
+		detail::euc_add_assign(y_, _STD move(vector.y_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(x_, _STD move(pack.x));
+		detail::euc_add_assign(y_, _STD move(pack.y));
+		return *this;
+	}
+
 	template<class T>
-	EUCVECTORINLINE auto operator+=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ += vector.y_))
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(const EuclideanCmplVector2<T>& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, const T&>)
+		requires meta::sub_assignable<ElemType, const T&> {
+		detail::euc_sub_assign(x_, vector.x_);
+		detail::euc_sub_assign(y_, vector.y_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(EuclideanCmplVector2<T>&& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(x_, _STD move(vector.x_));
+		detail::euc_sub_assign(y_, _STD move(vector.y_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(x_, _STD move(pack.x));
+		detail::euc_sub_assign(y_, _STD move(pack.y));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator*=(T&& scl) & noexcept(meta::is_nothrow_mul_assign_v<ElemType, T&>)
+		requires meta::mul_assignable<ElemType, T&> {
+		detail::euc_mul_assign(x_, scl);
+		detail::euc_mul_assign(y_, scl);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator/=(T&& scl) & noexcept(meta::is_nothrow_div_assign_v<ElemType, T&>)
+		requires meta::div_assignable<ElemType, T&> {
+		detail::euc_div_assign(x_, scl);
+		detail::euc_div_assign(y_, scl);
+		return *this;
+	}
+#else
+	template<class T>
+	EUCVECTORINLINE constexpr auto operator+=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ += vector.y_))
 		-> decltype(y_ += vector.y_, _STD declval<LRefEucVector>()) {
 		x_ += vector.x_;
 		y_ += vector.y_;
@@ -4149,7 +4805,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ += _STD move(vector.y_)))
+	EUCVECTORINLINE constexpr auto operator+=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ += _STD move(vector.y_)))
 		-> decltype(y_ += _STD move(vector.y_), _STD declval<LRefEucVector>()) {
 		x_ += _STD move(vector.x_);
 		y_ += _STD move(vector.y_);
@@ -4157,7 +4813,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(y_ += _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(y_ += _STD move(pack.x)))
 		-> decltype(y_ += _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ += _STD move(pack.x);
 		y_ += _STD move(pack.y);
@@ -4165,7 +4821,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ = y_ + vector.y_))
+	EUCVECTORINLINE constexpr auto operator+=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ = y_ + vector.y_))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(vector)>>, y_ = y_ + vector.y_, _STD declval<LRefEucVector>()) {
 		x_ = x_ + vector.x_;
 		y_ = y_ + vector.y_;
@@ -4173,7 +4829,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ = y_ + _STD move(vector.y_)))
+	EUCVECTORINLINE constexpr auto operator+=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ = y_ + _STD move(vector.y_)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(vector))>>, y_ = y_ + _STD move(vector.y_), _STD declval<LRefEucVector>()) {
 		x_ = x_ + _STD move(vector.x_);
 		y_ = y_ + _STD move(vector.y_);
@@ -4181,7 +4837,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(y_ = y_ + _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(y_ = y_ + _STD move(pack.x)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(pack))>>, y_ = y_ + _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = x_ + _STD move(pack.x);
 		y_ = y_ + _STD move(pack.y);
@@ -4189,7 +4845,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ -= vector.y_))
+	EUCVECTORINLINE constexpr auto operator-=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ -= vector.y_))
 		-> decltype(y_ -= vector.y_, _STD declval<LRefEucVector>()) {
 		x_ -= vector.x_;
 		y_ -= vector.y_;
@@ -4197,7 +4853,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ -= _STD move(vector.y_)))
+	EUCVECTORINLINE constexpr auto operator-=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ -= _STD move(vector.y_)))
 		-> decltype(y_ -= _STD move(vector.y_), _STD declval<LRefEucVector>()) {
 		x_ -= _STD move(vector.x_);
 		y_ -= _STD move(vector.y_);
@@ -4205,7 +4861,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(y_ -= _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(y_ -= _STD move(pack.x)))
 		-> decltype(y_ -= _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ -= _STD move(pack.x);
 		y_ -= _STD move(pack.y);
@@ -4213,7 +4869,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ = y_ - vector.y_))
+	EUCVECTORINLINE constexpr auto operator-=(const EuclideanCmplVector2<T>& vector) & noexcept(noexcept(y_ = y_ - vector.y_))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(vector)>>, y_ = y_ - vector.y_, _STD declval<LRefEucVector>()) {
 		x_ = x_ - vector.x_;
 		y_ = y_ - vector.y_;
@@ -4221,7 +4877,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ = y_ - _STD move(vector.y_)))
+	EUCVECTORINLINE constexpr auto operator-=(EuclideanCmplVector2<T>&& vector) & noexcept(noexcept(y_ = y_ - _STD move(vector.y_)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(vector))>>, y_ = y_ - _STD move(vector.y_), _STD declval<LRefEucVector>()) {
 		x_ = x_ - _STD move(vector.x_);
 		y_ = y_ - _STD move(vector.y_);
@@ -4229,7 +4885,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(y_ = y_ - _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(y_ = y_ - _STD move(pack.x)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(pack))>>, y_ = y_ - _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = x_ - _STD move(pack.x);
 		y_ = y_ - _STD move(pack.y);
@@ -4238,7 +4894,7 @@ public:
 
 
 	template<class T>
-	EUCVECTORINLINE auto operator*=(T&& scl) & noexcept(noexcept(y_ *= scl))
+	EUCVECTORINLINE constexpr auto operator*=(T&& scl) & noexcept(noexcept(y_ *= scl))
 		-> decltype(y_ *= scl, _STD declval<LRefEucVector>()) {
 		x_ *= scl;
 		y_ *= scl;
@@ -4246,7 +4902,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator*=(T&& scl) & noexcept(noexcept(y_ = y_ * scl))
+	EUCVECTORINLINE constexpr auto operator*=(T&& scl) & noexcept(noexcept(y_ = y_ * scl))
 		-> decltype(meta::when_true<!meta::is_invoke_mul_equal_v<decltype(*this), decltype(scl)>>, y_ = y_ * scl, _STD declval<LRefEucVector>()) {
 		x_ = x_ * scl;
 		y_ = y_ * scl;
@@ -4254,7 +4910,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator/=(T&& scl) & noexcept(noexcept(y_ /= scl))
+	EUCVECTORINLINE constexpr auto operator/=(T&& scl) & noexcept(noexcept(y_ /= scl))
 		-> decltype(y_ /= scl, _STD declval<LRefEucVector>()) {
 		x_ /= scl;
 		y_ /= scl;
@@ -4262,12 +4918,13 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator/=(T&& scl) & noexcept(noexcept(y_ = y_ / scl))
+	EUCVECTORINLINE constexpr auto operator/=(T&& scl) & noexcept(noexcept(y_ = y_ / scl))
 		-> decltype(meta::when_true<!meta::is_invoke_div_equal_v<decltype(*this), decltype(scl)>>, y_ = y_ / scl, _STD declval<LRefEucVector>()) {
 		x_ = x_ / scl;
 		y_ = y_ / scl;
 		return *this;
 	}
+#endif
 
 	/*
 		Client Function.
@@ -4309,7 +4966,7 @@ public:
 
 	*/
 	template<class T = ElemType>
-	EUCVECTORINLINE auto zero_self() noexcept(noexcept(_STD declval<_STD add_lvalue_reference_t<T>>() = 0))
+	EUCVECTORINLINE constexpr auto zero_self() noexcept(noexcept(_STD declval<_STD add_lvalue_reference_t<T>>() = 0))
 		-> meta::is_type_t<decltype(_STD declval<_STD add_lvalue_reference_t<T>>() = 0), void> {
 		x_ = 0;
 		y_ = 0;
@@ -4323,7 +4980,7 @@ public:
 
 	*/
 	template<class X, class Y>
-	EUCVECTORINLINE auto set(X&& x, Y&& y) noexcept(noexcept(x_ = _STD forward<X>(x)) && noexcept(y_ = _STD forward<Y>(y)))
+	EUCVECTORINLINE constexpr auto set(X&& x, Y&& y) noexcept(noexcept(x_ = _STD forward<X>(x)) && noexcept(y_ = _STD forward<Y>(y)))
 		-> meta::is_type_t<decltype(x_ = _STD forward<X>(x), y_ = _STD forward<Y>(y)), void> {
 		x_ = _STD forward<X>(x);
 		y_ = _STD forward<Y>(y);
@@ -4338,20 +4995,23 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(const EuclideanCmplVector2<T>& vector) const noexcept(noexcept(x_* vector.x_ + x_ * vector.x_))
+		EUCVECTORINLINE constexpr auto dot(const EuclideanCmplVector2<T>& vector) const noexcept(noexcept(x_* vector.x_ + x_ * vector.x_))
 		-> decltype(x_* vector.x_ + x_ * vector.x_) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * vector.x_ + y_ * vector.y_;
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(EuclideanCmplVector2<T>&& vector) const noexcept(noexcept(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_)))
+		EUCVECTORINLINE constexpr auto dot(EuclideanCmplVector2<T>&& vector) const noexcept(noexcept(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_)))
 		-> decltype(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(x_* _STD move(pack.x) + x_ * _STD move(pack.x)))
+		EUCVECTORINLINE constexpr auto dot(RRefPacker<T> pack) const noexcept(noexcept(x_* _STD move(pack.x) + x_ * _STD move(pack.x)))
 		-> decltype(x_* _STD move(pack.x) + x_ * _STD move(pack.x)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(pack.x) + y_ * _STD move(pack.y);
 	}
 	/*
@@ -4364,8 +5024,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
+		EUCVECTORINLINE constexpr auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return x_ * x_ + y_ * y_;
 	}
 	/*
@@ -4378,9 +5039,10 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
-		return _STD sqrt(x_ * x_ + y_ * y_);
+		EUCVECTORINLINE constexpr auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
+		return detail::euc_sqrt(x_ * x_ + y_ * y_);
 	}
 	/*
 		@brief
@@ -4390,8 +5052,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
-		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{y_ / eucnorm<T>()}))
+		EUCVECTORINLINE constexpr auto normalize() const noexcept(noexcept(Packer<T>{y_ / eucnorm<T>()}))
 		->decltype(Packer<T>{y_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { x_ / norm, y_ / norm };
 	}
@@ -4402,8 +5065,9 @@ public:
 
 	*/
 	template<class T = ElemType>
-	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
+	EUCVECTORINLINE constexpr auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		return *this /= eucnorm<T>();
 	}
 
@@ -4452,35 +5116,35 @@ public:
 	/*
 		Constructors.
 	*/
-	EuclideanCmplVector3() noexcept(_STD is_nothrow_constructible_v<ElemType>)
+	constexpr EuclideanCmplVector3() noexcept(_STD is_nothrow_constructible_v<ElemType>)
 		: x_()
 		, y_()
 		, z_()
 	{}
 
 	template<class T = ElemType, meta::co_inst_if_t<T, ElemType, _STD is_constructible_v<ElemType, ConstElemType>> = 0>
-	EuclideanCmplVector3(const EuclideanCmplVector3& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ConstElemType>)
+	constexpr EuclideanCmplVector3(const EuclideanCmplVector3& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ConstElemType>)
 		: x_(vector.x_)
 		, y_(vector.y_)
 		, z_(vector.z_)
 	{}
 
 	template<class T = ElemType, meta::co_inst_if_t<T, ElemType, _STD is_constructible_v<ElemType, ElemType>> = 0>
-	EuclideanCmplVector3(EuclideanCmplVector3&& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ElemType>)
+	constexpr EuclideanCmplVector3(EuclideanCmplVector3&& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ElemType>)
 		: x_(_STD move(vector.x_))
 		, y_(_STD move(vector.y_))
 		, z_(_STD move(vector.z_))
 	{}
 
 	template<class T, meta::if_t<_STD is_constructible_v<ElemType, T>> = 0>
-	EuclideanCmplVector3(RRefPacker<T> pack) noexcept(_STD is_nothrow_constructible_v<ElemType, T>)
+	constexpr EuclideanCmplVector3(RRefPacker<T> pack) noexcept(_STD is_nothrow_constructible_v<ElemType, T>)
 		: x_(_STD move(pack.x))
 		, y_(_STD move(pack.y))
 		, z_(_STD move(pack.z))
 	{}
 
 	template<class X, class Y, class Z, meta::if_t<meta::is_constructible_anynum_param_v<ElemType, X, Y, Z>> = 0>
-	EuclideanCmplVector3(X&& x, Y&& y, Z&& z) noexcept(_STD is_nothrow_constructible_v<ElemType, X> && _STD is_nothrow_constructible_v<ElemType, Y> && _STD is_nothrow_constructible_v<ElemType, Z>)
+	constexpr EuclideanCmplVector3(X&& x, Y&& y, Z&& z) noexcept(_STD is_nothrow_constructible_v<ElemType, X> && _STD is_nothrow_constructible_v<ElemType, Y> && _STD is_nothrow_constructible_v<ElemType, Z>)
 		: x_(_STD forward<X>(x))
 		, y_(_STD forward<Y>(y))
 		, z_(_STD forward<Z>(z))
@@ -4491,218 +5155,255 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(const EuclideanCmplVector3<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ + vector.z_)>>{z_ + vector.z_}))
+		EUCVECTORINLINE constexpr auto operator+(const EuclideanCmplVector3<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ + vector.z_)>>{z_ + vector.z_}))
 		->decltype(Packer<meta::no_ref<decltype(z_ + vector.z_)>>{z_ + vector.z_}) {
 		return { x_ + vector.x_, y_ + vector.y_, z_ + vector.z_ };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(EuclideanCmplVector3<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ + _STD move(vector.z_))>>{z_ + _STD move(vector.z_)}))
+		EUCVECTORINLINE constexpr auto operator+(EuclideanCmplVector3<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ + _STD move(vector.z_))>>{z_ + _STD move(vector.z_)}))
 		->decltype(Packer<meta::no_ref<decltype(z_ + _STD move(vector.z_))>>{z_ + _STD move(vector.z_)}) {
 		return { x_ + _STD move(vector.x_), y_ + _STD move(vector.y_), z_ + _STD move(vector.z_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ + _STD move(pack.x))>>{z_ + _STD move(pack.x)}))
+		EUCVECTORINLINE constexpr auto operator+(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ + _STD move(pack.x))>>{z_ + _STD move(pack.x)}))
 		->decltype(Packer<meta::no_ref<decltype(z_ + _STD move(pack.x))>>{z_ + _STD move(pack.x)}) {
 		return { x_ + _STD move(pack.x), y_ + _STD move(pack.y), z_ + _STD move(pack.z) };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE static auto operator+(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.z_)>>{_STD move(pack.x) + vector.z_}))
+		EUCVECTORINLINE static constexpr auto operator+(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.z_)>>{_STD move(pack.x) + vector.z_}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.z_)>>{_STD move(pack.x) + vector.z_}) {
 		return { _STD move(pack.x) + vector.x_ , _STD move(pack.y) + vector.y_ , _STD move(pack.z) + vector.z_ };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE static auto operator+(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.z_))>>{_STD move(pack.x) + _STD move(vector.z_)}))
+		EUCVECTORINLINE static constexpr auto operator+(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.z_))>>{_STD move(pack.x) + _STD move(vector.z_)}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.z_))>>{_STD move(pack.x) + _STD move(vector.z_)}) {
 		return { _STD move(pack.x) + _STD move(vector.x_), _STD move(pack.y) + _STD move(vector.y_), _STD move(pack.z) + _STD move(vector.z_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(const EuclideanCmplVector3<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ - vector.z_)>>{z_ - vector.z_}))
+		EUCVECTORINLINE constexpr auto operator-(const EuclideanCmplVector3<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ - vector.z_)>>{z_ - vector.z_}))
 		->decltype(Packer<meta::no_ref<decltype(z_ - vector.z_)>>{z_ - vector.z_}) {
 		return { x_ - vector.x_, y_ - vector.y_, z_ - vector.z_ };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(EuclideanCmplVector3<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ - _STD move(vector.z_))>>{z_ - _STD move(vector.z_)}))
+		EUCVECTORINLINE constexpr auto operator-(EuclideanCmplVector3<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ - _STD move(vector.z_))>>{z_ - _STD move(vector.z_)}))
 		->decltype(Packer<meta::no_ref<decltype(z_ - _STD move(vector.z_))>>{z_ - _STD move(vector.z_)}) {
 		return { x_ - _STD move(vector.x_), y_ - _STD move(vector.y_), z_ - _STD move(vector.z_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ - _STD move(pack.x))>>{z_ - _STD move(pack.x)}))
+		EUCVECTORINLINE constexpr auto operator-(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ - _STD move(pack.x))>>{z_ - _STD move(pack.x)}))
 		->decltype(Packer<meta::no_ref<decltype(z_ - _STD move(pack.x))>>{z_ - _STD move(pack.x)}) {
 		return { x_ - _STD move(pack.x), y_ - _STD move(pack.y), z_ - _STD move(pack.z) };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE static auto operator-(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.z_)>>{_STD move(pack.x) - vector.z_}))
+		EUCVECTORINLINE static constexpr auto operator-(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.z_)>>{_STD move(pack.x) - vector.z_}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.z_)>>{_STD move(pack.x) - vector.z_}) {
 		return { _STD move(pack.x) - vector.x_ , _STD move(pack.y) - vector.y_ , _STD move(pack.z) - vector.z_ };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE static auto operator-(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.z_))>>{_STD move(pack.x) - _STD move(vector.z_)}))
+		EUCVECTORINLINE static constexpr auto operator-(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.z_))>>{_STD move(pack.x) - _STD move(vector.z_)}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.z_))>>{_STD move(pack.x) - _STD move(vector.z_)}) {
 		return { _STD move(pack.x) - _STD move(vector.x_), _STD move(pack.y) - _STD move(vector.y_), _STD move(pack.z) - _STD move(vector.z_) };
 	}
 
 	template<class S>
 	EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE auto operator*(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_* scl)>>{z_* scl}))
+		EUCVECTORINLINE constexpr auto operator*(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_* scl)>>{z_* scl}))
 		->decltype(Packer<meta::no_ref<decltype(z_* scl)>>{z_* scl}) {
 		return { x_ * scl, y_ * scl, z_ * scl };
 	}
 
 	template<class S>
 	friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE static auto operator*(S&& scl, LRefConstEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(right.z_* scl)>>{right.z_* scl}))
+		EUCVECTORINLINE static constexpr auto operator*(S&& scl, LRefConstEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(right.z_* scl)>>{right.z_* scl}))
 		->decltype(Packer<meta::no_ref<decltype(right.z_* scl)>>{right.z_* scl}) {
 		return { right.x_ * scl,  right.y_ * scl, right.z_ * scl };
 	}
 
 	template<class S>
 	friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE static auto operator*(S&& scl, RRefEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(right.z_)* scl)>>{_STD move(right.z_)* scl}))
+		EUCVECTORINLINE static constexpr auto operator*(S&& scl, RRefEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(right.z_)* scl)>>{_STD move(right.z_)* scl}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(right.z_)* scl)>>{_STD move(right.z_)* scl}) {
 		return { _STD move(right.x_) * scl, _STD move(right.y_) * scl, _STD move(right.z_) * scl };
 	}
 
 	template<class S>
 	EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-		EUCVECTORINLINE auto operator/(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ / scl)>>{z_ / scl}))
+		EUCVECTORINLINE constexpr auto operator/(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(z_ / scl)>>{z_ / scl}))
 		->decltype(Packer<meta::no_ref<decltype(z_ / scl)>>{z_ / scl}) {
 		return { x_ / scl, y_ / scl, z_ / scl };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(const EuclideanCmplVector3<T>& right) const noexcept(noexcept(bool(z_ == right.z_)))
+		EUCVECTORINLINE constexpr auto operator==(const EuclideanCmplVector3<T>& right) const noexcept(noexcept(bool(z_ == right.z_)))
 		-> meta::no_ref<decltype(bool(z_ == right.z_))> {
 		return (x_ == right.x_) && (y_ == right.y_) && (z_ == right.z_);
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(EuclideanCmplVector3<T>&& right) const noexcept(noexcept(bool(z_ == _STD move(right.z_))))
+		EUCVECTORINLINE constexpr auto operator==(EuclideanCmplVector3<T>&& right) const noexcept(noexcept(bool(z_ == _STD move(right.z_))))
 		-> meta::no_ref<decltype(bool(z_ == _STD move(right.z_)))> {
 		return (x_ == _STD move(right.x_)) && (y_ == _STD move(right.y_)) && (z_ == _STD move(right.z_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(RRefPacker<T> right) const noexcept(noexcept(bool(z_ == _STD move(right.x))))
+		EUCVECTORINLINE constexpr auto operator==(RRefPacker<T> right) const noexcept(noexcept(bool(z_ == _STD move(right.x))))
 		-> meta::no_ref<decltype(bool(z_ == _STD move(right.x)))> {
 		return (x_ == _STD move(right.x)) && (y_ == _STD move(right.y)) && (z_ == _STD move(right.z));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator==(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.z_ == _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator==(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.z_ == _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(right.z_ == _STD move(left.x)))> {
 		return (right.x_ == _STD move(left.x)) && (right.y_ == _STD move(left.y)) && (right.z_ == _STD move(left.z));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator==(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.z_) == _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator==(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.z_) == _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(_STD move(right.z_) == _STD move(left.x)))> {
 		return (_STD move(right.x_) == _STD move(left.x)) && (_STD move(right.y_) == _STD move(left.y)) && (_STD move(right.z_) == _STD move(left.z));
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr bool operator!=(const EuclideanCmplVector3<T>& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, const T&>)
+		requires meta::not_equal_comparable<LRefConstElemType, const T&> {
+		return detail::euc_not_equal(x_, right.x_) || detail::euc_not_equal(y_, right.y_) || detail::euc_not_equal(z_, right.z_);
+	}
+
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(const EuclideanCmplVector3<T>& right) const noexcept(noexcept(bool(z_ != right.z_)))
+		EUCVECTORINLINE constexpr bool operator!=(EuclideanCmplVector3<T>&& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(x_, _STD move(right.x_)) || detail::euc_not_equal(y_, _STD move(right.y_)) || detail::euc_not_equal(z_, _STD move(right.z_));
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr bool operator!=(RRefPacker<T> right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(x_, _STD move(right.x)) || detail::euc_not_equal(y_, _STD move(right.y)) || detail::euc_not_equal(z_, _STD move(right.z));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static constexpr bool operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(right.x_, _STD move(left.x)) || detail::euc_not_equal(right.y_, _STD move(left.y)) || detail::euc_not_equal(right.z_, _STD move(left.z));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static constexpr bool operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(meta::is_nothrow_not_equal_v<ElemType, T>)
+		requires meta::not_equal_comparable<ElemType, T> {
+		return detail::euc_not_equal(_STD move(right.x_), _STD move(left.x)) || detail::euc_not_equal(_STD move(right.y_), _STD move(left.y)) || detail::euc_not_equal(_STD move(right.z_), _STD move(left.z));
+	}
+#else
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr auto operator!=(const EuclideanCmplVector3<T>& right) const noexcept(noexcept(bool(z_ != right.z_)))
 		-> meta::no_ref<decltype(bool(z_ != right.z_))> {
 		return (x_ != right.x_) || (y_ != right.y_) || (z_ != right.z_);
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(EuclideanCmplVector3<T>&& right) const noexcept(noexcept(bool(z_ != _STD move(right.z_))))
+		EUCVECTORINLINE constexpr auto operator!=(EuclideanCmplVector3<T>&& right) const noexcept(noexcept(bool(z_ != _STD move(right.z_))))
 		-> meta::no_ref<decltype(bool(z_ != _STD move(right.z_)))> {
 		return (x_ != _STD move(right.x_)) || (y_ != _STD move(right.y_)) || (z_ != _STD move(right.z_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(z_ != _STD move(right.x))))
+		EUCVECTORINLINE constexpr auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(z_ != _STD move(right.x))))
 		-> meta::no_ref<decltype(bool(z_ != _STD move(right.x)), _STD declval<bool>())> {
 		return (x_ != _STD move(right.x)) || (y_ != _STD move(right.y)) || (z_ != _STD move(right.z));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.z_ != _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.z_ != _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(right.z_ != _STD move(left.x)), _STD declval<bool>())> {
 		return (right.x_ != _STD move(left.x)) || (right.y_ != _STD move(left.y)) || (right.z_ != _STD move(left.z));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.z_) != _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.z_) != _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(_STD move(right.z_) != _STD move(left.x)), _STD declval<bool>())> {
 		return (_STD move(right.x_) != _STD move(left.x)) || (_STD move(right.y_) != _STD move(left.y)) || (_STD move(right.z_) != _STD move(left.z));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(const EuclideanCmplVector3<T>& right) const noexcept(noexcept(bool(!(z_ == right.z_))))
+		EUCVECTORINLINE constexpr auto operator!=(const EuclideanCmplVector3<T>& right) const noexcept(noexcept(bool(!(z_ == right.z_))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(right)>>(), bool(!(z_ == right.z_)), _STD declval<bool>())> {
 		return (!(x_ == right.x_)) || (!(y_ == right.y_)) || (!(z_ == right.z_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(EuclideanCmplVector3<T>&& right) const noexcept(noexcept(bool(!(z_ == _STD move(right.z_)))))
+		EUCVECTORINLINE constexpr auto operator!=(EuclideanCmplVector3<T>&& right) const noexcept(noexcept(bool(!(z_ == _STD move(right.z_)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), bool(!(z_ == _STD move(right.z_))), _STD declval<bool>())> {
 		return (!(x_ == _STD move(right.x_))) || (!(y_ == _STD move(right.y_))) || (!(z_ == _STD move(right.z_)));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(!(z_ == _STD move(right.x)))))
+		EUCVECTORINLINE constexpr auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(!(z_ == _STD move(right.x)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), bool(!(z_ == _STD move(right.x))), _STD declval<bool>())> {
 		return (!(x_ == _STD move(right.x))) || (!(y_ == _STD move(right.y))) || (!(z_ == _STD move(right.z)));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(!(right.z_ == _STD move(left.x)))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(!(right.z_ == _STD move(left.x)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(right)>>(), bool(!(right.z_ == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(right.x_ == _STD move(left.x))) || (!(right.y_ == _STD move(left.y))) || (!(right.z_ == _STD move(left.z)));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.z_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.z_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.z_) == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(_STD move(right.x_) == _STD move(left.x))) || (!(_STD move(right.y_) == _STD move(left.y))) || (!(_STD move(right.z_) == _STD move(left.z)));
 	}
+#endif
 	/*
 		Unary Operators.
 	*/
-	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<ElemType>& operator+() noexcept {
+	EUCNODISCARD EUCVECTORINLINE constexpr EuclideanCmplVector3<ElemType>& operator+() noexcept {
 		return *this;
 	}
-	EUCNODISCARD EUCVECTORINLINE const EuclideanCmplVector3<ElemType>& operator+() const noexcept {
+	EUCNODISCARD EUCVECTORINLINE constexpr const EuclideanCmplVector3<ElemType>& operator+() const noexcept {
 		return *this;
 	}
 
 	template<class T = ElemType>
-	EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(EuclideanCmplVector3<T>() * -1))
+	EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(EuclideanCmplVector3<T>() * -1))
 		->decltype(EuclideanCmplVector3<T>() * -1) {
 		return { x_ * -1, y_ * -1, z_ * -1 };
 	}
@@ -4710,7 +5411,7 @@ public:
 		Assignment Operators.
 	*/
 	template<class T>
-	EUCVECTORINLINE auto operator=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ = vector.z_))
+	EUCVECTORINLINE constexpr auto operator=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ = vector.z_))
 		-> decltype(z_ = vector.z_, _STD declval<LRefEucVector>()) {
 		x_ = vector.x_;
 		y_ = vector.y_;
@@ -4719,7 +5420,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ = _STD move(vector.z_)))
+	EUCVECTORINLINE constexpr auto operator=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ = _STD move(vector.z_)))
 		-> decltype(z_ = _STD move(vector.z_), _STD declval<LRefEucVector>()) {
 		x_ = _STD move(vector.x_);
 		y_ = _STD move(vector.y_);
@@ -4728,7 +5429,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator=(RRefPacker<T> pack) & noexcept(noexcept(z_ = _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator=(RRefPacker<T> pack) & noexcept(noexcept(z_ = _STD move(pack.x)))
 		-> decltype(z_ = _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = _STD move(pack.x);
 		y_ = _STD move(pack.y);
@@ -4736,8 +5437,81 @@ public:
 		return *this;
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(const EuclideanCmplVector3<T>& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, const T&>)
+		requires meta::add_assignable<ElemType, const T&> {
+		detail::euc_add_assign(x_, vector.x_);
+		detail::euc_add_assign(y_, vector.y_);
+		detail::euc_add_assign(z_, vector.z_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(EuclideanCmplVector3<T>&& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(x_, _STD move(vector.x_));
+		detail::euc_add_assign(y_, _STD move(vector.y_));
+		detail::euc_add_assign(z_, _STD move(vector.z_));
+		return *this;
+	}
+
 	template<class T>
-	EUCVECTORINLINE auto operator+=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ += vector.z_))
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(x_, _STD move(pack.x));
+		detail::euc_add_assign(y_, _STD move(pack.y));
+		detail::euc_add_assign(z_, _STD move(pack.z));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(const EuclideanCmplVector3<T>& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, const T&>)
+		requires meta::sub_assignable<ElemType, const T&> {
+		detail::euc_sub_assign(x_, vector.x_);
+		detail::euc_sub_assign(y_, vector.y_);
+		detail::euc_sub_assign(z_, vector.z_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(EuclideanCmplVector3<T>&& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(x_, _STD move(vector.x_));
+		detail::euc_sub_assign(y_, _STD move(vector.y_));
+		detail::euc_sub_assign(z_, _STD move(vector.z_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(x_, _STD move(pack.x));
+		detail::euc_sub_assign(y_, _STD move(pack.y));
+		detail::euc_sub_assign(z_, _STD move(pack.z));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator*=(T&& scl) & noexcept(meta::is_nothrow_mul_assign_v<ElemType, T&>)
+		requires meta::mul_assignable<ElemType, T&> {
+		detail::euc_mul_assign(x_, scl);
+		detail::euc_mul_assign(y_, scl);
+		detail::euc_mul_assign(z_, scl);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator/=(T&& scl) & noexcept(meta::is_nothrow_div_assign_v<ElemType, T&>)
+		requires meta::div_assignable<ElemType, T&> {
+		detail::euc_div_assign(x_, scl);
+		detail::euc_div_assign(y_, scl);
+		detail::euc_div_assign(z_, scl);
+		return *this;
+	}
+#else
+	template<class T>
+	EUCVECTORINLINE constexpr auto operator+=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ += vector.z_))
 		-> decltype(z_ += vector.z_, _STD declval<LRefEucVector>()) {
 		x_ += vector.x_;
 		y_ += vector.y_;
@@ -4746,7 +5520,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ += _STD move(vector.z_)))
+	EUCVECTORINLINE constexpr auto operator+=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ += _STD move(vector.z_)))
 		-> decltype(z_ += _STD move(vector.z_), _STD declval<LRefEucVector>()) {
 		x_ += _STD move(vector.x_);
 		y_ += _STD move(vector.y_);
@@ -4755,7 +5529,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(z_ += _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(z_ += _STD move(pack.x)))
 		-> decltype(z_ += _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ += _STD move(pack.x);
 		y_ += _STD move(pack.y);
@@ -4764,7 +5538,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ = z_ + vector.z_))
+	EUCVECTORINLINE constexpr auto operator+=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ = z_ + vector.z_))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(vector)>>, z_ = z_ + vector.z_, _STD declval<LRefEucVector>()) {
 		x_ = x_ + vector.x_;
 		y_ = y_ + vector.y_;
@@ -4773,7 +5547,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ = z_ + _STD move(vector.z_)))
+	EUCVECTORINLINE constexpr auto operator+=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ = z_ + _STD move(vector.z_)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(vector))>>, z_ = z_ + _STD move(vector.z_), _STD declval<LRefEucVector>()) {
 		x_ = x_ + _STD move(vector.x_);
 		y_ = y_ + _STD move(vector.y_);
@@ -4782,7 +5556,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(z_ = z_ + _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(z_ = z_ + _STD move(pack.x)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(pack))>>, z_ = z_ + _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = x_ + _STD move(pack.x);
 		y_ = y_ + _STD move(pack.y);
@@ -4791,7 +5565,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ -= vector.z_))
+	EUCVECTORINLINE constexpr auto operator-=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ -= vector.z_))
 		-> decltype(z_ -= vector.z_, _STD declval<LRefEucVector>()) {
 		x_ -= vector.x_;
 		y_ -= vector.y_;
@@ -4800,7 +5574,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ -= _STD move(vector.z_)))
+	EUCVECTORINLINE constexpr auto operator-=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ -= _STD move(vector.z_)))
 		-> decltype(z_ -= _STD move(vector.z_), _STD declval<LRefEucVector>()) {
 		x_ -= _STD move(vector.x_);
 		y_ -= _STD move(vector.y_);
@@ -4809,7 +5583,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(z_ -= _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(z_ -= _STD move(pack.x)))
 		-> decltype(z_ -= _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ -= _STD move(pack.x);
 		y_ -= _STD move(pack.y);
@@ -4818,7 +5592,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ = z_ - vector.z_))
+	EUCVECTORINLINE constexpr auto operator-=(const EuclideanCmplVector3<T>& vector) & noexcept(noexcept(z_ = z_ - vector.z_))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(vector)>>, z_ = z_ - vector.z_, _STD declval<LRefEucVector>()) {
 		x_ = x_ - vector.x_;
 		y_ = y_ - vector.y_;
@@ -4827,7 +5601,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ = z_ - _STD move(vector.z_)))
+	EUCVECTORINLINE constexpr auto operator-=(EuclideanCmplVector3<T>&& vector) & noexcept(noexcept(z_ = z_ - _STD move(vector.z_)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(vector))>>, z_ = z_ - _STD move(vector.z_), _STD declval<LRefEucVector>()) {
 		x_ = x_ - _STD move(vector.x_);
 		y_ = y_ - _STD move(vector.y_);
@@ -4836,7 +5610,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(z_ = z_ - _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(z_ = z_ - _STD move(pack.x)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(pack))>>, z_ = z_ - _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = x_ - _STD move(pack.x);
 		y_ = y_ - _STD move(pack.y);
@@ -4846,7 +5620,7 @@ public:
 
 
 	template<class T>
-	EUCVECTORINLINE auto operator*=(T&& scl) & noexcept(noexcept(z_ *= scl))
+	EUCVECTORINLINE constexpr auto operator*=(T&& scl) & noexcept(noexcept(z_ *= scl))
 		-> decltype(z_ *= scl, _STD declval<LRefEucVector>()) {
 		x_ *= scl;
 		y_ *= scl;
@@ -4855,7 +5629,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator*=(T&& scl) & noexcept(noexcept(z_ = z_ * scl))
+	EUCVECTORINLINE constexpr auto operator*=(T&& scl) & noexcept(noexcept(z_ = z_ * scl))
 		-> decltype(meta::when_true<!meta::is_invoke_mul_equal_v<decltype(*this), decltype(scl)>>, z_ = z_ * scl, _STD declval<LRefEucVector>()) {
 		x_ = x_ * scl;
 		y_ = y_ * scl;
@@ -4864,7 +5638,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator/=(T&& scl) & noexcept(noexcept(z_ /= scl))
+	EUCVECTORINLINE constexpr auto operator/=(T&& scl) & noexcept(noexcept(z_ /= scl))
 		-> decltype(z_ /= scl, _STD declval<LRefEucVector>()) {
 		x_ /= scl;
 		y_ /= scl;
@@ -4873,13 +5647,14 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator/=(T&& scl) & noexcept(noexcept(z_ = z_ / scl))
+	EUCVECTORINLINE constexpr auto operator/=(T&& scl) & noexcept(noexcept(z_ = z_ / scl))
 		-> decltype(meta::when_true<!meta::is_invoke_div_equal_v<decltype(*this), decltype(scl)>>, z_ = z_ / scl, _STD declval<LRefEucVector>()) {
 		x_ = x_ / scl;
 		y_ = y_ / scl;
 		z_ = z_ / scl;
 		return *this;
 	}
+#endif
 
 	/*
 		Client Function.
@@ -4995,7 +5770,7 @@ public:
 
 	*/
 	template<class T = ElemType>
-	EUCVECTORINLINE auto zero_self() noexcept(noexcept(_STD declval<_STD add_lvalue_reference_t<T>>() = 0))
+	EUCVECTORINLINE constexpr auto zero_self() noexcept(noexcept(_STD declval<_STD add_lvalue_reference_t<T>>() = 0))
 		-> meta::is_type_t<decltype(_STD declval<_STD add_lvalue_reference_t<T>>() = 0), void> {
 		x_ = 0;
 		y_ = 0;
@@ -5010,7 +5785,7 @@ public:
 
 	*/
 	template<class X, class Y, class Z>
-	EUCVECTORINLINE auto set(X&& x, Y&& y, Z&& z) noexcept(noexcept(x_ = _STD forward<X>(x)) && noexcept(y_ = _STD forward<Y>(y)) && noexcept(z_ = _STD forward<Z>(z)))
+	EUCVECTORINLINE constexpr auto set(X&& x, Y&& y, Z&& z) noexcept(noexcept(x_ = _STD forward<X>(x)) && noexcept(y_ = _STD forward<Y>(y)) && noexcept(z_ = _STD forward<Z>(z)))
 		-> meta::is_type_t<decltype(x_ = _STD forward<X>(x), y_ = _STD forward<Y>(y), z_ = _STD forward<Z>(z)), void> {
 		x_ = _STD forward<X>(x);
 		y_ = _STD forward<Y>(y);
@@ -5026,20 +5801,23 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(const EuclideanCmplVector3<T>& vector) const noexcept(noexcept(x_* vector.x_ + x_ * vector.x_ + x_ * vector.x_))
+		EUCVECTORINLINE constexpr auto dot(const EuclideanCmplVector3<T>& vector) const noexcept(noexcept(x_* vector.x_ + x_ * vector.x_ + x_ * vector.x_))
 		-> decltype(x_* vector.x_ + x_ * vector.x_ + x_ * vector.x_) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * vector.x_ + y_ * vector.y_ + z_ * vector.z_;
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(EuclideanCmplVector3<T>&& vector) const noexcept(noexcept(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_)))
+		EUCVECTORINLINE constexpr auto dot(EuclideanCmplVector3<T>&& vector) const noexcept(noexcept(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_)))
 		-> decltype(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(vector.x_) + y_ * _STD move(vector.y_) + z_ * _STD move(vector.z_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(x_* _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x)))
+		EUCVECTORINLINE constexpr auto dot(RRefPacker<T> pack) const noexcept(noexcept(x_* _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x)))
 		-> decltype(x_* _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(pack.x) + y_ * _STD move(pack.y) + z_ * _STD move(pack.z);
 	}
 	/*
@@ -5052,8 +5830,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
+		EUCVECTORINLINE constexpr auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return x_ * x_ + y_ * y_ + z_ * z_;
 	}
 	/*
@@ -5066,9 +5845,10 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
-		return _STD sqrt(x_ * x_ + y_ * y_ + z_ * z_);
+		EUCVECTORINLINE constexpr auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
+		return detail::euc_sqrt(x_ * x_ + y_ * y_ + z_ * z_);
 	}
 	/*
 		@brief
@@ -5078,8 +5858,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
-		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{z_ / eucnorm<T>()}))
+		EUCVECTORINLINE constexpr auto normalize() const noexcept(noexcept(Packer<T>{z_ / eucnorm<T>()}))
 		->decltype(Packer<T>{z_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { x_ / norm, y_ / norm, z_ / norm };
 	}
@@ -5090,8 +5871,9 @@ public:
 
 	*/
 	template<class T = ElemType>
-	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
+	EUCVECTORINLINE constexpr auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		return *this /= eucnorm<T>();
 	}
 	/*
@@ -5102,23 +5884,26 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The cross product calculation results are being ignored, which could suggest an unintended call.")
-		EUCVECTORINLINE auto cross(const EuclideanCmplVector3<T>& right) const noexcept(
+		EUCVECTORINLINE constexpr auto cross(const EuclideanCmplVector3<T>& right) const noexcept(
 			noexcept(Packer<decltype(z_* right.z_ - z_ * right.z_)>{ z_* right.z_ - z_ * right.z_ }))
 		-> decltype(Packer<decltype(z_* right.z_ - z_ * right.z_)>{ z_* right.z_ - z_ * right.z_ }) {
+		EUCINSTRUMENT(cross, EucD);
 		return { y_ * right.z_ - z_ * right.y_, z_ * right.x_ - x_ * right.z_, x_ * right.y_ - y_ * right.x_ };
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The cross product calculation results are being ignored, which could suggest an unintended call.")
-		EUCVECTORINLINE auto cross(EuclideanCmplVector3<T>&& right) const noexcept(
+		EUCVECTORINLINE constexpr auto cross(EuclideanCmplVector3<T>&& right) const noexcept(
 			noexcept(Packer<decltype(z_* _STD move(right.z_) - z_ * _STD move(right.z_))>{ z_* _STD move(right.z_) - z_ * _STD move(right.z_) }))
 		-> decltype(Packer<decltype(z_* _STD move(right.z_) - z_ * _STD move(right.z_))>{ z_* _STD move(right.z_) - z_ * _STD move(right.z_) }) {
+		EUCINSTRUMENT(cross, EucD);
 		return { y_ * _STD move(right.z_) - z_ * _STD move(right.y_), z_ * _STD move(right.x_) - x_ * _STD move(right.z_), x_ * _STD move(right.y_) - y_ * _STD move(right.x_) };
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The cross product calculation results are being ignored, which could suggest an unintended call.")
-		EUCVECTORINLINE auto cross(RRefPacker<T> right) const noexcept(
+		EUCVECTORINLINE constexpr auto cross(RRefPacker<T> right) const noexcept(
 			noexcept(Packer<decltype(z_* _STD move(right.z) - z_ * _STD move(right.z))>{ z_* _STD move(right.z) - z_ * _STD move(right.z) }))
 		-> decltype(Packer<decltype(z_* _STD move(right.z) - z_ * _STD move(right.z))>{ z_* _STD move(right.z) - z_ * _STD move(right.z) }) {
+		EUCINSTRUMENT(cross, EucD);
 		return { y_ * _STD move(right.z) - z_ * _STD move(right.y), z_ * _STD move(right.x) - x_ * _STD move(right.z), x_ * _STD move(right.y) - y_ * _STD move(right.x) };
 	}
 };
@@ -5168,7 +5953,7 @@ public:
 	/*
 		Constructors.
 	*/
-	EuclideanCmplVector4() noexcept(_STD is_nothrow_constructible_v<ElemType>)
+	constexpr EuclideanCmplVector4() noexcept(_STD is_nothrow_constructible_v<ElemType>)
 		: x_()
 		, y_()
 		, z_()
@@ -5176,7 +5961,7 @@ public:
 	{}
 
 	template<class T = ElemType, meta::co_inst_if_t<T, ElemType, _STD is_constructible_v<ElemType, ConstElemType>> = 0>
-	EuclideanCmplVector4(const EuclideanCmplVector4& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ConstElemType>)
+	constexpr EuclideanCmplVector4(const EuclideanCmplVector4& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ConstElemType>)
 		: x_(vector.x_)
 		, y_(vector.y_)
 		, z_(vector.z_)
@@ -5184,7 +5969,7 @@ public:
 	{}
 
 	template<class T = ElemType, meta::co_inst_if_t<T, ElemType, _STD is_constructible_v<ElemType, ElemType>> = 0>
-	EuclideanCmplVector4(EuclideanCmplVector4&& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ElemType>)
+	constexpr EuclideanCmplVector4(EuclideanCmplVector4&& vector) noexcept(_STD is_nothrow_constructible_v<ElemType, ElemType>)
 		: x_(_STD move(vector.x_))
 		, y_(_STD move(vector.y_))
 		, z_(_STD move(vector.z_))
@@ -5192,7 +5977,7 @@ public:
 	{}
 
 	template<class T, meta::if_t<_STD is_constructible_v<ElemType, T>> = 0>
-	EuclideanCmplVector4(RRefPacker<T> pack) noexcept(_STD is_nothrow_constructible_v<ElemType, T>)
+	constexpr EuclideanCmplVector4(RRefPacker<T> pack) noexcept(_STD is_nothrow_constructible_v<ElemType, T>)
 		: x_(_STD move(pack.x))
 		, y_(_STD move(pack.y))
 		, z_(_STD move(pack.z))
@@ -5200,7 +5985,7 @@ public:
 	{}
 
 	template<class X, class Y, class Z, class W, meta::if_t<meta::is_constructible_anynum_param_v<ElemType, X, Y, Z, W>> = 0>
-	EuclideanCmplVector4(X&& x, Y&& y, Z&& z, W&& w) noexcept(_STD is_nothrow_constructible_v<ElemType, X> && _STD is_nothrow_constructible_v<ElemType, Y> && _STD is_nothrow_constructible_v<ElemType, Z> && _STD is_nothrow_constructible_v<ElemType, W>)
+	constexpr EuclideanCmplVector4(X&& x, Y&& y, Z&& z, W&& w) noexcept(_STD is_nothrow_constructible_v<ElemType, X> && _STD is_nothrow_constructible_v<ElemType, Y> && _STD is_nothrow_constructible_v<ElemType, Z> && _STD is_nothrow_constructible_v<ElemType, W>)
 		: x_(_STD forward<X>(x))
 		, y_(_STD forward<Y>(y))
 		, z_(_STD forward<Z>(z))
@@ -5212,218 +5997,255 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(const EuclideanCmplVector4<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ + vector.w_)>>{w_ + vector.w_}))
+		EUCVECTORINLINE constexpr auto operator+(const EuclideanCmplVector4<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ + vector.w_)>>{w_ + vector.w_}))
 		->decltype(Packer<meta::no_ref<decltype(w_ + vector.w_)>>{w_ + vector.w_}) {
 		return { x_ + vector.x_, y_ + vector.y_, z_ + vector.z_, w_ + vector.w_ };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(EuclideanCmplVector4<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ + _STD move(vector.w_))>>{w_ + _STD move(vector.w_)}))
+		EUCVECTORINLINE constexpr auto operator+(EuclideanCmplVector4<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ + _STD move(vector.w_))>>{w_ + _STD move(vector.w_)}))
 		->decltype(Packer<meta::no_ref<decltype(w_ + _STD move(vector.w_))>>{w_ + _STD move(vector.w_)}) {
 		return { x_ + _STD move(vector.x_), y_ + _STD move(vector.y_), z_ + _STD move(vector.z_), w_ + _STD move(vector.w_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE auto operator+(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ + _STD move(pack.x))>>{w_ + _STD move(pack.x)}))
+		EUCVECTORINLINE constexpr auto operator+(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ + _STD move(pack.x))>>{w_ + _STD move(pack.x)}))
 		->decltype(Packer<meta::no_ref<decltype(w_ + _STD move(pack.x))>>{w_ + _STD move(pack.x)}) {
 		return { x_ + _STD move(pack.x), y_ + _STD move(pack.y), z_ + _STD move(pack.z), w_ + _STD move(pack.w) };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE static auto operator+(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.w_)>>{_STD move(pack.x) + vector.w_}))
+		EUCVECTORINLINE static constexpr auto operator+(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.w_)>>{_STD move(pack.x) + vector.w_}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) + vector.w_)>>{_STD move(pack.x) + vector.w_}) {
 		return { _STD move(pack.x) + vector.x_ , _STD move(pack.y) + vector.y_ , _STD move(pack.z) + vector.z_ , _STD move(pack.w) + vector.w_ };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the addition is being ignored. If you intend to modify the lvalue, please use [+=] instead.")
-		EUCVECTORINLINE static auto operator+(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.w_))>>{_STD move(pack.x) + _STD move(vector.w_)}))
+		EUCVECTORINLINE static constexpr auto operator+(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.w_))>>{_STD move(pack.x) + _STD move(vector.w_)}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) + _STD move(vector.w_))>>{_STD move(pack.x) + _STD move(vector.w_)}) {
 		return { _STD move(pack.x) + _STD move(vector.x_), _STD move(pack.y) + _STD move(vector.y_),  _STD move(pack.z) + _STD move(vector.z_), _STD move(pack.w) + _STD move(vector.w_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(const EuclideanCmplVector4<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ - vector.w_)>>{w_ - vector.w_}))
+		EUCVECTORINLINE constexpr auto operator-(const EuclideanCmplVector4<T>& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ - vector.w_)>>{w_ - vector.w_}))
 		->decltype(Packer<meta::no_ref<decltype(w_ - vector.w_)>>{w_ - vector.w_}) {
 		return { x_ - vector.x_, y_ - vector.y_, z_ - vector.z_, w_ - vector.w_ };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(EuclideanCmplVector4<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ - _STD move(vector.w_))>>{w_ - _STD move(vector.w_)}))
+		EUCVECTORINLINE constexpr auto operator-(EuclideanCmplVector4<T>&& vector) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ - _STD move(vector.w_))>>{w_ - _STD move(vector.w_)}))
 		->decltype(Packer<meta::no_ref<decltype(w_ - _STD move(vector.w_))>>{w_ - _STD move(vector.w_)}) {
 		return { x_ - _STD move(vector.x_), y_ - _STD move(vector.y_), z_ - _STD move(vector.z_), w_ - _STD move(vector.w_) };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE auto operator-(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ - _STD move(pack.x))>>{w_ - _STD move(pack.x)}))
+		EUCVECTORINLINE constexpr auto operator-(RRefPacker<T> pack) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ - _STD move(pack.x))>>{w_ - _STD move(pack.x)}))
 		->decltype(Packer<meta::no_ref<decltype(w_ - _STD move(pack.x))>>{w_ - _STD move(pack.x)}) {
 		return { x_ - _STD move(pack.x), y_ - _STD move(pack.y), z_ - _STD move(pack.z), w_ - _STD move(pack.w) };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE static auto operator-(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.w_)>>{_STD move(pack.x) - vector.w_}))
+		EUCVECTORINLINE static constexpr auto operator-(RRefPacker<T> pack, LRefConstEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.w_)>>{_STD move(pack.x) - vector.w_}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) - vector.w_)>>{_STD move(pack.x) - vector.w_}) {
 		return { _STD move(pack.x) - vector.x_ , _STD move(pack.y) - vector.y_ , _STD move(pack.z) - vector.z_ , _STD move(pack.w) - vector.w_ };
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The result of the subtraction is being ignored. If you intend to modify the lvalue, please use [-=] instead.")
-		EUCVECTORINLINE static auto operator-(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.w_))>>{_STD move(pack.x) - _STD move(vector.w_)}))
+		EUCVECTORINLINE static constexpr auto operator-(RRefPacker<T> pack, RRefEucVector vector) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.w_))>>{_STD move(pack.x) - _STD move(vector.w_)}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(pack.x) - _STD move(vector.w_))>>{_STD move(pack.x) - _STD move(vector.w_)}) {
 		return { _STD move(pack.x) - _STD move(vector.x_), _STD move(pack.y) - _STD move(vector.y_),  _STD move(pack.z) - _STD move(vector.z_), _STD move(pack.w) - _STD move(vector.w_) };
 	}
 
 	template<class S>
 	EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE auto operator*(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_* scl)>>{w_* scl}))
+		EUCVECTORINLINE constexpr auto operator*(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_* scl)>>{w_* scl}))
 		->decltype(Packer<meta::no_ref<decltype(w_* scl)>>{w_* scl}) {
 		return { x_ * scl, y_ * scl, z_ * scl, w_ * scl };
 	}
 
 	template<class S>
 	friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE static auto operator*(S&& scl, LRefConstEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(right.w_* scl)>>{right.w_* scl}))
+		EUCVECTORINLINE static constexpr auto operator*(S&& scl, LRefConstEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(right.w_* scl)>>{right.w_* scl}))
 		->decltype(Packer<meta::no_ref<decltype(right.w_* scl)>>{right.w_* scl}) {
 		return { right.x_ * scl,  right.y_ * scl, right.z_ * scl, right.w_ * scl };
 	}
 
 	template<class S>
 	friend EUCNODISCARD_MSG("The result of the multiplication is being ignored.If you intend to modify the lvalue, please use [*=] instead.")
-		EUCVECTORINLINE static auto operator*(S&& scl, RRefEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(right.w_)* scl)>>{_STD move(right.w_)* scl}))
+		EUCVECTORINLINE static constexpr auto operator*(S&& scl, RRefEucVector right) noexcept(noexcept(Packer<meta::no_ref<decltype(_STD move(right.w_)* scl)>>{_STD move(right.w_)* scl}))
 		->decltype(Packer<meta::no_ref<decltype(_STD move(right.w_)* scl)>>{_STD move(right.w_)* scl}) {
 		return { _STD move(right.x_) * scl, _STD move(right.y_) * scl, _STD move(right.z_) * scl, _STD move(right.w_) * scl };
 	}
 
 	template<class S>
 	EUCNODISCARD_MSG("The result of the division is being ignored.If you intend to modify the lvalue, please use [/=] instead.")
-		EUCVECTORINLINE auto operator/(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ / scl)>>{w_ / scl}))
+		EUCVECTORINLINE constexpr auto operator/(S&& scl) const noexcept(noexcept(Packer<meta::no_ref<decltype(w_ / scl)>>{w_ / scl}))
 		->decltype(Packer<meta::no_ref<decltype(w_ / scl)>>{w_ / scl}) {
 		return { x_ / scl, y_ / scl,  z_ / scl, w_ / scl };
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(const EuclideanCmplVector4<T>& right) const noexcept(noexcept(bool(w_ == right.w_)))
+		EUCVECTORINLINE constexpr auto operator==(const EuclideanCmplVector4<T>& right) const noexcept(noexcept(bool(w_ == right.w_)))
 		-> meta::no_ref<decltype(bool(w_ == right.w_))> {
 		return (x_ == right.x_) && (y_ == right.y_) && (z_ == right.z_) && (w_ == right.w_);
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(EuclideanCmplVector4<T>&& right) const noexcept(noexcept(bool(w_ == _STD move(right.w_))))
+		EUCVECTORINLINE constexpr auto operator==(EuclideanCmplVector4<T>&& right) const noexcept(noexcept(bool(w_ == _STD move(right.w_))))
 		-> meta::no_ref<decltype(bool(w_ == _STD move(right.w_)))> {
 		return (x_ == _STD move(right.x_)) && (y_ == _STD move(right.y_)) && (z_ == _STD move(right.z_)) && (w_ == _STD move(right.w_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator==(RRefPacker<T> right) const noexcept(noexcept(bool(w_ == _STD move(right.x))))
+		EUCVECTORINLINE constexpr auto operator==(RRefPacker<T> right) const noexcept(noexcept(bool(w_ == _STD move(right.x))))
 		-> meta::no_ref<decltype(bool(w_ == _STD move(right.x)))> {
 		return (x_ == _STD move(right.x)) && (y_ == _STD move(right.y)) && (z_ == _STD move(right.z)) && (w_ == _STD move(right.w));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator==(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.w_ == _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator==(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.w_ == _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(right.w_ == _STD move(left.x)))> {
 		return (right.x_ == _STD move(left.x)) && (right.y_ == _STD move(left.y)) && (right.z_ == _STD move(left.z)) && (right.w_ == _STD move(left.w));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator==(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.w_) == _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator==(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.w_) == _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(_STD move(right.w_) == _STD move(left.x)))> {
 		return (_STD move(right.x_) == _STD move(left.x)) && (_STD move(right.y_) == _STD move(left.y)) && (_STD move(right.z_) == _STD move(left.z)) && (_STD move(right.w_) == _STD move(left.w));
 	}
 
+#if defined(THL_EUC_CONCEPTS)
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr bool operator!=(const EuclideanCmplVector4<T>& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, const T&>)
+		requires meta::not_equal_comparable<LRefConstElemType, const T&> {
+		return detail::euc_not_equal(x_, right.x_) || detail::euc_not_equal(y_, right.y_) || detail::euc_not_equal(z_, right.z_) || detail::euc_not_equal(w_, right.w_);
+	}
+
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(const EuclideanCmplVector4<T>& right) const noexcept(noexcept(bool(w_ != right.w_)))
+		EUCVECTORINLINE constexpr bool operator!=(EuclideanCmplVector4<T>&& right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(x_, _STD move(right.x_)) || detail::euc_not_equal(y_, _STD move(right.y_)) || detail::euc_not_equal(z_, _STD move(right.z_)) || detail::euc_not_equal(w_, _STD move(right.w_));
+	}
+
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr bool operator!=(RRefPacker<T> right) const noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(x_, _STD move(right.x)) || detail::euc_not_equal(y_, _STD move(right.y)) || detail::euc_not_equal(z_, _STD move(right.z)) || detail::euc_not_equal(w_, _STD move(right.w));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static constexpr bool operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(meta::is_nothrow_not_equal_v<LRefConstElemType, T>)
+		requires meta::not_equal_comparable<LRefConstElemType, T> {
+		return detail::euc_not_equal(right.x_, _STD move(left.x)) || detail::euc_not_equal(right.y_, _STD move(left.y)) || detail::euc_not_equal(right.z_, _STD move(left.z)) || detail::euc_not_equal(right.w_, _STD move(left.w));
+	}
+
+	template<class T>
+	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE static constexpr bool operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(meta::is_nothrow_not_equal_v<ElemType, T>)
+		requires meta::not_equal_comparable<ElemType, T> {
+		return detail::euc_not_equal(_STD move(right.x_), _STD move(left.x)) || detail::euc_not_equal(_STD move(right.y_), _STD move(left.y)) || detail::euc_not_equal(_STD move(right.z_), _STD move(left.z)) || detail::euc_not_equal(_STD move(right.w_), _STD move(left.w));
+	}
+#else
+	template<class T>
+	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
+		EUCVECTORINLINE constexpr auto operator!=(const EuclideanCmplVector4<T>& right) const noexcept(noexcept(bool(w_ != right.w_)))
 		-> meta::no_ref<decltype(bool(w_ != right.w_))> {
 		return (x_ != right.x_) || (y_ != right.y_) || (z_ != right.z_) || (w_ != right.w_);
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(EuclideanCmplVector4<T>&& right) const noexcept(noexcept(bool(w_ != _STD move(right.w_))))
+		EUCVECTORINLINE constexpr auto operator!=(EuclideanCmplVector4<T>&& right) const noexcept(noexcept(bool(w_ != _STD move(right.w_))))
 		-> meta::no_ref<decltype(bool(w_ != _STD move(right.w_)))> {
 		return (x_ != _STD move(right.x_)) || (y_ != _STD move(right.y_)) || (z_ != _STD move(right.z_)) || (w_ != _STD move(right.w_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(w_ != _STD move(right.x))))
+		EUCVECTORINLINE constexpr auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(w_ != _STD move(right.x))))
 		-> meta::no_ref<decltype(bool(w_ != _STD move(right.x)), _STD declval<bool>())> {
 		return (x_ != _STD move(right.x)) || (y_ != _STD move(right.y)) || (z_ != _STD move(right.z)) || (w_ != _STD move(right.w));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.w_ != _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(right.w_ != _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(right.w_ != _STD move(left.x)), _STD declval<bool>())> {
 		return (right.x_ != _STD move(left.x)) || (right.y_ != _STD move(left.y)) || (right.z_ != _STD move(left.z)) || (right.w_ != _STD move(left.w));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.w_) != _STD move(left.x))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(_STD move(right.w_) != _STD move(left.x))))
 		-> meta::no_ref<decltype(bool(_STD move(right.w_) != _STD move(left.x)), _STD declval<bool>())> {
 		return (_STD move(right.x_) != _STD move(left.x)) || (_STD move(right.y_) != _STD move(left.y)) || (_STD move(right.z_) != _STD move(left.z)) || (_STD move(right.w_) != _STD move(left.w));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(const EuclideanCmplVector4<T>& right) const noexcept(noexcept(bool(!(w_ == right.w_))))
+		EUCVECTORINLINE constexpr auto operator!=(const EuclideanCmplVector4<T>& right) const noexcept(noexcept(bool(!(w_ == right.w_))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(right)>>(), bool(!(w_ == right.w_)), _STD declval<bool>())> {
 		return (!(x_ == right.x_)) || (!(y_ == right.y_)) || (!(z_ == right.z_)) || (!(w_ == right.w_));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(EuclideanCmplVector4<T>&& right) const noexcept(noexcept(bool(!(w_ == _STD move(right.w_)))))
+		EUCVECTORINLINE constexpr auto operator!=(EuclideanCmplVector4<T>&& right) const noexcept(noexcept(bool(!(w_ == _STD move(right.w_)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), bool(!(w_ == _STD move(right.w_))), _STD declval<bool>())> {
 		return (!(x_ == _STD move(right.x_))) || (!(y_ == _STD move(right.y_))) || (!(z_ == _STD move(right.z_))) || (!(w_ == _STD move(right.w_)));
 	}
 
 	template<class T>
 	EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(!(w_ == _STD move(right.x)))))
+		EUCVECTORINLINE constexpr auto operator!=(RRefPacker<T> right) const noexcept(noexcept(bool(!(w_ == _STD move(right.x)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(*this), decltype(_STD move(right))>>(), bool(!(w_ == _STD move(right.x))), _STD declval<bool>())> {
 		return (!(x_ == _STD move(right.x))) || (!(y_ == _STD move(right.y))) || (!(z_ == _STD move(right.z))) || (!(w_ == _STD move(right.w)));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(!(right.w_ == _STD move(left.x)))))
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, LRefConstEucVector right) noexcept(noexcept(bool(!(right.w_ == _STD move(left.x)))))
 		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(right)>>(), bool(!(right.w_ == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(right.x_ == _STD move(left.x))) || (!(right.y_ == _STD move(left.y))) || (!(right.z_ == _STD move(left.z))) || (!(right.w_ == _STD move(left.w)));
 	}
 
 	template<class T>
 	friend EUCNODISCARD_MSG("The return value of the comparison operator is being ignored")
-		EUCVECTORINLINE static auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.x) == _STD move(left.x)))))
-		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.w_)) == _STD move(left.x)), _STD declval<bool>())> {
+		EUCVECTORINLINE static constexpr auto operator!=(RRefPacker<T> left, RRefEucVector right) noexcept(noexcept(bool(!(_STD move(right.w_) == _STD move(left.x)))))
+		-> meta::no_ref<decltype(meta::when_true<!meta::is_invoke_not_equal_v<decltype(_STD move(left)), decltype(_STD move(right))>>(), bool(!(_STD move(right.w_) == _STD move(left.x))), _STD declval<bool>())> {
 		return (!(_STD move(right.x_) == _STD move(left.x))) || (!(_STD move(right.y_) == _STD move(left.y))) || (!(_STD move(right.z_) == _STD move(left.z))) || (!(_STD move(right.w_) == _STD move(left.w)));
 	}
+#endif
 	/*
 		Unary Operators.
 	*/
-	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector4<ElemType>& operator+() noexcept {
+	EUCNODISCARD EUCVECTORINLINE constexpr EuclideanCmplVector4<ElemType>& operator+() noexcept {
 		return *this;
 	}
-	EUCNODISCARD EUCVECTORINLINE const EuclideanCmplVector4<ElemType>& operator+() const noexcept {
+	EUCNODISCARD EUCVECTORINLINE constexpr const EuclideanCmplVector4<ElemType>& operator+() const noexcept {
 		return *this;
 	}
 
 	template<class T = ElemType>
-	EUCNODISCARD EUCVECTORINLINE auto operator-() const noexcept(noexcept(EuclideanCmplVector4<T>() * -1))
+	EUCNODISCARD EUCVECTORINLINE constexpr auto operator-() const noexcept(noexcept(EuclideanCmplVector4<T>() * -1))
 		->decltype(EuclideanCmplVector4<T>() * -1) {
 		return { x_ * -1, y_ * -1,  z_ * -1, w_ * -1 };
 	}
@@ -5431,7 +6253,7 @@ public:
 		Assignment Operators.
 	*/
 	template<class T>
-	EUCVECTORINLINE auto operator=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ = vector.w_))
+	EUCVECTORINLINE constexpr auto operator=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ = vector.w_))
 		-> decltype(w_ = vector.w_, _STD declval<LRefEucVector>()) {
 		x_ = vector.x_;
 		y_ = vector.y_;
@@ -5441,7 +6263,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ = _STD move(vector.w_)))
+	EUCVECTORINLINE constexpr auto operator=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ = _STD move(vector.w_)))
 		-> decltype(w_ = _STD move(vector.w_), _STD declval<LRefEucVector>()) {
 		x_ = _STD move(vector.x_);
 		y_ = _STD move(vector.y_);
@@ -5451,7 +6273,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator=(RRefPacker<T> pack) & noexcept(noexcept(w_ = _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator=(RRefPacker<T> pack) & noexcept(noexcept(w_ = _STD move(pack.x)))
 		-> decltype(w_ = _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = _STD move(pack.x);
 		y_ = _STD move(pack.y);
@@ -5460,8 +6282,89 @@ public:
 		return *this;
 	}
 
+#if defined(THL_EUC_CONCEPTS)
 	template<class T>
-	EUCVECTORINLINE auto operator+=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ += vector.w_))
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(const EuclideanCmplVector4<T>& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, const T&>)
+		requires meta::add_assignable<ElemType, const T&> {
+		detail::euc_add_assign(x_, vector.x_);
+		detail::euc_add_assign(y_, vector.y_);
+		detail::euc_add_assign(z_, vector.z_);
+		detail::euc_add_assign(w_, vector.w_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(EuclideanCmplVector4<T>&& vector) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(x_, _STD move(vector.x_));
+		detail::euc_add_assign(y_, _STD move(vector.y_));
+		detail::euc_add_assign(z_, _STD move(vector.z_));
+		detail::euc_add_assign(w_, _STD move(vector.w_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator+=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_add_assign_v<ElemType, T>)
+		requires meta::add_assignable<ElemType, T> {
+		detail::euc_add_assign(x_, _STD move(pack.x));
+		detail::euc_add_assign(y_, _STD move(pack.y));
+		detail::euc_add_assign(z_, _STD move(pack.z));
+		detail::euc_add_assign(w_, _STD move(pack.w));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(const EuclideanCmplVector4<T>& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, const T&>)
+		requires meta::sub_assignable<ElemType, const T&> {
+		detail::euc_sub_assign(x_, vector.x_);
+		detail::euc_sub_assign(y_, vector.y_);
+		detail::euc_sub_assign(z_, vector.z_);
+		detail::euc_sub_assign(w_, vector.w_);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(EuclideanCmplVector4<T>&& vector) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(x_, _STD move(vector.x_));
+		detail::euc_sub_assign(y_, _STD move(vector.y_));
+		detail::euc_sub_assign(z_, _STD move(vector.z_));
+		detail::euc_sub_assign(w_, _STD move(vector.w_));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator-=(RRefPacker<T> pack) & noexcept(meta::is_nothrow_sub_assign_v<ElemType, T>)
+		requires meta::sub_assignable<ElemType, T> {
+		detail::euc_sub_assign(x_, _STD move(pack.x));
+		detail::euc_sub_assign(y_, _STD move(pack.y));
+		detail::euc_sub_assign(z_, _STD move(pack.z));
+		detail::euc_sub_assign(w_, _STD move(pack.w));
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator*=(T&& scl) & noexcept(meta::is_nothrow_mul_assign_v<ElemType, T&>)
+		requires meta::mul_assignable<ElemType, T&> {
+		detail::euc_mul_assign(x_, scl);
+		detail::euc_mul_assign(y_, scl);
+		detail::euc_mul_assign(z_, scl);
+		detail::euc_mul_assign(w_, scl);
+		return *this;
+	}
+
+	template<class T>
+	EUCVECTORINLINE constexpr LRefEucVector operator/=(T&& scl) & noexcept(meta::is_nothrow_div_assign_v<ElemType, T&>)
+		requires meta::div_assignable<ElemType, T&> {
+		detail::euc_div_assign(x_, scl);
+		detail::euc_div_assign(y_, scl);
+		detail::euc_div_assign(z_, scl);
+		detail::euc_div_assign(w_, scl);
+		return *this;
+	}
+#else
+	template<class T>
+	EUCVECTORINLINE constexpr auto operator+=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ += vector.w_))
 		-> decltype(w_ += vector.w_, _STD declval<LRefEucVector>()) {
 		x_ += vector.x_;
 		y_ += vector.y_;
@@ -5471,7 +6374,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ += _STD move(vector.w_)))
+	EUCVECTORINLINE constexpr auto operator+=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ += _STD move(vector.w_)))
 		-> decltype(w_ += _STD move(vector.w_), _STD declval<LRefEucVector>()) {
 		x_ += _STD move(vector.x_);
 		y_ += _STD move(vector.y_);
@@ -5481,7 +6384,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(w_ += _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(w_ += _STD move(pack.x)))
 		-> decltype(w_ += _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ += _STD move(pack.x);
 		y_ += _STD move(pack.y);
@@ -5491,7 +6394,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ = w_ + vector.w_))
+	EUCVECTORINLINE constexpr auto operator+=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ = w_ + vector.w_))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(vector)>>, w_ = w_ + vector.w_, _STD declval<LRefEucVector>()) {
 		x_ = x_ + vector.x_;
 		y_ = y_ + vector.y_;
@@ -5501,7 +6404,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ = w_ + _STD move(vector.w_)))
+	EUCVECTORINLINE constexpr auto operator+=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ = w_ + _STD move(vector.w_)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(vector))>>, w_ = w_ + _STD move(vector.w_), _STD declval<LRefEucVector>()) {
 		x_ = x_ + _STD move(vector.x_);
 		y_ = y_ + _STD move(vector.y_);
@@ -5511,7 +6414,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(w_ = w_ + _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator+=(RRefPacker<T> pack) & noexcept(noexcept(w_ = w_ + _STD move(pack.x)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(pack))>>, w_ = w_ + _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = x_ + _STD move(pack.x);
 		y_ = y_ + _STD move(pack.y);
@@ -5521,7 +6424,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ -= vector.w_))
+	EUCVECTORINLINE constexpr auto operator-=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ -= vector.w_))
 		-> decltype(w_ -= vector.w_, _STD declval<LRefEucVector>()) {
 		x_ -= vector.x_;
 		y_ -= vector.y_;
@@ -5531,7 +6434,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ -= _STD move(vector.w_)))
+	EUCVECTORINLINE constexpr auto operator-=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ -= _STD move(vector.w_)))
 		-> decltype(w_ -= _STD move(vector.w_), _STD declval<LRefEucVector>()) {
 		x_ -= _STD move(vector.x_);
 		y_ -= _STD move(vector.y_);
@@ -5541,7 +6444,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(w_ -= _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(w_ -= _STD move(pack.x)))
 		-> decltype(w_ -= _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ -= _STD move(pack.x);
 		y_ -= _STD move(pack.y);
@@ -5551,7 +6454,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ = w_ - vector.w_))
+	EUCVECTORINLINE constexpr auto operator-=(const EuclideanCmplVector4<T>& vector) & noexcept(noexcept(w_ = w_ - vector.w_))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(vector)>>, w_ = w_ - vector.w_, _STD declval<LRefEucVector>()) {
 		x_ = x_ - vector.x_;
 		y_ = y_ - vector.y_;
@@ -5561,7 +6464,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ = w_ - _STD move(vector.w_)))
+	EUCVECTORINLINE constexpr auto operator-=(EuclideanCmplVector4<T>&& vector) & noexcept(noexcept(w_ = w_ - _STD move(vector.w_)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(vector))>>, w_ = w_ - _STD move(vector.w_), _STD declval<LRefEucVector>()) {
 		x_ = x_ - _STD move(vector.x_);
 		y_ = y_ - _STD move(vector.y_);
@@ -5571,7 +6474,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(w_ = w_ - _STD move(pack.x)))
+	EUCVECTORINLINE constexpr auto operator-=(RRefPacker<T> pack) & noexcept(noexcept(w_ = w_ - _STD move(pack.x)))
 		-> decltype(meta::when_true<!meta::is_invoke_add_equal_v<decltype(*this), decltype(_STD move(pack))>>, w_ = w_ - _STD move(pack.x), _STD declval<LRefEucVector>()) {
 		x_ = x_ - _STD move(pack.x);
 		y_ = y_ - _STD move(pack.y);
@@ -5582,7 +6485,7 @@ public:
 
 
 	template<class T>
-	EUCVECTORINLINE auto operator*=(T&& scl) & noexcept(noexcept(w_ *= scl))
+	EUCVECTORINLINE constexpr auto operator*=(T&& scl) & noexcept(noexcept(w_ *= scl))
 		-> decltype(w_ *= scl, _STD declval<LRefEucVector>()) {
 		x_ *= scl;
 		y_ *= scl;
@@ -5592,7 +6495,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator*=(T&& scl) & noexcept(noexcept(w_ = w_ * scl))
+	EUCVECTORINLINE constexpr auto operator*=(T&& scl) & noexcept(noexcept(w_ = w_ * scl))
 		-> decltype(meta::when_true<!meta::is_invoke_mul_equal_v<decltype(*this), decltype(scl)>>, w_ = w_ * scl, _STD declval<LRefEucVector>()) {
 		x_ = x_ * scl;
 		y_ = y_ * scl;
@@ -5602,7 +6505,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator/=(T&& scl) & noexcept(noexcept(w_ /= scl))
+	EUCVECTORINLINE constexpr auto operator/=(T&& scl) & noexcept(noexcept(w_ /= scl))
 		-> decltype(w_ /= scl, _STD declval<LRefEucVector>()) {
 		x_ /= scl;
 		y_ /= scl;
@@ -5612,7 +6515,7 @@ public:
 	}
 
 	template<class T>
-	EUCVECTORINLINE auto operator/=(T&& scl) & noexcept(noexcept(w_ = w_ / scl))
+	EUCVECTORINLINE constexpr auto operator/=(T&& scl) & noexcept(noexcept(w_ = w_ / scl))
 		-> decltype(meta::when_true<!meta::is_invoke_div_equal_v<decltype(*this), decltype(scl)>>, w_ = w_ / scl, _STD declval<LRefEucVector>()) {
 		x_ = x_ / scl;
 		y_ = y_ / scl;
@@ -5620,6 +6523,7 @@ public:
 		w_ = w_ / scl;
 		return *this;
 	}
+#endif
 
 	/*
 		Client Function.
@@ -6424,7 +7328,7 @@ public:
 
 	*/
 	template<class T = ElemType>
-	EUCVECTORINLINE auto zero_self() noexcept(noexcept(_STD declval<_STD add_lvalue_reference_t<T>>() = 0))
+	EUCVECTORINLINE constexpr auto zero_self() noexcept(noexcept(_STD declval<_STD add_lvalue_reference_t<T>>() = 0))
 		-> meta::is_type_t<decltype(_STD declval<_STD add_lvalue_reference_t<T>>() = 0), void> {
 		x_ = 0;
 		y_ = 0;
@@ -6440,7 +7344,7 @@ public:
 
 	*/
 	template<class X, class Y, class Z, class W>
-	EUCVECTORINLINE auto set(X&& x, Y&& y, Z&& z, W&& w) noexcept(noexcept(x_ = _STD forward<X>(x)) && noexcept(y_ = _STD forward<Y>(y)) && noexcept(z_ = _STD forward<Z>(z)) && noexcept(w_ = _STD forward<W>(w)))
+	EUCVECTORINLINE constexpr auto set(X&& x, Y&& y, Z&& z, W&& w) noexcept(noexcept(x_ = _STD forward<X>(x)) && noexcept(y_ = _STD forward<Y>(y)) && noexcept(z_ = _STD forward<Z>(z)) && noexcept(w_ = _STD forward<W>(w)))
 		-> meta::is_type_t<decltype(x_ = _STD forward<X>(x), y_ = _STD forward<Y>(y), z_ = _STD forward<Z>(z), z_ = _STD forward<W>(w)), void> {
 		x_ = _STD forward<X>(x);
 		y_ = _STD forward<Y>(y);
@@ -6457,20 +7361,23 @@ public:
 	*/
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(const EuclideanCmplVector4<T>& vector) const noexcept(noexcept(x_* vector.x_ + x_ * vector.x_ + x_ * vector.x_ + x_ * vector.x_))
+		EUCVECTORINLINE constexpr auto dot(const EuclideanCmplVector4<T>& vector) const noexcept(noexcept(x_* vector.x_ + x_ * vector.x_ + x_ * vector.x_ + x_ * vector.x_))
 		-> decltype(x_* vector.x_ + x_ * vector.x_ + x_ * vector.x_ + x_ * vector.x_) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * vector.x_ + y_ * vector.y_ + z_ * vector.z_ + w_ * vector.w_;
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(EuclideanCmplVector4<T>&& vector) const noexcept(noexcept(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_)))
+		EUCVECTORINLINE constexpr auto dot(EuclideanCmplVector4<T>&& vector) const noexcept(noexcept(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_)))
 		-> decltype(x_* _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_) + x_ * _STD move(vector.x_)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(vector.x_) + y_ * _STD move(vector.y_) + z_ * _STD move(vector.z_) + w_ * _STD move(vector.w_);
 	}
 	template<class T>
 	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto dot(RRefPacker<T> pack) const noexcept(noexcept(x_* _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x)))
+		EUCVECTORINLINE constexpr auto dot(RRefPacker<T> pack) const noexcept(noexcept(x_* _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x)))
 		-> decltype(x_* _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x) + x_ * _STD move(pack.x)) {
+		EUCINSTRUMENT(dot, EucD);
 		return x_ * _STD move(pack.x) + y_ * _STD move(pack.y) + z_ * _STD move(pack.z) + w_ * _STD move(pack.w);
 	}
 	/*
@@ -6483,8 +7390,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
+		EUCVECTORINLINE constexpr auto eucnorm_squared() const noexcept(noexcept(dot(_STD declval<LRefEucVector>())))
 		-> decltype(dot(_STD declval<LRefEucVector>())) {
+		EUCINSTRUMENT(eucnorm_squared, EucD);
 		return x_ * x_ + y_ * y_ + z_ * z_ + w_ * w_;
 	}
 	/*
@@ -6497,9 +7405,10 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
-		EUCVECTORINLINE auto eucnorm() const noexcept(noexcept(_STD sqrt(eucnorm_squared<T>())))
-		-> decltype(_STD sqrt(eucnorm_squared<T>())) {
-		return _STD sqrt(x_ * x_ + y_ * y_ + z_ * z_ + w_ * w_);
+		EUCVECTORINLINE constexpr auto eucnorm() const noexcept(noexcept(detail::euc_sqrt(eucnorm_squared<T>())))
+		-> decltype(detail::euc_sqrt(eucnorm_squared<T>())) {
+		EUCINSTRUMENT(eucnorm, EucD);
+		return detail::euc_sqrt(x_ * x_ + y_ * y_ + z_ * z_ + w_ * w_);
 	}
 	/*
 		@brief
@@ -6509,8 +7418,9 @@ public:
 	*/
 	template<class T = ElemType>
 	EUCNODISCARD_MSG("The result of the normalization calculation was ignored. If you actually want to normalize this vector, use [normalize_self].")
-		EUCVECTORINLINE auto normalize() const noexcept(noexcept(Packer<T>{w_ / eucnorm<T>()}))
+		EUCVECTORINLINE constexpr auto normalize() const noexcept(noexcept(Packer<T>{w_ / eucnorm<T>()}))
 		->decltype(Packer<T>{w_ / eucnorm<T>()}) {
+		EUCINSTRUMENT(normalize, EucD);
 		auto&& norm = eucnorm<T>();
 		return { x_ / norm, y_ / norm, z_ / norm, w_ / norm };
 	}
@@ -6521,8 +7431,9 @@ public:
 
 	*/
 	template<class T = ElemType>
-	EUCVECTORINLINE auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
+	EUCVECTORINLINE constexpr auto normalize_self() noexcept(noexcept(_STD declval<LRefEucVector>() /= eucnorm<T>()))
 		-> decltype(_STD declval<LRefEucVector>() /= eucnorm<T>()) {
+		EUCINSTRUMENT(normalize_self, EucD);
 		return *this /= eucnorm<T>();
 	}
 
@@ -6662,6 +7573,13 @@ using EucCmplDoubleVector2 = EuclideanCmplVector2<double>;
 using EucCmplDoubleVector3 = EuclideanCmplVector3<double>;
 using EucCmplDoubleVector4 = EuclideanCmplVector4<double>;
 
+/*
+	Cmpl vectors are literal types: construction and the packer round trip work in constant expressions.
+*/
+static_assert(EucCmplIntVector2(EucCmplIntVector2(1, 2) + EucCmplIntVector2(3, 4)).y_ == 6);
+static_assert(EucCmplIntVector3(EucCmplIntVector3(1, 2, 3) + EucCmplIntVector3(3, 4, 5)).z_ == 8);
+static_assert(EucCmplIntVector4(EucCmplIntVector4(1, 2, 3, 4) + EucCmplIntVector4(3, 4, 5, 6)).w_ == 10);
+
 //name space end.
 };
 
@@ -0,0 +1,287 @@
+//
+//	EuclideanVector Arena
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Frame arena for short-lived vector buffers.
+//
+//	EucFrameArena is a monotonic std::pmr::memory_resource.
+//	Allocation is a pointer bump, deallocation does nothing, and reset() rewinds to the first block in O(1)
+//	while keeping every block for the next frame. After the first few frames, temporary buffers make no allocator calls.
+//	Every allocation is aligned to at least 64 bytes, so SIMD kernels can use aligned loads on the returned storage.
+//
+//	It can be used in two ways:
+//		std::pmr::vector<EuclideanCmplVector3<float>> v(&arena);		(polymorphic)
+//		EucArenaVector<EuclideanCmplVector3<float>> v(arena);			(EucArenaAllocator, no virtual call)
+//	Both work with the container-taking batch APIs, such as parse_vectors.
+//
+//	The arena is not thread-safe; use one arena per thread.
+//.
+
+#ifndef THL_EUCLID_VECTOR_ARENA_HPP
+#define THL_EUCLID_VECTOR_ARENA_HPP
+
+#include "EuclideanVector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Monotonic frame arena.
+*/
+class EucFrameArena final
+	: public _STD pmr::memory_resource {
+public:
+
+	static constexpr size_t DefaultAlignment = 64;
+	static constexpr size_t DefaultBlockSize = size_t(1) << 20;
+
+	/*
+		Rewind point returned by mark().
+	*/
+	struct Marker {
+		void* block;
+		size_t offset;
+		size_t consumed;
+	};
+
+protected:
+
+	struct Block {
+		Block* next;
+		size_t size;	// usable bytes after the header.
+	};
+
+	static constexpr size_t HeaderSize = (sizeof(Block) + DefaultAlignment - 1) / DefaultAlignment * DefaultAlignment;
+
+	_STD pmr::memory_resource* upstream_;
+	size_t min_align_;
+	size_t next_block_size_;
+	Block* head_;
+	Block* tail_;
+	Block* current_;
+	size_t offset_;
+	size_t consumed_;	// usable bytes of the blocks before current_.
+	size_t capacity_;
+	size_t allocations_;
+	size_t peak_;
+
+	EUCNODISCARD static EUCVECTORINLINE unsigned char* block_data(Block* block) noexcept {
+		return reinterpret_cast<unsigned char*>(block) + HeaderSize;
+	}
+
+	EUCVECTORINLINE Block* append_block(size_t min_size) {
+		size_t size = next_block_size_;
+		while (size < min_size) size *= 2;
+		void* raw = upstream_->allocate(HeaderSize + size, DefaultAlignment);
+		Block* block = ::new (raw) Block{ nullptr, size };
+		next_block_size_ = size * 2;
+		capacity_ += size;
+
+		if (tail_) tail_->next = block;
+		else head_ = block;
+		tail_ = block;
+		return block;
+	}
+
+	void* do_allocate(size_t bytes, size_t alignment) override {
+		if (alignment < min_align_) alignment = min_align_;
+		++allocations_;
+
+		for (;;) {
+			if (current_) {
+				const uintptr_t base = reinterpret_cast<uintptr_t>(block_data(current_));
+				const uintptr_t at = (base + offset_ + alignment - 1) & ~uintptr_t(alignment - 1);
+				const size_t end = static_cast<size_t>(at - base) + bytes;
+				if (end <= current_->size) {
+					offset_ = end;
+					if (consumed_ + offset_ > peak_) peak_ = consumed_ + offset_;
+					return reinterpret_cast<void*>(at);
+				}
+				// Reuse blocks kept from previous frames before asking upstream.
+				if (!current_->next) append_block(bytes + alignment);
+				consumed_ += current_->size;
+				current_ = current_->next;
+			}
+			else {
+				current_ = head_ ? head_ : append_block(bytes + alignment);
+			}
+			offset_ = 0;
+		}
+	}
+
+	void do_deallocate(void*, size_t, size_t) override {}
+
+	EUCNODISCARD bool do_is_equal(const _STD pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+
+public:
+
+	/*
+		Constructors.
+	*/
+	explicit EucFrameArena(size_t block_size = DefaultBlockSize, size_t min_alignment = DefaultAlignment,
+		_STD pmr::memory_resource* upstream = _STD pmr::new_delete_resource()) noexcept
+		: upstream_(upstream)
+		, min_align_(min_alignment < alignof(_STD max_align_t) ? alignof(_STD max_align_t) : min_alignment)
+		, next_block_size_(block_size == 0 ? DefaultBlockSize : block_size)
+		, head_(nullptr)
+		, tail_(nullptr)
+		, current_(nullptr)
+		, offset_(0)
+		, consumed_(0)
+		, capacity_(0)
+		, allocations_(0)
+		, peak_(0)
+	{}
+
+	EucFrameArena(const EucFrameArena&) = delete;
+	EucFrameArena& operator=(const EucFrameArena&) = delete;
+
+	~EucFrameArena() override {
+		release();
+	}
+
+	/*
+		@brief
+			Make every allocation of this frame reusable. Blocks are kept. O(1).
+			Storage handed out before the reset must not be used afterwards.
+	*/
+	EUCVECTORINLINE void reset() noexcept {
+		current_ = head_;
+		offset_ = 0;
+		consumed_ = 0;
+		allocations_ = 0;
+	}
+
+	/*
+		@brief
+			Return every block to the upstream resource.
+	*/
+	EUCVECTORINLINE void release() noexcept {
+		for (Block* b = head_; b;) {
+			Block* next = b->next;
+			upstream_->deallocate(b, HeaderSize + b->size, DefaultAlignment);
+			b = next;
+		}
+		head_ = tail_ = current_ = nullptr;
+		offset_ = 0;
+		consumed_ = 0;
+		capacity_ = 0;
+		allocations_ = 0;
+	}
+
+	/*
+		@brief
+			Pre-allocate so that the next frame of up to bytes makes no upstream call.
+	*/
+	EUCVECTORINLINE void reserve(size_t bytes) {
+		if (capacity_ >= bytes) return;
+		append_block(bytes - capacity_);
+		if (!current_) current_ = head_;
+	}
+
+	/*
+		@brief
+			Save the current position, for scoped temporaries inside a frame.
+	*/
+	EUCNODISCARD_MSG("The marker was ignored. rewind() needs it.")
+		EUCVECTORINLINE Marker mark() const noexcept { return { current_, offset_, consumed_ }; }
+
+	/*
+		@brief
+			Rewind to a position obtained by mark(). Storage allocated after the mark becomes reusable.
+	*/
+	EUCVECTORINLINE void rewind(const Marker& marker) noexcept {
+		current_ = marker.block ? static_cast<Block*>(marker.block) : head_;
+		offset_ = marker.offset;
+		consumed_ = marker.consumed;
+	}
+
+	/*
+		@brief
+			Allocate uninitialized storage for count objects of T.
+	*/
+	template<class T>
+	EUCNODISCARD_MSG("The allocated storage was ignored. It will stay unused until reset().")
+		EUCVECTORINLINE T* allocate_array(size_t count) {
+		return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	// Bytes held from upstream.
+	EUCNODISCARD EUCVECTORINLINE size_t capacity() const noexcept { return capacity_; }
+	// Bytes handed out in this frame, including alignment padding.
+	EUCNODISCARD EUCVECTORINLINE size_t used() const noexcept { return consumed_ + offset_; }
+	// Highest used() since construction.
+	EUCNODISCARD EUCVECTORINLINE size_t peak() const noexcept { return peak_; }
+	// Allocations served in this frame.
+	EUCNODISCARD EUCVECTORINLINE size_t allocations() const noexcept { return allocations_; }
+	EUCNODISCARD EUCVECTORINLINE size_t min_alignment() const noexcept { return min_align_; }
+};
+
+/*
+	Allocator bound to an EucFrameArena, without the virtual dispatch of std::pmr.
+*/
+template<class T>
+class EucArenaAllocator {
+protected:
+
+	template<class U>
+	friend class EucArenaAllocator;
+
+	EucFrameArena* arena_;
+
+public:
+
+	using value_type = T;
+
+	template<class U>
+	struct rebind {
+		using other = EucArenaAllocator<U>;
+	};
+
+	EucArenaAllocator(EucFrameArena& arena) noexcept
+		: arena_(&arena)
+	{}
+
+	template<class U>
+	EucArenaAllocator(const EucArenaAllocator<U>& other) noexcept
+		: arena_(other.arena_)
+	{}
+
+	EUCNODISCARD EUCVECTORINLINE T* allocate(size_t count) {
+		return arena_->allocate_array<T>(count);
+	}
+
+	EUCVECTORINLINE void deallocate(T*, size_t) noexcept {}
+
+	EUCNODISCARD EUCVECTORINLINE EucFrameArena& arena() const noexcept { return *arena_; }
+
+	template<class U>
+	EUCNODISCARD EUCVECTORINLINE bool operator==(const EucArenaAllocator<U>& other) const noexcept { return arena_ == other.arena_; }
+	template<class U>
+	EUCNODISCARD EUCVECTORINLINE bool operator!=(const EucArenaAllocator<U>& other) const noexcept { return arena_ != other.arena_; }
+};
+
+/*
+	Arena Container.
+*/
+template<class V>
+using EucArenaVector = _STD vector<V, EucArenaAllocator<V>>;
+
+template<class V>
+using EucPmrVector = _STD pmr::vector<V>;
+
+//name space end.
+}
+
+#endif
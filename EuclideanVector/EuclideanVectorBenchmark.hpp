@@ -0,0 +1,515 @@
+//
+//	EuclideanVector Benchmark
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Microbenchmark harness that reads hardware counters alongside wall time.
+//
+//	On Linux, EucPerfCounters opens one perf_event_open counter per event: cycles, instructions, cache misses,
+//	branch misses, and packed floating-point instructions (raw event, Intel and AMD Zen only).
+//	Counters exclude the kernel, follow threads spawned inside the measured region, and are scaled when the PMU multiplexes.
+//	If an event cannot be opened (other OS, container, perf_event_paranoid, virtual machine), that column reports n/a,
+//	and the rest of the measurement still runs.
+//
+//	EucBenchmark::run() calibrates a repeat count for every kernel, keeps the fastest of several repetitions,
+//	and stores per-operation values: ns/op, cycles/op, instructions/op, IPC, cache and branch misses/op,
+//	vector instructions/op and bytes/op.
+//	Results can be written as CSV and checked against a stored baseline with euc_bench_compare(). The check uses
+//	counter data where available, because instruction and miss counts are far steadier than timings.
+//
+//	euc_bench_vector_kernels() registers the standard set: every arithmetic and norm member (add, sub, scalar mul and div,
+//	dot, cross, eucnorm_squared, eucnorm, normalize, normalize_self) on EuclideanRecVector2/3/4 and EuclideanCmplVector2/3/4
+//	of float. cross is 3D only. The batch kernels of the other headers are not part of the set, because this header depends on
+//	EuclideanVector.hpp alone; pass them to EucBenchmark::run() directly.
+//.
+
+#ifndef THL_EUCLID_VECTOR_BENCHMARK_HPP
+#define THL_EUCLID_VECTOR_BENCHMARK_HPP
+
+#include "EuclideanVector.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Hardware events.
+*/
+enum class EucPerfEvent : unsigned char {
+	cycles,
+	instructions,
+	cache_misses,
+	branch_misses,
+	vector_instructions,
+};
+
+constexpr size_t EucPerfEventCount = 5;
+
+EUCNODISCARD EUCVECTORINLINE const char* euc_perf_event_name(EucPerfEvent e) noexcept {
+	constexpr const char* names[EucPerfEventCount] = { "cycles", "instructions", "cache_misses", "branch_misses", "vector_instructions" };
+	return names[static_cast<size_t>(e)];
+}
+
+/*
+	Counter values of one measured region.
+*/
+struct EucPerfSample {
+	uint64_t value[EucPerfEventCount] = {};
+	bool valid[EucPerfEventCount] = {};
+
+	EUCNODISCARD EUCVECTORINLINE bool has(EucPerfEvent e) const noexcept { return valid[static_cast<size_t>(e)]; }
+	EUCNODISCARD EUCVECTORINLINE uint64_t operator[](EucPerfEvent e) const noexcept { return value[static_cast<size_t>(e)]; }
+};
+
+//details.
+namespace detail {
+
+	/*
+		@brief
+			Raw perf config counting retired packed floating-point instructions, or 0 when the CPU is not known.
+	*/
+	EUCNODISCARD EUCVECTORINLINE uint64_t perf_vector_event_config() noexcept {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		unsigned a, b, c, d;
+		if (!__get_cpuid(0, &a, &b, &c, &d)) return 0;
+		char vendor[13];
+		_STD memcpy(vendor + 0, &b, 4);
+		_STD memcpy(vendor + 4, &d, 4);
+		_STD memcpy(vendor + 8, &c, 4);
+		vendor[12] = '\0';
+		// Intel FP_ARITH_INST_RETIRED: 128/256-bit packed single and double.
+		if (_STD strcmp(vendor, "GenuineIntel") == 0) return 0x3cc7;
+		// AMD Zen: Retired SSE/AVX operations, all types.
+		if (_STD strcmp(vendor, "AuthenticAMD") == 0) return 0xff03;
+#endif
+		return 0;
+	}
+
+	// Keep a value alive without letting the optimizer see its use.
+	template<class T>
+	EUCVECTORINLINE void bench_keep(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static const void* volatile sink;
+		sink = &value;
+#endif
+	}
+
+}
+
+/*
+	Group of independently opened perf counters for the calling thread and its future children.
+*/
+class EucPerfCounters {
+protected:
+
+	int fd_[EucPerfEventCount];
+
+#if defined(__linux__)
+	EUCNODISCARD static EUCVECTORINLINE int open_event(uint32_t type, uint64_t config) noexcept {
+		perf_event_attr attr;
+		_STD memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = type;
+		attr.config = config;
+		attr.disabled = 1;
+		attr.inherit = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		const long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+		return fd < 0 ? -1 : static_cast<int>(fd);
+	}
+#endif
+
+public:
+
+	EucPerfCounters() noexcept {
+		for (auto& fd : fd_) fd = -1;
+#if defined(__linux__)
+		fd_[0] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+		fd_[1] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+		fd_[2] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+		fd_[3] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+		if (const uint64_t raw = detail::perf_vector_event_config()) fd_[4] = open_event(PERF_TYPE_RAW, raw);
+#endif
+	}
+
+	EucPerfCounters(const EucPerfCounters&) = delete;
+	EucPerfCounters& operator=(const EucPerfCounters&) = delete;
+
+	~EucPerfCounters() {
+#if defined(__linux__)
+		for (int fd : fd_) if (fd >= 0) close(fd);
+#endif
+	}
+
+	EUCNODISCARD EUCVECTORINLINE bool available(EucPerfEvent e) const noexcept { return fd_[static_cast<size_t>(e)] >= 0; }
+
+	EUCNODISCARD EUCVECTORINLINE bool any_available() const noexcept {
+		for (int fd : fd_) if (fd >= 0) return true;
+		return false;
+	}
+
+	EUCVECTORINLINE void start() noexcept {
+#if defined(__linux__)
+		for (int fd : fd_) {
+			if (fd < 0) continue;
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+
+	EUCNODISCARD EUCVECTORINLINE EucPerfSample stop() noexcept {
+		EucPerfSample sample;
+#if defined(__linux__)
+		for (int fd : fd_) if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+		for (size_t i = 0; i < EucPerfEventCount; ++i) {
+			if (fd_[i] < 0) continue;
+			uint64_t data[3];	// value, time enabled, time running.
+			if (read(fd_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) continue;
+			const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+			sample.value[i] = static_cast<uint64_t>(static_cast<double>(data[0]) * scale);
+			sample.valid[i] = true;
+		}
+#endif
+		return sample;
+	}
+};
+
+/*
+	Result of one kernel, per operation.
+*/
+struct EucBenchResult {
+	_STD string name;
+	// Operations per call of the kernel, and total calls in the kept repetition.
+	size_t ops_per_call = 0;
+	size_t calls = 0;
+	double bytes_per_op = 0.0;
+	double ns_per_op = 0.0;
+	// Counter value per operation; NaN when unavailable.
+	double per_op[EucPerfEventCount] = {};
+
+	EUCNODISCARD EUCVECTORINLINE double counter(EucPerfEvent e) const noexcept { return per_op[static_cast<size_t>(e)]; }
+
+	EUCNODISCARD EUCVECTORINLINE double ipc() const noexcept {
+		return counter(EucPerfEvent::instructions) / counter(EucPerfEvent::cycles);
+	}
+
+	// Memory traffic rate implied by bytes_per_op, in GB/s.
+	EUCNODISCARD EUCVECTORINLINE double bandwidth() const noexcept { return ns_per_op > 0.0 ? bytes_per_op / ns_per_op : 0.0; }
+};
+
+/*
+	Benchmark settings.
+*/
+struct EucBenchOptions {
+	// Measured repetitions per kernel; the fastest is kept.
+	size_t repetitions = 5;
+	// Minimum duration of one repetition, used to calibrate the call count.
+	double min_seconds = 0.02;
+};
+
+class EucBenchmark {
+protected:
+
+	using clock = _STD chrono::steady_clock;
+
+	EucBenchOptions options_;
+	EucPerfCounters counters_;
+	_STD vector<EucBenchResult> results_;
+
+	template<class F>
+	EUCNODISCARD EUCVECTORINLINE static double time_calls(F& fn, size_t calls) {
+		const auto t0 = clock::now();
+		for (size_t c = 0; c < calls; ++c) fn();
+		return _STD chrono::duration<double>(clock::now() - t0).count();
+	}
+
+public:
+
+	explicit EucBenchmark(const EucBenchOptions& options = {})
+		: options_(options)
+	{}
+
+	EUCNODISCARD EUCVECTORINLINE const EucPerfCounters& counters() const noexcept { return counters_; }
+	EUCNODISCARD EUCVECTORINLINE const _STD vector<EucBenchResult>& results() const noexcept { return results_; }
+
+	/*
+		@brief
+			Measure fn(), which performs ops_per_call operations touching bytes_per_op bytes each.
+	*/
+	template<class F>
+	EUCVECTORINLINE const EucBenchResult& run(_STD string name, size_t ops_per_call, double bytes_per_op, F&& fn) {
+		// Warm up, then grow the call count until one repetition lasts min_seconds.
+		size_t calls = 1;
+		for (double t = time_calls(fn, calls); t < options_.min_seconds && calls < (size_t(1) << 40); t = time_calls(fn, calls)) {
+			calls = t <= 0.0 ? calls * 16 : static_cast<size_t>(static_cast<double>(calls) * (options_.min_seconds / t) * 1.2) + 1;
+		}
+
+		double best = 0.0;
+		EucPerfSample best_sample;
+		for (size_t r = 0; r < (options_.repetitions == 0 ? 1 : options_.repetitions); ++r) {
+			counters_.start();
+			const double t = time_calls(fn, calls);
+			const EucPerfSample sample = counters_.stop();
+			if (r == 0 || t < best) {
+				best = t;
+				best_sample = sample;
+			}
+		}
+
+		EucBenchResult result;
+		result.name = _STD move(name);
+		result.ops_per_call = ops_per_call;
+		result.calls = calls;
+		result.bytes_per_op = bytes_per_op;
+		const double ops = static_cast<double>(calls) * static_cast<double>(ops_per_call == 0 ? 1 : ops_per_call);
+		result.ns_per_op = best * 1e9 / ops;
+		for (size_t i = 0; i < EucPerfEventCount; ++i) {
+			result.per_op[i] = best_sample.valid[i] ? static_cast<double>(best_sample.value[i]) / ops : _STD nan("");
+		}
+		results_.push_back(_STD move(result));
+		return results_.back();
+	}
+
+	EUCVECTORINLINE void clear() noexcept { results_.clear(); }
+
+	/*
+		@brief
+			Print a table of every result.
+	*/
+	EUCVECTORINLINE void report(_STD FILE* out = stdout) const {
+		auto cell = [out](double v, const char* format) {
+			if (_STD isnan(v)) _STD fprintf(out, " %10s", "n/a");
+			else _STD fprintf(out, format, v);
+		};
+		_STD fprintf(out, "%-36s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+			"kernel", "ns/op", "cyc/op", "inst/op", "IPC", "cmiss/op", "bmiss/op", "vec/op", "bytes/op");
+		for (const auto& r : results_) {
+			_STD fprintf(out, "%-36s", r.name.c_str());
+			cell(r.ns_per_op, " %10.3f");
+			cell(r.counter(EucPerfEvent::cycles), " %10.3f");
+			cell(r.counter(EucPerfEvent::instructions), " %10.3f");
+			cell(r.ipc(), " %10.3f");
+			cell(r.counter(EucPerfEvent::cache_misses), " %10.4f");
+			cell(r.counter(EucPerfEvent::branch_misses), " %10.4f");
+			cell(r.counter(EucPerfEvent::vector_instructions), " %10.3f");
+			cell(r.bytes_per_op, " %10.1f");
+			_STD fputc('\n', out);
+		}
+		if (!counters_.any_available()) _STD fprintf(out, "(hardware counters unavailable: timings only)\n");
+	}
+
+	/*
+		@brief
+			Write results as CSV: name, ns/op, counters/op..., bytes/op. Unavailable values are written as nan.
+	*/
+	EUCVECTORINLINE void write_csv(_STD FILE* out) const {
+		_STD fprintf(out, "name,ns_per_op");
+		for (size_t i = 0; i < EucPerfEventCount; ++i) _STD fprintf(out, ",%s", euc_perf_event_name(static_cast<EucPerfEvent>(i)));
+		_STD fprintf(out, ",bytes_per_op\n");
+		for (const auto& r : results_) {
+			_STD fprintf(out, "%s,%.6g", r.name.c_str(), r.ns_per_op);
+			for (size_t i = 0; i < EucPerfEventCount; ++i) _STD fprintf(out, ",%.6g", r.per_op[i]);
+			_STD fprintf(out, ",%.6g\n", r.bytes_per_op);
+		}
+	}
+};
+
+/*
+	@brief
+		Read results written by EucBenchmark::write_csv.
+*/
+EUCNODISCARD_MSG("The parsed results were ignored. This may be an unintended call.")
+	EUCVECTORINLINE _STD vector<EucBenchResult> euc_bench_read_csv(const _STD string& text) {
+	_STD vector<EucBenchResult> results;
+	size_t p = text.find('\n');	// skip the header.
+	while (p != _STD string::npos && p + 1 < text.size()) {
+		const size_t begin = p + 1;
+		p = text.find('\n', begin);
+		const _STD string line = text.substr(begin, p == _STD string::npos ? _STD string::npos : p - begin);
+		const size_t comma = line.find(',');
+		if (comma == _STD string::npos) continue;
+
+		EucBenchResult r;
+		r.name = line.substr(0, comma);
+		const char* s = line.c_str() + comma + 1;
+		char* end;
+		r.ns_per_op = _STD strtod(s, &end);
+		for (size_t i = 0; i < EucPerfEventCount; ++i) r.per_op[i] = (*end == ',') ? _STD strtod(end + 1, &end) : _STD nan("");
+		r.bytes_per_op = (*end == ',') ? _STD strtod(end + 1, &end) : 0.0;
+		results.push_back(_STD move(r));
+	}
+	return results;
+}
+
+/*
+	A metric that moved beyond the allowed tolerance.
+*/
+struct EucBenchRegression {
+	_STD string name;
+	// Event name, or "ns_per_op" when no counter was available on both sides.
+	const char* metric;
+	double baseline;
+	double current;
+
+	EUCNODISCARD EUCVECTORINLINE double ratio() const noexcept { return current / baseline; }
+};
+
+/*
+	@brief
+		Compare current results with a baseline by kernel name.
+		Instructions, cache misses, branch misses and vector instructions per op are checked
+		when both sides have them; otherwise ns/op is used. A metric regresses when current > baseline * (1 + tolerance).
+		Miss counts below 0.01 per op are ignored as noise.
+*/
+EUCNODISCARD_MSG("The comparison result was ignored. This may be an unintended call.")
+	EUCVECTORINLINE _STD vector<EucBenchRegression> euc_bench_compare(const _STD vector<EucBenchResult>& baseline,
+		const _STD vector<EucBenchResult>& current, double tolerance = 0.05) {
+	_STD vector<EucBenchRegression> regressions;
+	for (const auto& cur : current) {
+		const EucBenchResult* base = nullptr;
+		for (const auto& b : baseline) {
+			if (b.name == cur.name) {
+				base = &b;
+				break;
+			}
+		}
+		if (!base) continue;
+
+		bool counted = false;
+		for (EucPerfEvent e : { EucPerfEvent::instructions, EucPerfEvent::cache_misses, EucPerfEvent::branch_misses, EucPerfEvent::vector_instructions }) {
+			const double b = base->counter(e), c = cur.counter(e);
+			if (_STD isnan(b) || _STD isnan(c)) continue;
+			counted = true;
+			const bool miss = e == EucPerfEvent::cache_misses || e == EucPerfEvent::branch_misses;
+			if (miss && c < 0.01) continue;
+			if (c > b * (1.0 + tolerance)) regressions.push_back({ cur.name, euc_perf_event_name(e), b, c });
+		}
+		if (!counted && cur.ns_per_op > base->ns_per_op * (1.0 + tolerance)) {
+			regressions.push_back({ cur.name, "ns_per_op", base->ns_per_op, cur.ns_per_op });
+		}
+	}
+	return regressions;
+}
+
+//details.
+namespace detail {
+
+	// Component I of a benchmark input: distinct, non-zero and varying with f.
+	template<class V, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE V bench_vector_value(float f, float offset, _STD index_sequence<I...>) {
+		return V((f * (1.0f - 0.375f * static_cast<float>(I)) + offset + static_cast<float>(I))...);
+	}
+
+	template<class V, size_t D, class F>
+	EUCVECTORINLINE void bench_vector_kernel(EucBenchmark& bench, const char* name, size_t count, double bytes_per_op, F kernel) {
+		_STD vector<V> a, b, out;
+		a.reserve(count);
+		b.reserve(count);
+		out.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			const float f = static_cast<float>(i % 1024);
+			a.push_back(bench_vector_value<V>(f, 1.0f, _STD make_index_sequence<D>()));
+			b.push_back(bench_vector_value<V>(f * 0.5f, 2.0f, _STD make_index_sequence<D>()));
+			out.push_back(bench_vector_value<V>(0.0f, 0.0f, _STD make_index_sequence<D>()));
+		}
+		bench.run(name, count, bytes_per_op, [&] {
+			kernel(a.data(), b.data(), out.data(), count);
+			bench_keep(out.front());
+		});
+	}
+
+}
+
+/*
+	@brief
+		Register add, sub, scalar mul and div, dot, cross, eucnorm_squared, eucnorm, normalize and normalize_self
+		over arrays of count float vectors, for EuclideanRecVector2/3/4 and EuclideanCmplVector2/3/4.
+*/
+EUCVECTORINLINE void euc_bench_vector_kernels(EucBenchmark& bench, size_t count = 4096) {
+	auto each = [&](auto tag, auto dimension, const char* prefix) {
+		using V = typename decltype(tag)::type;
+		constexpr size_t D = decltype(dimension)::value;
+		constexpr double vb = static_cast<double>(sizeof(V));
+		const _STD string p = prefix;
+
+		detail::bench_vector_kernel<V, D>(bench, (p + "add").c_str(), count, vb * 3, [](const V* a, const V* b, V* o, size_t n) {
+			for (size_t i = 0; i < n; ++i) o[i] = a[i] + b[i];
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "sub").c_str(), count, vb * 3, [](const V* a, const V* b, V* o, size_t n) {
+			for (size_t i = 0; i < n; ++i) o[i] = a[i] - b[i];
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "mul").c_str(), count, vb * 2, [](const V* a, const V*, V* o, size_t n) {
+			for (size_t i = 0; i < n; ++i) o[i] = a[i] * 1.5f;
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "div").c_str(), count, vb * 2, [](const V* a, const V*, V* o, size_t n) {
+			for (size_t i = 0; i < n; ++i) o[i] = a[i] / 1.5f;
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "dot").c_str(), count, vb * 2 + 4, [](const V* a, const V* b, V* o, size_t n) {
+			float sum = 0.0f;
+			for (size_t i = 0; i < n; ++i) sum += a[i].dot(b[i]);
+			o[0].x() = sum;
+		});
+		if constexpr (D == 3) {
+			detail::bench_vector_kernel<V, D>(bench, (p + "cross").c_str(), count, vb * 3, [](const V* a, const V* b, V* o, size_t n) {
+				for (size_t i = 0; i < n; ++i) o[i] = a[i].cross(b[i]);
+			});
+		}
+		detail::bench_vector_kernel<V, D>(bench, (p + "eucnorm_squared").c_str(), count, vb + 4, [](const V* a, const V*, V* o, size_t n) {
+			float sum = 0.0f;
+			for (size_t i = 0; i < n; ++i) sum += a[i].eucnorm_squared();
+			o[0].x() = sum;
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "eucnorm").c_str(), count, vb + 4, [](const V* a, const V*, V* o, size_t n) {
+			float sum = 0.0f;
+			for (size_t i = 0; i < n; ++i) sum += a[i].eucnorm();
+			o[0].x() = sum;
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "normalize").c_str(), count, vb * 2, [](const V* a, const V*, V* o, size_t n) {
+			for (size_t i = 0; i < n; ++i) o[i] = a[i].normalize();
+		});
+		detail::bench_vector_kernel<V, D>(bench, (p + "normalize_self").c_str(), count, vb * 2, [](const V* a, const V*, V* o, size_t n) {
+			for (size_t i = 0; i < n; ++i) {
+				o[i] = a[i];
+				o[i].normalize_self();
+			}
+		});
+	};
+	each(_STD common_type<EuclideanRecVector2<float>>(), _STD integral_constant<size_t, 2>(), "RecVector2<float>.");
+	each(_STD common_type<EuclideanRecVector3<float>>(), _STD integral_constant<size_t, 3>(), "RecVector3<float>.");
+	each(_STD common_type<EuclideanRecVector4<float>>(), _STD integral_constant<size_t, 4>(), "RecVector4<float>.");
+	each(_STD common_type<EuclideanCmplVector2<float>>(), _STD integral_constant<size_t, 2>(), "CmplVector2<float>.");
+	each(_STD common_type<EuclideanCmplVector3<float>>(), _STD integral_constant<size_t, 3>(), "CmplVector3<float>.");
+	each(_STD common_type<EuclideanCmplVector4<float>>(), _STD integral_constant<size_t, 4>(), "CmplVector4<float>.");
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,315 @@
+//
+//	EuclideanVector Broadphase
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Sweep-and-prune broadphase over axis aligned boxes given as min / max 3D vectors
+//	(ResultPacker_3 bounds as returned by the vector operators, or EuclideanCmplVector3).
+//
+//	Objects are kept sorted by their minimum on one sweep axis. Between frames the order from the previous frame is
+//	repaired with an insertion sort, which is close to linear when objects move a little each frame.
+//	During the sweep, the candidates of an object are the following objects whose minimum is not past its maximum.
+//	Those candidates are tested on the two other axes 8 at a time (AVX, float). The gathered, sorted SoA bounds
+//	make these loads contiguous.
+//
+//	Pairs are written to a buffer owned by the broadphase that is cleared, not freed, every frame.
+//	After the first frames, update() makes no allocation.
+//.
+
+#ifndef THL_EUCLID_VECTOR_BROADPHASE_HPP
+#define THL_EUCLID_VECTOR_BROADPHASE_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Overlapping pair of object indices, a < b.
+*/
+struct EucBroadphasePair {
+	uint32_t a;
+	uint32_t b;
+};
+
+//meta functions.
+namespace meta {
+
+	template<class B, class E>
+	constexpr bool is_euc_bound_v = [] {
+		if constexpr (is_euc_vector_v<B>) {
+			return euc_dimension_v<B> == 3 && _STD is_convertible_v<euc_elem_t<B>, E>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+/*
+	Sweep-and-prune broadphase.
+	E is the coordinate type used for sorting and overlap tests.
+*/
+template<class E = float>
+class EucSweepAndPrune {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucSweepAndPrune needs a floating point coordinate type");
+
+	/*
+		Counters of the last update().
+	*/
+	struct Stats {
+		size_t count;
+		size_t swaps;			// insertion sort moves; count * count / 4 means no coherence.
+		size_t candidates;		// pairs overlapping on the sweep axis.
+		size_t pairs;
+		bool rebuilt;
+	};
+
+protected:
+
+	static constexpr size_t Lanes = 8;
+
+	// Sorted keys and object ids, kept across frames.
+	_STD vector<E> key_;
+	_STD vector<uint32_t> order_;
+	// Bounds by object index: min x,y,z then max x,y,z.
+	_STD vector<E> bound_[6];
+	// Bounds in sweep order; a = sweep axis, b and c = other axes. Padded with empty boxes.
+	_STD vector<E> smin_a_, smax_a_, smin_b_, smax_b_, smin_c_, smax_c_;
+	_STD vector<EucBroadphasePair> pairs_;
+	int axis_;
+	int fixed_axis_;
+	Stats stats_;
+
+	EUCVECTORINLINE void choose_axis(size_t count) noexcept {
+		if (fixed_axis_ >= 0) {
+			axis_ = fixed_axis_;
+			return;
+		}
+		// Axis with the largest spread of box centers.
+		double best = -1.0;
+		for (int k = 0; k < 3; ++k) {
+			double sum = 0.0, sq = 0.0;
+			for (size_t i = 0; i < count; ++i) {
+				const double c = (static_cast<double>(bound_[k][i]) + static_cast<double>(bound_[k + 3][i])) * 0.5;
+				sum += c;
+				sq += c * c;
+			}
+			const double var = sq - sum * sum / static_cast<double>(count);
+			if (var > best) {
+				best = var;
+				axis_ = k;
+			}
+		}
+	}
+
+	EUCVECTORINLINE void rebuild(size_t count) {
+		choose_axis(count);
+		order_.resize(count);
+		for (size_t i = 0; i < count; ++i) order_[i] = static_cast<uint32_t>(i);
+		const E* mins = bound_[axis_].data();
+		_STD sort(order_.begin(), order_.end(), [mins](uint32_t l, uint32_t r) { return mins[l] < mins[r]; });
+		key_.resize(count);
+		for (size_t i = 0; i < count; ++i) key_[i] = mins[order_[i]];
+	}
+
+	EUCVECTORINLINE size_t resort(size_t count) noexcept {
+		const E* mins = bound_[axis_].data();
+		for (size_t i = 0; i < count; ++i) key_[i] = mins[order_[i]];
+		size_t swaps = 0;
+		for (size_t i = 1; i < count; ++i) {
+			const E k = key_[i];
+			const uint32_t id = order_[i];
+			size_t j = i;
+			while (j > 0 && key_[j - 1] > k) {
+				key_[j] = key_[j - 1];
+				order_[j] = order_[j - 1];
+				--j;
+			}
+			key_[j] = k;
+			order_[j] = id;
+			swaps += i - j;
+		}
+		return swaps;
+	}
+
+	EUCVECTORINLINE void gather(size_t count) {
+		const size_t padded = count + Lanes;
+		const int b = (axis_ + 1) % 3, c = (axis_ + 2) % 3;
+		const E inf = _STD numeric_limits<E>::infinity();
+		smin_a_.resize(padded);
+		smax_a_.resize(padded);
+		smin_b_.resize(padded);
+		smax_b_.resize(padded);
+		smin_c_.resize(padded);
+		smax_c_.resize(padded);
+		for (size_t i = 0; i < count; ++i) {
+			const uint32_t id = order_[i];
+			smin_a_[i] = bound_[axis_][id];
+			smax_a_[i] = bound_[axis_ + 3][id];
+			smin_b_[i] = bound_[b][id];
+			smax_b_[i] = bound_[b + 3][id];
+			smin_c_[i] = bound_[c][id];
+			smax_c_[i] = bound_[c + 3][id];
+		}
+		// Padding never overlaps: min = +inf stops the sweep.
+		for (size_t i = count; i < padded; ++i) {
+			smin_a_[i] = smin_b_[i] = smin_c_[i] = inf;
+			smax_a_[i] = smax_b_[i] = smax_c_[i] = -inf;
+		}
+	}
+
+	EUCVECTORINLINE void emit(size_t i, size_t j) {
+		const uint32_t l = order_[i], r = order_[j];
+		pairs_.push_back(l < r ? EucBroadphasePair{ l, r } : EucBroadphasePair{ r, l });
+	}
+
+	EUCVECTORINLINE void sweep(size_t count) {
+		size_t candidates = 0;
+		for (size_t i = 0; i < count; ++i) {
+			const E amax = smax_a_[i];
+			const E bmin = smin_b_[i], bmax = smax_b_[i], cmin = smin_c_[i], cmax = smax_c_[i];
+			size_t j = i + 1;
+#if defined(THL_EUC_AVX)
+			if constexpr (_STD is_same_v<E, float>) {
+				const __m256 vamax = _mm256_set1_ps(amax);
+				const __m256 vbmin = _mm256_set1_ps(bmin), vbmax = _mm256_set1_ps(bmax);
+				const __m256 vcmin = _mm256_set1_ps(cmin), vcmax = _mm256_set1_ps(cmax);
+				for (;; j += Lanes) {
+					// Sorted by min: the lanes still on the sweep axis form a prefix.
+					const int live = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(smin_a_.data() + j), vamax, _CMP_LE_OQ));
+					if (live == 0) break;
+					__m256 hit = _mm256_and_ps(
+						_mm256_cmp_ps(_mm256_loadu_ps(smin_b_.data() + j), vbmax, _CMP_LE_OQ),
+						_mm256_cmp_ps(_mm256_loadu_ps(smax_b_.data() + j), vbmin, _CMP_GE_OQ));
+					hit = _mm256_and_ps(hit, _mm256_and_ps(
+						_mm256_cmp_ps(_mm256_loadu_ps(smin_c_.data() + j), vcmax, _CMP_LE_OQ),
+						_mm256_cmp_ps(_mm256_loadu_ps(smax_c_.data() + j), vcmin, _CMP_GE_OQ)));
+					int mask = _mm256_movemask_ps(hit) & live;
+					while (mask) {
+						const int lane = lowest_bit(mask);
+						emit(i, j + static_cast<size_t>(lane));
+						mask &= mask - 1;
+					}
+					if (live != 0xff) {
+						candidates += static_cast<size_t>(popcount8(live));
+						break;
+					}
+					candidates += Lanes;
+				}
+				continue;
+			}
+#endif
+			for (; smin_a_[j] <= amax; ++j) {
+				++candidates;
+				if (smin_b_[j] <= bmax && smax_b_[j] >= bmin && smin_c_[j] <= cmax && smax_c_[j] >= cmin) emit(i, j);
+			}
+		}
+		stats_.candidates = candidates;
+	}
+
+	EUCNODISCARD static EUCVECTORINLINE int lowest_bit(int mask) noexcept {
+		int n = 0;
+		while (!(mask & 1)) {
+			mask >>= 1;
+			++n;
+		}
+		return n;
+	}
+
+	EUCNODISCARD static EUCVECTORINLINE int popcount8(int mask) noexcept {
+		int n = 0;
+		for (; mask; mask &= mask - 1) ++n;
+		return n;
+	}
+
+public:
+
+	/*
+		axis : sweep axis 0..2, or -1 to pick the axis with the widest spread when the object set is rebuilt.
+	*/
+	explicit EucSweepAndPrune(int axis = -1) noexcept
+		: axis_(axis < 0 ? 0 : axis)
+		, fixed_axis_(axis)
+		, stats_{}
+	{}
+
+	/*
+		@brief
+			Reserve storage for count objects and pair_capacity pairs, so that the first frames do not allocate either.
+	*/
+	EUCVECTORINLINE void reserve(size_t count, size_t pair_capacity) {
+		key_.reserve(count);
+		order_.reserve(count);
+		for (auto& b : bound_) b.reserve(count);
+		for (auto* v : { &smin_a_, &smax_a_, &smin_b_, &smax_b_, &smin_c_, &smax_c_ }) v->reserve(count + Lanes);
+		pairs_.reserve(pair_capacity);
+	}
+
+	/*
+		@brief
+			Forget the order of the previous frame. The next update() sorts from scratch and re-chooses the axis.
+	*/
+	EUCVECTORINLINE void invalidate() noexcept {
+		order_.clear();
+	}
+
+	/*
+		@brief
+			Find every pair of boxes that overlap (touching counts as overlap).
+			mins[i] and maxs[i] are the corners of object i. When count matches the previous frame,
+			objects are assumed to keep their indices and the previous order is reused.
+			The returned buffer is valid until the next update().
+	*/
+	template<class B, meta::if_t<meta::is_euc_bound_v<B, E>> = 0>
+	EUCVECTORINLINE const _STD vector<EucBroadphasePair>& update(const B* mins, const B* maxs, size_t count) {
+		pairs_.clear();
+		stats_ = Stats{ count, 0, 0, 0, false };
+		for (auto& b : bound_) b.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			bound_[0][i] = static_cast<E>(detail::euc_get<0>(mins[i]));
+			bound_[1][i] = static_cast<E>(detail::euc_get<1>(mins[i]));
+			bound_[2][i] = static_cast<E>(detail::euc_get<2>(mins[i]));
+			bound_[3][i] = static_cast<E>(detail::euc_get<0>(maxs[i]));
+			bound_[4][i] = static_cast<E>(detail::euc_get<1>(maxs[i]));
+			bound_[5][i] = static_cast<E>(detail::euc_get<2>(maxs[i]));
+		}
+		if (count < 2) {
+			order_.clear();
+			return pairs_;
+		}
+
+		if (order_.size() != count) {
+			rebuild(count);
+			stats_.rebuilt = true;
+		}
+		else {
+			stats_.swaps = resort(count);
+		}
+		gather(count);
+		sweep(count);
+		stats_.pairs = pairs_.size();
+		return pairs_;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE const _STD vector<EucBroadphasePair>& pairs() const noexcept { return pairs_; }
+	EUCNODISCARD EUCVECTORINLINE const Stats& stats() const noexcept { return stats_; }
+	EUCNODISCARD EUCVECTORINLINE int axis() const noexcept { return axis_; }
+};
+
+//name space end.
+}
+
+#endif
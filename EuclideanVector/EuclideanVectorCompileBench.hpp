@@ -0,0 +1,116 @@
+//
+//	EuclideanVector CompileBench
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Compile-time workload for the operator overload sets in EuclideanVector.hpp.
+//
+//	euc_compile_bench() instantiates every binary, comparison and compound assignment overload of
+//	EuclideanCmplVector2/3/4 and EuclideanRecVector2/3/4 for a range of element types. That includes an element type with no compound
+//	operators and no !=, so the fallback paths are instantiated too. Include this header in an otherwise
+//	empty translation unit that calls euc_compile_bench(), and compile it once per language mode:
+//
+//		clang++ -std=c++17 -O0 -ftime-trace -c bench.cpp
+//		clang++ -std=c++20 -O0 -ftime-trace -c bench.cpp
+//
+//	Then compare "Total InstantiateFunction" in the two traces. With GCC, -ftime-report prints the same split
+//	under "template instantiation". C++20 uses the concept-based overloads (THL_EUC_CONCEPTS), and
+//	-DTHL_EUC_NO_CONCEPTS measures the C++17 overload pairs under the same compiler and standard library.
+//
+//	The return value depends on every instantiated call, so the calls are not optimised away.
+//.
+
+#ifndef THL_EUCLID_VECTOR_COMPILE_BENCH_HPP
+#define THL_EUCLID_VECTOR_COMPILE_BENCH_HPP
+
+#include "EuclideanVector.hpp"
+
+//name space begin.
+namespace thl::vector {
+
+//details.
+namespace detail {
+
+	/*
+		@brief
+			Element type with only +, -, *, / and ==. Every compound assignment and != on vectors of it takes the fallback.
+	*/
+	struct CompileBenchScalar {
+		double v;
+
+		constexpr CompileBenchScalar() noexcept : v() {}
+		constexpr CompileBenchScalar(double value) noexcept : v(value) {}
+
+		friend constexpr CompileBenchScalar operator+(CompileBenchScalar l, CompileBenchScalar r) noexcept { return { l.v + r.v }; }
+		friend constexpr CompileBenchScalar operator-(CompileBenchScalar l, CompileBenchScalar r) noexcept { return { l.v - r.v }; }
+		friend constexpr CompileBenchScalar operator*(CompileBenchScalar l, CompileBenchScalar r) noexcept { return { l.v * r.v }; }
+		friend constexpr CompileBenchScalar operator/(CompileBenchScalar l, CompileBenchScalar r) noexcept { return { l.v / r.v }; }
+		friend constexpr bool operator==(CompileBenchScalar l, CompileBenchScalar r) noexcept { return l.v == r.v; }
+	};
+
+	EUCVECTORINLINE double compile_bench_value(double v) noexcept { return v; }
+	EUCVECTORINLINE double compile_bench_value(CompileBenchScalar v) noexcept { return v.v; }
+
+	template<class V, class S>
+	EUCVECTORINLINE double compile_bench_ops(const V& a, const V& b, S scl) {
+		V c = a;
+		c += b;
+		c += V(b);
+		c += b * scl;
+		c -= b;
+		c -= V(b);
+		c -= b * scl;
+		c *= scl;
+		c /= scl;
+		int hits = 0;
+		hits += c == a;
+		hits += c != a;
+		hits += c != V(a);
+		hits += c != a * scl;
+		hits += a * scl != c;
+		hits += a * scl != V(c);
+		V d = a + b;
+		d = d - V(b);
+		d = d + b * scl;
+		d = scl * d;
+		d = d / scl;
+		return compile_bench_value(d.x()) + compile_bench_value(c.x()) + hits;
+	}
+
+	template<class E>
+	EUCVECTORINLINE double compile_bench_element(double seed) {
+		const E one = E(seed), two = E(seed + 1), three = E(seed + 2), four = E(seed + 3);
+		double sum = 0;
+		sum += compile_bench_ops(EuclideanCmplVector2<E>(one, two), EuclideanCmplVector2<E>(three, four), two);
+		sum += compile_bench_ops(EuclideanCmplVector3<E>(one, two, three), EuclideanCmplVector3<E>(four, three, two), two);
+		sum += compile_bench_ops(EuclideanCmplVector4<E>(one, two, three, four), EuclideanCmplVector4<E>(four, three, two, one), two);
+		sum += compile_bench_ops(EuclideanRecVector2<E>(one, two), EuclideanRecVector2<E>(three, four), two);
+		sum += compile_bench_ops(EuclideanRecVector3<E>(one, two, three), EuclideanRecVector3<E>(four, three, two), two);
+		sum += compile_bench_ops(EuclideanRecVector4<E>(one, two, three, four), EuclideanRecVector4<E>(four, three, two, one), two);
+		return sum;
+	}
+
+}
+
+/*
+	@brief
+		Instantiate the operator overload sets for float, double, long double, int, long long and a fallback-only
+		element type, and return a value that depends on all of them.
+*/
+EUCNODISCARD EUCVECTORINLINE double euc_compile_bench(double seed = 1) {
+	double sum = 0;
+	sum += detail::compile_bench_element<float>(seed);
+	sum += detail::compile_bench_element<double>(seed);
+	sum += detail::compile_bench_element<long double>(seed);
+	sum += detail::compile_bench_element<int>(seed);
+	sum += detail::compile_bench_element<long long>(seed);
+	sum += detail::compile_bench_element<detail::CompileBenchScalar>(seed);
+	return sum;
+}
+
+//name space end.
+}
+
+#endif
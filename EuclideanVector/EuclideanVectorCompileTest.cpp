@@ -0,0 +1,116 @@
+//
+//	EuclideanVector Compile Test
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Compile-only checks. Nothing here is called: each function instantiates templates of one header for a case
+//	that the headers do not reach on their own, such as 2D vectors built with the EuclideanCmplVector2 (x, y) constructor.
+//	Building this file is the test. The checks are kept out of the headers so that including a header costs nothing extra.
+//.
+
+#include "EuclideanVectorKMeans.hpp"
+#include "EuclideanVectorParticles.hpp"
+#include "EuclideanVectorMixed.hpp"
+#include "EuclideanVectorReduce.hpp"
+#include "EuclideanVectorRanges.hpp"
+
+//name space begin.
+namespace thl::vector::compile_test {
+
+	/*
+		kmeans on 2D float and double points.
+	*/
+	void kmeans_2d() {
+		const EuclideanCmplVector2<float> f[1] = {};
+		const EuclideanCmplVector2<double> d[1] = {};
+		(void)kmeans(f, 1, 1);
+		(void)kmeans(d, 1, 1);
+	}
+
+	/*
+		Every member of a 2D particle system, including position(), velocity() and force().
+	*/
+	void particles_2d() {
+		using V = EuclideanCmplVector2<float>;
+		V v[1] = {};
+		EucParticleSystem<V> ps;
+		ps.reserve(1);
+		(void)ps.add(v[0], v[0]);
+		ps.assign(v, v, 1);
+		ps.store_positions(v);
+		v[0] = ps.position(0);
+		v[0] = ps.velocity(0);
+		v[0] = ps.force(0);
+		ps.set_position(0, v[0]);
+		ps.set_velocity(0, v[0]);
+		ps.clear_forces();
+		ps.add_force(0, v[0]);
+		ps.add_gravity(v[0]);
+		ps.step_euler(0.5f);
+		ps.step_verlet(0.5f);
+		ps.step_rk4(0.5f, [](size_t, size_t, const float* const*, const float* const*, float* const*) {});
+	}
+
+	/*
+		The mixed-precision accumulator and batch functions on 2D vectors.
+	*/
+	void mixed_2d() {
+		const EuclideanCmplVector2<float> f[1] = {};
+		EuclideanCmplVector2<double> d[1] = {};
+		EucAccumulator<2> acc;
+		acc.add(f[0]);
+		acc.add(f, 1);
+		(void)acc.sum();
+		(void)acc.mean();
+		(void)euc_mixed_sum(f, 1);
+		(void)euc_mixed_dot_sum(f, f, 1);
+		euc_mixed_accumulate(d, f, 1);
+		euc_convert_range(f, d, 1);
+		d[0] = euc_convert<double>(f[0]);
+	}
+
+	/*
+		euc_sum and euc_mean on 2D float and double vectors.
+	*/
+	void reduce_2d() {
+		const EuclideanCmplVector2<float> f[1] = {};
+		const EuclideanRecVector2<double> d[1] = {};
+		(void)euc_sum(f, 1);
+		(void)euc_mean(f, 1, EucSumMethod::Pairwise);
+		(void)euc_sum(d, 1, EucSumMethod::Kahan);
+		(void)euc_mean(d, 1);
+	}
+
+#if defined(THL_EUC_RANGES)
+	/*
+		Iterating and collecting 2D pipes (the example at the top of EuclideanVectorRanges.hpp) through the lazy and
+		the fused paths.
+	*/
+	void ranges_2d() {
+		const EuclideanCmplVector3<float> points[1] = {};
+		const float model[4][4] = {};
+		auto view = points
+			| views::transformed(model)
+			| views::normalized
+			| views::filtered([](const auto& n) { return n.z_ > 0; })
+			| views::projected_xy;
+		for (auto v : view) (void)v;
+		(void)euc_collect(view);
+		(void)euc_collect(view | _STD views::take(1));
+
+		auto xy = points | views::normalized | views::projected_xy;
+		EuclideanCmplVector2<float> out[1];
+		for (auto v : xy) (void)v;
+		(void)euc_collect(xy);
+		(void)euc_collect_into(xy, out);
+	}
+#endif
+
+//name space end.
+}
+
+int main() {
+	return 0;
+}
@@ -0,0 +1,620 @@
+//
+//	EuclideanVector Compress
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Compressed storage for float vectors, for use when memory bandwidth is the limit.
+//
+//	1 : EuclideanCompressedVector<Codec, D>
+//
+//		Stores D elements in the codec storage type:
+//			EucHalfCodec		IEEE 754 binary16 (F16C when available).
+//			EucSnorm16Codec		normalized int16, values in [-1, 1].
+//			EucSnorm8Codec		normalized int8, values in [-1, 1].
+//		Arithmetic decodes on load and returns float ResultPacker types, like the other vector types.
+//
+//	2 : EucOctUnitVector<S>
+//
+//		Unit 3D vectors in octahedral encoding, stored as two normalized S (int16 = 32 bit, int8 = 16 bit).
+//
+//	Batch kernels (encode_vectors / decode_vectors / encode_unit_vectors / decode_unit_vectors)
+//	convert whole arrays of EuclideanCmplVectorN<float> at once.
+//	Snorm data outside [-1, 1] is supported through the scale argument: the kernels store v / scale and return v * scale.
+//.
+
+#ifndef THL_EUCLID_VECTOR_COMPRESS_HPP
+#define THL_EUCLID_VECTOR_COMPRESS_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+//name space begin.
+namespace thl::vector {
+
+//details.
+namespace detail {
+
+	EUCNODISCARD EUCVECTORINLINE uint32_t cmp_float_bits(float f) noexcept {
+		uint32_t u;
+		_STD memcpy(&u, &f, sizeof(u));
+		return u;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE float cmp_bits_float(uint32_t u) noexcept {
+		float f;
+		_STD memcpy(&f, &u, sizeof(f));
+		return f;
+	}
+
+	/*
+		@brief
+			float -> binary16, round to nearest even. Overflow becomes infinity, NaN stays NaN.
+	*/
+	EUCNODISCARD EUCVECTORINLINE uint16_t half_from_float(float value) noexcept {
+		constexpr uint32_t f32_infinity = 255u << 23;
+		constexpr uint32_t f16_overflow = (127u + 16u) << 23;
+		constexpr uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+		uint32_t u = cmp_float_bits(value);
+		const uint32_t sign = u & 0x80000000u;
+		u ^= sign;
+
+		uint32_t out;
+		if (u >= f16_overflow) {
+			out = (u > f32_infinity) ? 0x7e00u : 0x7c00u;
+		}
+		else if (u < (113u << 23)) {
+			out = cmp_float_bits(cmp_bits_float(u) + cmp_bits_float(denorm_magic)) - denorm_magic;
+		}
+		else {
+			const uint32_t mant_odd = (u >> 13) & 1u;
+			u += (uint32_t(15 - 127) << 23) + 0xfffu;
+			u += mant_odd;
+			out = u >> 13;
+		}
+		return static_cast<uint16_t>(out | (sign >> 16));
+	}
+
+	/*
+		@brief
+			binary16 -> float, exact.
+	*/
+	EUCNODISCARD EUCVECTORINLINE float float_from_half(uint16_t half) noexcept {
+		constexpr uint32_t shifted_exp = 0x7c00u << 13;
+		uint32_t u = (uint32_t(half) & 0x7fffu) << 13;
+		const uint32_t exp = shifted_exp & u;
+		u += (127u - 15u) << 23;
+		if (exp == shifted_exp) {
+			u += (128u - 16u) << 23;
+		}
+		else if (exp == 0) {
+			u += 1u << 23;
+			u = cmp_float_bits(cmp_bits_float(u) - cmp_bits_float(113u << 23));
+		}
+		return cmp_bits_float(u | ((uint32_t(half) & 0x8000u) << 16));
+	}
+
+	template<class I>
+	constexpr float snorm_max = static_cast<float>((1 << (sizeof(I) * 8 - 1)) - 1);
+
+	template<class I>
+	EUCNODISCARD EUCVECTORINLINE I snorm_from_float(float value) noexcept {
+		value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+		return static_cast<I>(_STD lrint(value * snorm_max<I>));
+	}
+
+	template<class I>
+	EUCNODISCARD EUCVECTORINLINE float float_from_snorm(I value) noexcept {
+		const float f = static_cast<float>(value) * (1.0f / snorm_max<I>);
+		return f < -1.0f ? -1.0f : f;
+	}
+
+	/*
+		@brief
+			Batch float -> half (8 lanes per step with F16C).
+	*/
+	EUCVECTORINLINE void half_encode_n(const float* src, uint16_t* dst, size_t count, float inv_scale) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_F16C) && defined(THL_EUC_AVX)
+		const __m256 s = _mm256_set1_ps(inv_scale);
+		for (; i + 8 <= count; i += 8) {
+			const __m256 v = _mm256_mul_ps(_mm256_loadu_ps(src + i), s);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+		}
+#endif
+		for (; i < count; ++i) dst[i] = half_from_float(src[i] * inv_scale);
+	}
+
+	/*
+		@brief
+			Batch half -> float (8 lanes per step with F16C).
+	*/
+	EUCVECTORINLINE void half_decode_n(const uint16_t* src, float* dst, size_t count, float scale) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_F16C) && defined(THL_EUC_AVX)
+		const __m256 s = _mm256_set1_ps(scale);
+		for (; i + 8 <= count; i += 8) {
+			const __m256 v = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+			_mm256_storeu_ps(dst + i, _mm256_mul_ps(v, s));
+		}
+#endif
+		for (; i < count; ++i) dst[i] = float_from_half(src[i]) * scale;
+	}
+
+	/*
+		@brief
+			Batch float -> snorm (4 lanes per step with SSE2).
+	*/
+	template<class I>
+	EUCVECTORINLINE void snorm_encode_n(const float* src, I* dst, size_t count, float inv_scale) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_SSE2)
+		const __m128 s = _mm_set1_ps(inv_scale);
+		const __m128 lo = _mm_set1_ps(-1.0f);
+		const __m128 hi = _mm_set1_ps(1.0f);
+		const __m128 m = _mm_set1_ps(snorm_max<I>);
+		for (; i + 4 <= count; i += 4) {
+			__m128 v = _mm_mul_ps(_mm_loadu_ps(src + i), s);
+			v = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, lo), hi), m);
+			const __m128i q32 = _mm_cvtps_epi32(v);
+			const __m128i q16 = _mm_packs_epi32(q32, q32);
+			if constexpr (sizeof(I) == 2) {
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), q16);
+			}
+			else {
+				const int32_t q8 = _mm_cvtsi128_si32(_mm_packs_epi16(q16, q16));
+				_STD memcpy(dst + i, &q8, sizeof(q8));
+			}
+		}
+#endif
+		for (; i < count; ++i) dst[i] = snorm_from_float<I>(src[i] * inv_scale);
+	}
+
+	/*
+		@brief
+			Batch snorm -> float (4 lanes per step with SSE2).
+	*/
+	template<class I>
+	EUCVECTORINLINE void snorm_decode_n(const I* src, float* dst, size_t count, float scale) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_SSE2)
+		const __m128 lo = _mm_set1_ps(-1.0f);
+		const __m128 m = _mm_set1_ps(1.0f / snorm_max<I>);
+		const __m128 s = _mm_set1_ps(scale);
+		for (; i + 4 <= count; i += 4) {
+			__m128i q;
+			if constexpr (sizeof(I) == 2) {
+				q = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+				q = _mm_srai_epi32(_mm_unpacklo_epi16(q, q), 16);
+			}
+			else {
+				int32_t raw;
+				_STD memcpy(&raw, src + i, sizeof(raw));
+				q = _mm_cvtsi32_si128(raw);
+				q = _mm_unpacklo_epi8(q, q);
+				q = _mm_srai_epi32(_mm_unpacklo_epi16(q, q), 24);
+			}
+			const __m128 v = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(q), m), lo);
+			_mm_storeu_ps(dst + i, _mm_mul_ps(v, s));
+		}
+#endif
+		for (; i < count; ++i) dst[i] = float_from_snorm(src[i]) * scale;
+	}
+
+	template<class P, class A, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE P cmp_make_packer(const A& a, _STD index_sequence<I...>) noexcept {
+		return P{ a[I]... };
+	}
+
+}
+
+/*
+	IEEE 754 binary16.
+*/
+struct EucHalfCodec {
+	using storage_type = uint16_t;
+
+	EUCNODISCARD static EUCVECTORINLINE storage_type encode(float v) noexcept { return detail::half_from_float(v); }
+	EUCNODISCARD static EUCVECTORINLINE float decode(storage_type v) noexcept { return detail::float_from_half(v); }
+
+	static EUCVECTORINLINE void encode_n(const float* src, storage_type* dst, size_t count, float inv_scale) noexcept {
+		detail::half_encode_n(src, dst, count, inv_scale);
+	}
+	static EUCVECTORINLINE void decode_n(const storage_type* src, float* dst, size_t count, float scale) noexcept {
+		detail::half_decode_n(src, dst, count, scale);
+	}
+};
+
+/*
+	Normalized signed integer, values in [-1, 1].
+*/
+template<class I>
+struct EucSnormCodec {
+	using storage_type = I;
+
+	static_assert(_STD is_integral_v<I> && _STD is_signed_v<I> && sizeof(I) <= 2, "Snorm storage must be int8_t or int16_t");
+
+	EUCNODISCARD static EUCVECTORINLINE storage_type encode(float v) noexcept { return detail::snorm_from_float<I>(v); }
+	EUCNODISCARD static EUCVECTORINLINE float decode(storage_type v) noexcept { return detail::float_from_snorm(v); }
+
+	static EUCVECTORINLINE void encode_n(const float* src, storage_type* dst, size_t count, float inv_scale) noexcept {
+		detail::snorm_encode_n(src, dst, count, inv_scale);
+	}
+	static EUCVECTORINLINE void decode_n(const storage_type* src, float* dst, size_t count, float scale) noexcept {
+		detail::snorm_decode_n(src, dst, count, scale);
+	}
+};
+
+using EucSnorm16Codec = EucSnormCodec<int16_t>;
+using EucSnorm8Codec = EucSnormCodec<int8_t>;
+
+template<class Codec, size_t D>
+struct EuclideanCompressedVector;
+
+//meta functions.
+namespace meta {
+
+	template<class V, size_t D>
+	struct is_euc_compressed {
+		static constexpr bool value = false;
+	};
+	template<class Codec, size_t D>
+	struct is_euc_compressed<EuclideanCompressedVector<Codec, D>, D> {
+		static constexpr bool value = true;
+	};
+
+	// compressed vector of dimension D.
+	template<class V, size_t D>
+	constexpr bool is_euc_compressed_v = is_euc_compressed<_STD remove_cv_t<no_ref<V>>, D>::value;
+
+}
+
+/*
+	Compressed vector.
+*/
+template<class Codec, size_t D>
+struct EuclideanCompressedVector {
+protected:
+
+	static constexpr size_t EucD = D;
+
+	using StorageType = typename Codec::storage_type;
+	using Packer = meta::euc_packer_t<float, D>;
+	using Seq = _STD make_index_sequence<D>;
+
+	static_assert(D >= 1 && D <= 4, "Compressed vectors have 1 to 4 elements");
+
+	// Vectors and packers that can be encoded.
+	template<class V>
+	static constexpr bool is_source_v = meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == D;
+
+	// Anything arithmetic accepts : sources and compressed vectors of any codec.
+	template<class V>
+	static constexpr bool is_operand_v = is_source_v<V> || meta::is_euc_compressed_v<V, D>;
+
+	template<class V, size_t... I>
+	EUCVECTORINLINE void encode_from(const V& v, _STD index_sequence<I...>) noexcept {
+		((e_[I] = Codec::encode(static_cast<float>(detail::euc_get<I>(v)))), ...);
+	}
+
+	template<class V, size_t... I>
+	EUCNODISCARD static EUCVECTORINLINE Packer load(const V& v, _STD index_sequence<I...>) noexcept {
+		return { static_cast<float>(detail::euc_get<I>(v))... };
+	}
+
+	EUCVECTORINLINE const float* decode_array(float* out) const noexcept {
+		for (size_t i = 0; i < D; ++i) out[i] = Codec::decode(e_[i]);
+		return out;
+	}
+
+	template<class V>
+	static EUCVECTORINLINE const float* operand_array(const V& v, float* out) noexcept {
+		if constexpr (meta::is_euc_compressed_v<V, D>) {
+			return v.decode_array(out);
+		}
+		else {
+			size_t i = 0;
+			detail::euc_for_each(v, [&](const auto& e) { out[i++] = static_cast<float>(e); });
+			return out;
+		}
+	}
+
+public:
+
+	StorageType e_[D];
+
+	/*
+		Constructors.
+	*/
+	EuclideanCompressedVector() noexcept
+		: e_()
+	{}
+
+	template<class V, meta::if_t<is_source_v<V>> = 0>
+	explicit EuclideanCompressedVector(const V& v) noexcept {
+		encode_from(v, Seq());
+	}
+
+	/*
+		Assignment Operators.
+	*/
+	template<class V, meta::if_t<is_source_v<V>> = 0>
+	EUCVECTORINLINE EuclideanCompressedVector& operator=(const V& v) & noexcept {
+		encode_from(v, Seq());
+		return *this;
+	}
+
+	/*
+		Client Function.
+	*/
+	/*
+		@brief
+			Get dimension.
+	*/
+	EUCNODISCARD_MSG("The acquisition of dimensionality is disregarded. It is possible that this is an unintended call.")
+		EUCVECTORINLINE constexpr size_t dimension() const noexcept { return EucD; }
+	/*
+		@brief
+			Decode into a float packer.
+	*/
+	EUCNODISCARD_MSG("The decoded vector was ignored. This may be an unintended call.")
+		EUCVECTORINLINE Packer decode() const noexcept {
+		float a[D];
+		return detail::cmp_make_packer<Packer>(decode_array(a), Seq());
+	}
+	/*
+		@brief
+			Decode a single element.
+	*/
+	EUCNODISCARD_MSG("The decoded element was ignored. This may be an unintended call.")
+		EUCVECTORINLINE float get(size_t i) const noexcept { return Codec::decode(e_[i]); }
+
+	/*
+		Binary Operators. (decode on load, float result)
+	*/
+	template<class V>
+	EUCNODISCARD_MSG("The result of the addition is being ignored.")
+		EUCVECTORINLINE auto operator+(const V& v) const noexcept
+		-> decltype(meta::when_true<is_operand_v<V>>(), Packer()) {
+		float a[D], b[D], r[D];
+		decode_array(a);
+		operand_array(v, b);
+		for (size_t i = 0; i < D; ++i) r[i] = a[i] + b[i];
+		return detail::cmp_make_packer<Packer>(r, Seq());
+	}
+
+	template<class V>
+	EUCNODISCARD_MSG("The result of the subtraction is being ignored.")
+		EUCVECTORINLINE auto operator-(const V& v) const noexcept
+		-> decltype(meta::when_true<is_operand_v<V>>(), Packer()) {
+		float a[D], b[D], r[D];
+		decode_array(a);
+		operand_array(v, b);
+		for (size_t i = 0; i < D; ++i) r[i] = a[i] - b[i];
+		return detail::cmp_make_packer<Packer>(r, Seq());
+	}
+
+	template<class S, meta::if_t<_STD is_arithmetic_v<meta::no_ref<S>>> = 0>
+	EUCNODISCARD_MSG("The result of the multiplication is being ignored.")
+		EUCVECTORINLINE Packer operator*(S&& scl) const noexcept {
+		float a[D];
+		decode_array(a);
+		for (size_t i = 0; i < D; ++i) a[i] *= static_cast<float>(scl);
+		return detail::cmp_make_packer<Packer>(a, Seq());
+	}
+
+	template<class S, meta::if_t<_STD is_arithmetic_v<meta::no_ref<S>>> = 0>
+	EUCNODISCARD_MSG("The result of the division is being ignored.")
+		EUCVECTORINLINE Packer operator/(S&& scl) const noexcept {
+		float a[D];
+		decode_array(a);
+		for (size_t i = 0; i < D; ++i) a[i] /= static_cast<float>(scl);
+		return detail::cmp_make_packer<Packer>(a, Seq());
+	}
+
+	/*
+		@brief
+			Calculates the dot product.
+			out = e1*re1 + e2*re2 + ... + en*ren.
+	*/
+	template<class V>
+	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
+		EUCVECTORINLINE auto dot(const V& v) const noexcept
+		-> decltype(meta::when_true<is_operand_v<V>>(), float()) {
+		float a[D], b[D];
+		decode_array(a);
+		operand_array(v, b);
+		float sum = 0.0f;
+		for (size_t i = 0; i < D; ++i) sum += a[i] * b[i];
+		return sum;
+	}
+	/*
+		@brief
+			Calculate the square of the norm.
+	*/
+	EUCNODISCARD_MSG("The norm squared calculation results were ignored. This may be an unintended call.")
+		EUCVECTORINLINE float eucnorm_squared() const noexcept {
+		float a[D];
+		decode_array(a);
+		float sum = 0.0f;
+		for (size_t i = 0; i < D; ++i) sum += a[i] * a[i];
+		return sum;
+	}
+	/*
+		@brief
+			Calculate the norm.
+	*/
+	EUCNODISCARD_MSG("The norm calculation results were ignored. This may be an unintended call.")
+		EUCVECTORINLINE float eucnorm() const noexcept {
+		return _STD sqrt(eucnorm_squared());
+	}
+
+	template<class C, size_t N>
+	friend struct EuclideanCompressedVector;
+};
+
+/*
+	Unit vector in octahedral encoding.
+*/
+template<class S>
+struct EucOctUnitVector {
+protected:
+
+	using Packer = detail::ResultPacker_3<float>;
+
+	static_assert(_STD is_integral_v<S> && _STD is_signed_v<S> && sizeof(S) <= 2, "Octahedral storage must be int8_t or int16_t");
+
+	EUCNODISCARD static EUCVECTORINLINE float sign_not_zero(float v) noexcept { return v < 0.0f ? -1.0f : 1.0f; }
+
+public:
+
+	S u_, v_;
+
+	EucOctUnitVector() noexcept
+		: u_()
+		, v_()
+	{}
+
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	explicit EucOctUnitVector(const V& n) noexcept {
+		encode(static_cast<float>(detail::euc_get<0>(n)), static_cast<float>(detail::euc_get<1>(n)), static_cast<float>(detail::euc_get<2>(n)));
+	}
+
+	/*
+		@brief
+			Encode a direction. The input does not need to be normalized.
+	*/
+	EUCVECTORINLINE void encode(float x, float y, float z) noexcept {
+		const float l1 = _STD fabs(x) + _STD fabs(y) + _STD fabs(z);
+		const float inv = l1 > 0.0f ? 1.0f / l1 : 0.0f;
+		float px = x * inv;
+		float py = y * inv;
+		if (z < 0.0f) {
+			const float ox = (1.0f - _STD fabs(py)) * sign_not_zero(px);
+			const float oy = (1.0f - _STD fabs(px)) * sign_not_zero(py);
+			px = ox;
+			py = oy;
+		}
+		u_ = detail::snorm_from_float<S>(px);
+		v_ = detail::snorm_from_float<S>(py);
+	}
+
+	/*
+		@brief
+			Decode into a normalized float packer.
+	*/
+	EUCNODISCARD_MSG("The decoded vector was ignored. This may be an unintended call.")
+		EUCVECTORINLINE Packer decode() const noexcept {
+		float x = detail::float_from_snorm(u_);
+		float y = detail::float_from_snorm(v_);
+		float z = 1.0f - _STD fabs(x) - _STD fabs(y);
+		const float t = z < 0.0f ? -z : 0.0f;
+		x += x >= 0.0f ? -t : t;
+		y += y >= 0.0f ? -t : t;
+		const float inv = 1.0f / _STD sqrt(x * x + y * y + z * z);
+		return { x * inv, y * inv, z * inv };
+	}
+
+	/*
+		@brief
+			Calculates the dot product with any 3D vector.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCNODISCARD_MSG("The dot product calculation results were ignored. This may be an unintended call.")
+		EUCVECTORINLINE float dot(const V& r) const noexcept {
+		const Packer n = decode();
+		return n.x * static_cast<float>(detail::euc_get<0>(r)) + n.y * static_cast<float>(detail::euc_get<1>(r)) + n.z * static_cast<float>(detail::euc_get<2>(r));
+	}
+};
+
+/*
+	Batch kernels.
+*/
+/*
+	@brief
+		Encode count float vectors into compressed storage. dst[i] = src[i] / scale.
+*/
+template<class V, class Codec, size_t D,
+	meta::if_t<meta::is_euc_flat_v<V> && meta::euc_dimension_v<V> == D && _STD is_same_v<meta::euc_elem_t<V>, float>> = 0>
+EUCVECTORINLINE void encode_vectors(const V* src, EuclideanCompressedVector<Codec, D>* dst, size_t count, float scale = 1.0f) noexcept {
+	static_assert(sizeof(EuclideanCompressedVector<Codec, D>) == sizeof(typename Codec::storage_type) * D, "Compressed vector must be tightly packed");
+	Codec::encode_n(reinterpret_cast<const float*>(src), reinterpret_cast<typename Codec::storage_type*>(dst), count * D, 1.0f / scale);
+}
+
+/*
+	@brief
+		Decode count compressed vectors into float vectors. dst[i] = src[i] * scale.
+*/
+template<class V, class Codec, size_t D,
+	meta::if_t<meta::is_euc_flat_v<V> && meta::euc_dimension_v<V> == D && _STD is_same_v<meta::euc_elem_t<V>, float>> = 0>
+EUCVECTORINLINE void decode_vectors(const EuclideanCompressedVector<Codec, D>* src, V* dst, size_t count, float scale = 1.0f) noexcept {
+	static_assert(sizeof(EuclideanCompressedVector<Codec, D>) == sizeof(typename Codec::storage_type) * D, "Compressed vector must be tightly packed");
+	Codec::decode_n(reinterpret_cast<const typename Codec::storage_type*>(src), reinterpret_cast<float*>(dst), count * D, scale);
+}
+
+/*
+	@brief
+		Largest absolute element of count vectors, for use as the snorm scale.
+*/
+template<class V, meta::if_t<meta::is_euc_flat_v<V> && _STD is_same_v<meta::euc_elem_t<V>, float>> = 0>
+EUCNODISCARD_MSG("The computed scale was ignored. This may be an unintended call.")
+	EUCVECTORINLINE float snorm_scale(const V* src, size_t count) noexcept {
+	const float* p = reinterpret_cast<const float*>(src);
+	const size_t n = count * meta::euc_dimension_v<V>;
+	float m = 0.0f;
+	for (size_t i = 0; i < n; ++i) {
+		const float a = _STD fabs(p[i]);
+		m = a > m ? a : m;
+	}
+	return m > 0.0f ? m : 1.0f;
+}
+
+/*
+	@brief
+		Encode count directions in octahedral form.
+*/
+template<class V, class S, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCVECTORINLINE void encode_unit_vectors(const V* src, EucOctUnitVector<S>* dst, size_t count) noexcept {
+	for (size_t i = 0; i < count; ++i) {
+		dst[i].encode(static_cast<float>(detail::euc_get<0>(src[i])), static_cast<float>(detail::euc_get<1>(src[i])), static_cast<float>(detail::euc_get<2>(src[i])));
+	}
+}
+
+/*
+	@brief
+		Decode count octahedral directions into normalized vectors.
+*/
+template<class V, class S, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3 && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void decode_unit_vectors(const EucOctUnitVector<S>* src, V* dst, size_t count) noexcept {
+	for (size_t i = 0; i < count; ++i) dst[i] = src[i].decode();
+}
+
+/*
+	Compressed Vector.
+*/
+using EucHalfVector2 = EuclideanCompressedVector<EucHalfCodec, 2>;
+using EucHalfVector3 = EuclideanCompressedVector<EucHalfCodec, 3>;
+using EucHalfVector4 = EuclideanCompressedVector<EucHalfCodec, 4>;
+
+using EucSnorm16Vector2 = EuclideanCompressedVector<EucSnorm16Codec, 2>;
+using EucSnorm16Vector3 = EuclideanCompressedVector<EucSnorm16Codec, 3>;
+using EucSnorm16Vector4 = EuclideanCompressedVector<EucSnorm16Codec, 4>;
+
+using EucSnorm8Vector2 = EuclideanCompressedVector<EucSnorm8Codec, 2>;
+using EucSnorm8Vector3 = EuclideanCompressedVector<EucSnorm8Codec, 3>;
+using EucSnorm8Vector4 = EuclideanCompressedVector<EucSnorm8Codec, 4>;
+
+using EucOctUnitVector32 = EucOctUnitVector<int16_t>;
+using EucOctUnitVector16 = EucOctUnitVector<int8_t>;
+
+//name space end.
+}
+
+#endif
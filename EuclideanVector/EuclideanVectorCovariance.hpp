@@ -0,0 +1,466 @@
+//
+//	EuclideanVector Covariance
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Covariance, principal axes and best-fit plane / line of 3D point sets.
+//
+//	EucCovariance3 is a single-pass accumulator (count, mean and the centered second moments). Points are added
+//	in blocks of up to 256. Each block is reduced two-pass while it stays in L1, then folded in with the pairwise
+//	update of Chan et al. Two accumulators can be merged the same way, so each thread fills its own and they
+//	are merged at the end.
+//
+//	euc_eigen_symmetric solves a 3x3 symmetric matrix in closed form. The eigenvalues use the trigonometric
+//	method, and the eigenvectors are built from cross products. With that, repeated eigenvalues still give an
+//	orthonormal basis. There is no iteration and no allocation.
+//.
+
+#ifndef THL_EUCLID_VECTOR_COVARIANCE_HPP
+#define THL_EUCLID_VECTOR_COVARIANCE_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Symmetric 3x3 matrix, upper triangle.
+*/
+template<class E = double>
+struct EucSymmetric3 {
+	E xx, xy, xz, yy, yz, zz;
+
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> operator*(const EuclideanCmplVector3<E>& v) const noexcept {
+		return EuclideanCmplVector3<E>(
+			xx * v.x_ + xy * v.y_ + xz * v.z_,
+			xy * v.x_ + yy * v.y_ + yz * v.z_,
+			xz * v.x_ + yz * v.y_ + zz * v.z_);
+	}
+};
+
+/*
+	Eigen decomposition of a symmetric 3x3 matrix.
+	values are in descending order and vectors[i] is the unit eigenvector of values[i]; the vectors form a right-handed basis.
+*/
+template<class E = double>
+struct EucEigen3 {
+	E values[3];
+	EuclideanCmplVector3<E> vectors[3];
+};
+
+/*
+	Best-fit line through a point set: the centroid and the unit direction of largest spread.
+*/
+template<class E = double>
+struct EucLine3 {
+	EuclideanCmplVector3<E> point;
+	EuclideanCmplVector3<E> direction;
+};
+
+//details.
+namespace detail {
+
+	constexpr size_t covariance_block = 256;
+	constexpr size_t covariance_grain = 65536;
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> eigen_cross(const E* a, const E* b) noexcept {
+		return EuclideanCmplVector3<E>(a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]);
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE E eigen_dot(const EuclideanCmplVector3<E>& a, const EuclideanCmplVector3<E>& b) noexcept {
+		return a.x_ * b.x_ + a.y_ * b.y_ + a.z_ * b.z_;
+	}
+
+	/*
+		@brief
+			Unit eigenvector of a simple eigenvalue: the longest cross product of two rows of A - value I.
+	*/
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> eigen_vector0(const EucSymmetric3<E>& a, E value) noexcept {
+		const E r0[3] = { a.xx - value, a.xy, a.xz };
+		const E r1[3] = { a.xy, a.yy - value, a.yz };
+		const E r2[3] = { a.xz, a.yz, a.zz - value };
+		const EuclideanCmplVector3<E> c[3] = { eigen_cross(r0, r1), eigen_cross(r0, r2), eigen_cross(r1, r2) };
+		size_t best = 0;
+		E best_len = E(0);
+		for (size_t i = 0; i < 3; ++i) {
+			const E len = eigen_dot(c[i], c[i]);
+			if (len > best_len) {
+				best_len = len;
+				best = i;
+			}
+		}
+		if (best_len <= E(0)) return EuclideanCmplVector3<E>(E(1), E(0), E(0));
+		const E inv = E(1) / _STD sqrt(best_len);
+		return EuclideanCmplVector3<E>(c[best].x_ * inv, c[best].y_ * inv, c[best].z_ * inv);
+	}
+
+	/*
+		@brief
+			Unit eigenvector of value that is orthogonal to the unit eigenvector w.
+			Solves the 2x2 problem in the plane orthogonal to w, which stays well defined for a repeated eigenvalue.
+	*/
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> eigen_vector1(const EucSymmetric3<E>& a, const EuclideanCmplVector3<E>& w, E value) noexcept {
+		EuclideanCmplVector3<E> u(E(0), E(0), E(0));
+		if (_STD fabs(w.x_) > _STD fabs(w.y_)) {
+			const E inv = E(1) / _STD sqrt(w.x_ * w.x_ + w.z_ * w.z_);
+			u = EuclideanCmplVector3<E>(-w.z_ * inv, E(0), w.x_ * inv);
+		}
+		else {
+			const E inv = E(1) / _STD sqrt(w.y_ * w.y_ + w.z_ * w.z_);
+			u = EuclideanCmplVector3<E>(E(0), w.z_ * inv, -w.y_ * inv);
+		}
+		const E wa[3] = { w.x_, w.y_, w.z_ }, ua[3] = { u.x_, u.y_, u.z_ };
+		const EuclideanCmplVector3<E> v = eigen_cross(wa, ua);
+
+		E m00 = eigen_dot(u, a * u) - value;
+		E m01 = eigen_dot(u, a * v);
+		E m11 = eigen_dot(v, a * v) - value;
+		const E abs00 = _STD fabs(m00), abs01 = _STD fabs(m01), abs11 = _STD fabs(m11);
+		E su, sv;
+		if (abs00 >= abs11) {
+			if (_STD max(abs00, abs01) <= E(0)) return u;
+			if (abs00 >= abs01) {
+				m01 /= m00;
+				m00 = E(1) / _STD sqrt(E(1) + m01 * m01);
+				m01 *= m00;
+			}
+			else {
+				m00 /= m01;
+				m01 = E(1) / _STD sqrt(E(1) + m00 * m00);
+				m00 *= m01;
+			}
+			su = m01;
+			sv = -m00;
+		}
+		else {
+			if (_STD max(abs11, abs01) <= E(0)) return u;
+			if (abs11 >= abs01) {
+				m01 /= m11;
+				m11 = E(1) / _STD sqrt(E(1) + m01 * m01);
+				m01 *= m11;
+			}
+			else {
+				m11 /= m01;
+				m01 = E(1) / _STD sqrt(E(1) + m11 * m11);
+				m11 *= m01;
+			}
+			su = m11;
+			sv = -m01;
+		}
+		return EuclideanCmplVector3<E>(su * u.x_ + sv * v.x_, su * u.y_ + sv * v.y_, su * u.z_ + sv * v.z_);
+	}
+
+}
+
+/*
+	@brief
+		Eigenvalues and eigenvectors of a symmetric 3x3 matrix in closed form.
+*/
+template<class E>
+EUCNODISCARD EUCVECTORINLINE EucEigen3<E> euc_eigen_symmetric(const EucSymmetric3<E>& m) noexcept {
+	static_assert(_STD is_floating_point_v<E>, "euc_eigen_symmetric needs a floating point type");
+	EucEigen3<E> r = {};
+
+	// Scale to [-1, 1] to keep the cubic well conditioned.
+	const E scale = _STD max({ _STD fabs(m.xx), _STD fabs(m.xy), _STD fabs(m.xz), _STD fabs(m.yy), _STD fabs(m.yz), _STD fabs(m.zz) });
+	if (scale <= E(0)) {
+		r.vectors[0] = EuclideanCmplVector3<E>(E(1), E(0), E(0));
+		r.vectors[1] = EuclideanCmplVector3<E>(E(0), E(1), E(0));
+		r.vectors[2] = EuclideanCmplVector3<E>(E(0), E(0), E(1));
+		return r;
+	}
+	const E inv_scale = E(1) / scale;
+	const EucSymmetric3<E> a = { m.xx * inv_scale, m.xy * inv_scale, m.xz * inv_scale, m.yy * inv_scale, m.yz * inv_scale, m.zz * inv_scale };
+
+	const E off = a.xy * a.xy + a.xz * a.xz + a.yz * a.yz;
+	E values[3];
+	EuclideanCmplVector3<E> vectors[3];
+	if (off <= E(0)) {
+		// Already diagonal.
+		values[0] = a.xx;
+		values[1] = a.yy;
+		values[2] = a.zz;
+		vectors[0] = EuclideanCmplVector3<E>(E(1), E(0), E(0));
+		vectors[1] = EuclideanCmplVector3<E>(E(0), E(1), E(0));
+		vectors[2] = EuclideanCmplVector3<E>(E(0), E(0), E(1));
+	}
+	else {
+		// A = q I + p B with tr(B) = 0, tr(B^2) = 6; the eigenvalues of B are 2 cos(angle + 2 pi k / 3).
+		const E q = (a.xx + a.yy + a.zz) / E(3);
+		const E b00 = a.xx - q, b11 = a.yy - q, b22 = a.zz - q;
+		const E p = _STD sqrt((b00 * b00 + b11 * b11 + b22 * b22 + E(2) * off) / E(6));
+		const E c00 = b11 * b22 - a.yz * a.yz;
+		const E c01 = a.xy * b22 - a.yz * a.xz;
+		const E c02 = a.xy * a.yz - b11 * a.xz;
+		const E half_det = _STD clamp((b00 * c00 - a.xy * c01 + a.xz * c02) / (E(2) * p * p * p), E(-1), E(1));
+		const E angle = _STD acos(half_det) / E(3);
+		const E two_thirds_pi = E(2.09439510239319549230842892218633526);
+		const E beta2 = _STD cos(angle) * E(2);
+		const E beta0 = _STD cos(angle + two_thirds_pi) * E(2);
+		const E beta1 = -(beta0 + beta2);
+		values[0] = q + p * beta0;
+		values[1] = q + p * beta1;
+		values[2] = q + p * beta2;
+		// Start from the eigenvalue farthest from the other two.
+		if (half_det >= E(0)) {
+			vectors[2] = detail::eigen_vector0(a, values[2]);
+			vectors[1] = detail::eigen_vector1(a, vectors[2], values[1]);
+			const E v2[3] = { vectors[2].x_, vectors[2].y_, vectors[2].z_ }, v1[3] = { vectors[1].x_, vectors[1].y_, vectors[1].z_ };
+			vectors[0] = detail::eigen_cross(v1, v2);
+		}
+		else {
+			vectors[0] = detail::eigen_vector0(a, values[0]);
+			vectors[1] = detail::eigen_vector1(a, vectors[0], values[1]);
+			const E v0[3] = { vectors[0].x_, vectors[0].y_, vectors[0].z_ }, v1[3] = { vectors[1].x_, vectors[1].y_, vectors[1].z_ };
+			vectors[2] = detail::eigen_cross(v0, v1);
+		}
+	}
+
+	size_t order[3] = { 0, 1, 2 };
+	_STD sort(order, order + 3, [&values](size_t l, size_t r) { return values[l] > values[r]; });
+	for (size_t i = 0; i < 3; ++i) {
+		r.values[i] = values[order[i]] * scale;
+		r.vectors[i] = vectors[order[i]];
+	}
+	// Keep the basis right-handed after sorting.
+	const E v0[3] = { r.vectors[0].x_, r.vectors[0].y_, r.vectors[0].z_ }, v1[3] = { r.vectors[1].x_, r.vectors[1].y_, r.vectors[1].z_ };
+	r.vectors[2] = detail::eigen_cross(v0, v1);
+	return r;
+}
+
+/*
+	Streaming covariance of 3D points.
+	E is the accumulation type; points of any 3D vector type are converted to it.
+*/
+template<class E = double>
+class EucCovariance3 {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucCovariance3 needs a floating point type");
+
+protected:
+
+	size_t count_;
+	E mean_[3];
+	// Sums of centered products: xx, xy, xz, yy, yz, zz.
+	E m2_[6];
+
+	/*
+		@brief
+			Fold in a block with n points, mean m and centered sums s (Chan et al.).
+	*/
+	EUCVECTORINLINE void combine(size_t n, const E* m, const E* s) noexcept {
+		if (n == 0) return;
+		if (count_ == 0) {
+			count_ = n;
+			_STD copy(m, m + 3, mean_);
+			_STD copy(s, s + 6, m2_);
+			return;
+		}
+		const size_t total = count_ + n;
+		const E na = static_cast<E>(count_), nb = static_cast<E>(n), nt = static_cast<E>(total);
+		const E d[3] = { m[0] - mean_[0], m[1] - mean_[1], m[2] - mean_[2] };
+		const E f = na * nb / nt;
+		m2_[0] += s[0] + d[0] * d[0] * f;
+		m2_[1] += s[1] + d[0] * d[1] * f;
+		m2_[2] += s[2] + d[0] * d[2] * f;
+		m2_[3] += s[3] + d[1] * d[1] * f;
+		m2_[4] += s[4] + d[1] * d[2] * f;
+		m2_[5] += s[5] + d[2] * d[2] * f;
+		for (size_t k = 0; k < 3; ++k) mean_[k] += d[k] * nb / nt;
+		count_ = total;
+	}
+
+public:
+
+	EucCovariance3() noexcept
+		: count_(0)
+		, mean_{}
+		, m2_{}
+	{}
+
+	EUCVECTORINLINE void clear() noexcept {
+		*this = EucCovariance3();
+	}
+
+	/*
+		@brief
+			Add one point (Welford update).
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void add(const V& p) noexcept {
+		const E x[3] = { static_cast<E>(detail::euc_get<0>(p)), static_cast<E>(detail::euc_get<1>(p)), static_cast<E>(detail::euc_get<2>(p)) };
+		++count_;
+		const E inv = E(1) / static_cast<E>(count_);
+		E d[3];
+		for (size_t k = 0; k < 3; ++k) {
+			d[k] = x[k] - mean_[k];
+			mean_[k] += d[k] * inv;
+		}
+		// d * (x - new mean)
+		const E e[3] = { x[0] - mean_[0], x[1] - mean_[1], x[2] - mean_[2] };
+		m2_[0] += d[0] * e[0];
+		m2_[1] += d[0] * e[1];
+		m2_[2] += d[0] * e[2];
+		m2_[3] += d[1] * e[1];
+		m2_[4] += d[1] * e[2];
+		m2_[5] += d[2] * e[2];
+	}
+
+	/*
+		@brief
+			Add count points.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void add(const V* points, size_t count) noexcept {
+		E x[detail::covariance_block], y[detail::covariance_block], z[detail::covariance_block];
+		for (size_t b = 0; b < count; b += detail::covariance_block) {
+			const size_t n = _STD min(detail::covariance_block, count - b);
+			E sx = E(0), sy = E(0), sz = E(0);
+			for (size_t i = 0; i < n; ++i) {
+				x[i] = static_cast<E>(detail::euc_get<0>(points[b + i]));
+				y[i] = static_cast<E>(detail::euc_get<1>(points[b + i]));
+				z[i] = static_cast<E>(detail::euc_get<2>(points[b + i]));
+				sx += x[i];
+				sy += y[i];
+				sz += z[i];
+			}
+			const E inv = E(1) / static_cast<E>(n);
+			const E m[3] = { sx * inv, sy * inv, sz * inv };
+			E s[6] = {};
+			for (size_t i = 0; i < n; ++i) {
+				const E dx = x[i] - m[0], dy = y[i] - m[1], dz = z[i] - m[2];
+				s[0] += dx * dx;
+				s[1] += dx * dy;
+				s[2] += dx * dz;
+				s[3] += dy * dy;
+				s[4] += dy * dz;
+				s[5] += dz * dz;
+			}
+			combine(n, m, s);
+		}
+	}
+
+	/*
+		@brief
+			Merge the points of another accumulator into this one.
+	*/
+	EUCVECTORINLINE void merge(const EucCovariance3& other) noexcept {
+		combine(other.count_, other.mean_, other.m2_);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t count() const noexcept { return count_; }
+
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> mean() const noexcept {
+		return EuclideanCmplVector3<E>(mean_[0], mean_[1], mean_[2]);
+	}
+
+	/*
+		@brief
+			Covariance matrix. sample : divide by count - 1 instead of count.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucSymmetric3<E> covariance(bool sample = false) const noexcept {
+		const size_t div = sample ? count_ - (count_ > 0) : count_;
+		const E inv = div > 0 ? E(1) / static_cast<E>(div) : E(0);
+		return EucSymmetric3<E>{ m2_[0] * inv, m2_[1] * inv, m2_[2] * inv, m2_[3] * inv, m2_[4] * inv, m2_[5] * inv };
+	}
+
+	/*
+		@brief
+			Principal axes: eigen decomposition of the covariance.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucEigen3<E> principal_axes() const noexcept {
+		return euc_eigen_symmetric(covariance());
+	}
+
+	/*
+		@brief
+			Best-fit plane (a, b, c, d) with unit normal (a, b, c) along the axis of least spread, through the mean.
+			Same convention as EucFrustum planes: a*x + b*y + c*z + d is the signed distance.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector4<E> plane() const noexcept {
+		const auto n = principal_axes().vectors[2];
+		return EuclideanCmplVector4<E>(n.x_, n.y_, n.z_, -(n.x_ * mean_[0] + n.y_ * mean_[1] + n.z_ * mean_[2]));
+	}
+
+	/*
+		@brief
+			Best-fit line through the mean along the axis of largest spread.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucLine3<E> line() const noexcept {
+		return EucLine3<E>{ mean(), principal_axes().vectors[0] };
+	}
+};
+
+/*
+	@brief
+		Covariance accumulator of count points. Large inputs are split across threads and merged.
+*/
+template<class E = double, class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCNODISCARD EUCVECTORINLINE EucCovariance3<E> euc_covariance(const V* points, size_t count, unsigned threads = 0) {
+	const size_t chunks = detail::chunk_count(count, detail::covariance_grain, threads);
+	if (chunks <= 1) {
+		EucCovariance3<E> acc;
+		acc.add(points, count);
+		return acc;
+	}
+	_STD vector<EucCovariance3<E>> partial(chunks);
+	detail::parallel_invoke(chunks, [&](size_t ch) {
+		const size_t b = count * ch / chunks, e = count * (ch + 1) / chunks;
+		partial[ch].add(points + b, e - b);
+	});
+	for (size_t ch = 1; ch < chunks; ++ch) partial[0].merge(partial[ch]);
+	return partial[0];
+}
+
+/*
+	@brief
+		One accumulator per cluster. Cluster c is points[offsets[c], offsets[c + 1]).
+		Clusters are spread over threads; each is reduced on a single thread.
+*/
+template<class E = double, class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCVECTORINLINE void euc_covariance_clusters(const V* points, const size_t* offsets, size_t clusters, EucCovariance3<E>* out, unsigned threads = 0) {
+	const size_t total = clusters > 0 ? offsets[clusters] - offsets[0] : 0;
+	const size_t grain = clusters > 0 ? _STD max<size_t>(1, clusters * detail::covariance_grain / _STD max<size_t>(total, 1)) : 1;
+	detail::parallel_for(clusters, grain, threads, [&](size_t b, size_t e) {
+		for (size_t c = b; c < e; ++c) {
+			out[c].clear();
+			out[c].add(points + offsets[c], offsets[c + 1] - offsets[c]);
+		}
+	});
+}
+
+/*
+	@brief
+		Best-fit plane of count points; see EucCovariance3::plane.
+*/
+template<class E = double, class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector4<E> euc_fit_plane(const V* points, size_t count, unsigned threads = 0) {
+	return euc_covariance<E>(points, count, threads).plane();
+}
+
+/*
+	@brief
+		Best-fit line of count points; see EucCovariance3::line.
+*/
+template<class E = double, class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCNODISCARD EUCVECTORINLINE EucLine3<E> euc_fit_line(const V* points, size_t count, unsigned threads = 0) {
+	return euc_covariance<E>(points, count, threads).line();
+}
+
+//name space end.
+}
+
+#endif
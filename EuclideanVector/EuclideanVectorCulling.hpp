@@ -0,0 +1,328 @@
+//
+//	EuclideanVector Culling
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Batched frustum culling of bounding spheres and axis aligned boxes.
+//
+//	Planes are EuclideanCmplVector4 (a, b, c, d) with a*x + b*y + c*z + d >= 0 on the inside. Volumes are kept in SoA
+//	containers (EucSphereSoA, EucAabbSoA). Each plane test covers 8 volumes in one AVX instruction sequence.
+//	The outside mask of each group is built plane by plane, and the remaining planes are skipped as soon as all
+//	8 are outside. Surviving indices are written to a compacted visible list in ascending order.
+//	Chunks of volumes run on separate threads, each compacting into its own slice of the output. The slices are then
+//	joined, so a frame makes no allocation once the list has reached its size.
+//
+//	A volume is visible when it is inside or intersects every plane (conservative, as usual for culling).
+//.
+
+#ifndef THL_EUCLID_VECTOR_CULLING_HPP
+#define THL_EUCLID_VECTOR_CULLING_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Up to 8 planes.
+*/
+template<class E = float>
+class EucFrustum {
+public:
+
+	static constexpr size_t MaxPlanes = 8;
+
+protected:
+
+	EuclideanCmplVector4<E> planes_[MaxPlanes];
+	size_t count_;
+
+public:
+
+	EucFrustum() noexcept
+		: count_(0)
+	{}
+
+	EucFrustum(const EuclideanCmplVector4<E>* planes, size_t count) noexcept
+		: count_(count < MaxPlanes ? count : MaxPlanes)
+	{
+		for (size_t i = 0; i < count_; ++i) planes_[i] = planes[i];
+	}
+
+	/*
+		@brief
+			Extract the six planes of a row-major view-projection matrix (clip = M * p, column vectors).
+			zero_to_one : depth range [0, 1] (Direct3D, Vulkan) instead of [-1, 1] (OpenGL).
+	*/
+	EUCNODISCARD static EUCVECTORINLINE EucFrustum from_matrix(const E* m, bool zero_to_one = true) noexcept {
+		const auto plane = [m](size_t r, E sign) {
+			return EuclideanCmplVector4<E>(m[12] + sign * m[r * 4], m[13] + sign * m[r * 4 + 1], m[14] + sign * m[r * 4 + 2], m[15] + sign * m[r * 4 + 3]);
+		};
+		const EuclideanCmplVector4<E> p[6] = {
+			plane(0, E(1)), plane(0, E(-1)),
+			plane(1, E(1)), plane(1, E(-1)),
+			zero_to_one ? EuclideanCmplVector4<E>(m[8], m[9], m[10], m[11]) : plane(2, E(1)),
+			plane(2, E(-1)),
+		};
+		EucFrustum f(p, 6);
+		f.normalize();
+		return f;
+	}
+
+	/*
+		@brief
+			Scale every plane so that (a, b, c) has unit length; distances then come out in world units.
+	*/
+	EUCVECTORINLINE void normalize() noexcept {
+		for (size_t i = 0; i < count_; ++i) {
+			auto& p = planes_[i];
+			const E len = _STD sqrt(p.x_ * p.x_ + p.y_ * p.y_ + p.z_ * p.z_);
+			if (len > E(0)) {
+				p.x_ /= len;
+				p.y_ /= len;
+				p.z_ /= len;
+				p.w_ /= len;
+			}
+		}
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept { return count_; }
+	EUCNODISCARD EUCVECTORINLINE const EuclideanCmplVector4<E>& operator[](size_t i) const noexcept { return planes_[i]; }
+};
+
+/*
+	Bounding spheres in SoA form.
+*/
+template<class E = float>
+struct EucSphereSoA {
+	_STD vector<E> x, y, z, r;
+
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept { return x.size(); }
+
+	EUCVECTORINLINE void clear() noexcept {
+		x.clear();
+		y.clear();
+		z.clear();
+		r.clear();
+	}
+
+	EUCVECTORINLINE void reserve(size_t count) {
+		x.reserve(count);
+		y.reserve(count);
+		z.reserve(count);
+		r.reserve(count);
+	}
+
+	EUCVECTORINLINE void push_back(const EuclideanCmplVector3<E>& center, E radius) {
+		x.push_back(center.x_);
+		y.push_back(center.y_);
+		z.push_back(center.z_);
+		r.push_back(radius);
+	}
+
+	EUCVECTORINLINE void assign(const EuclideanCmplVector3<E>* centers, const E* radii, size_t count) {
+		x.resize(count);
+		y.resize(count);
+		z.resize(count);
+		r.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			x[i] = centers[i].x_;
+			y[i] = centers[i].y_;
+			z[i] = centers[i].z_;
+			r[i] = radii[i];
+		}
+	}
+};
+
+/*
+	Axis aligned boxes in SoA form, stored as center and half extent.
+*/
+template<class E = float>
+struct EucAabbSoA {
+	_STD vector<E> cx, cy, cz, ex, ey, ez;
+
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept { return cx.size(); }
+
+	EUCVECTORINLINE void clear() noexcept {
+		for (auto* v : { &cx, &cy, &cz, &ex, &ey, &ez }) v->clear();
+	}
+
+	EUCVECTORINLINE void reserve(size_t count) {
+		for (auto* v : { &cx, &cy, &cz, &ex, &ey, &ez }) v->reserve(count);
+	}
+
+	template<class B, meta::if_t<meta::is_euc_vector_v<B> && meta::euc_dimension_v<B> == 3> = 0>
+	EUCVECTORINLINE void push_back(const B& min, const B& max) {
+		const E x0 = static_cast<E>(detail::euc_get<0>(min)), y0 = static_cast<E>(detail::euc_get<1>(min)), z0 = static_cast<E>(detail::euc_get<2>(min));
+		const E x1 = static_cast<E>(detail::euc_get<0>(max)), y1 = static_cast<E>(detail::euc_get<1>(max)), z1 = static_cast<E>(detail::euc_get<2>(max));
+		cx.push_back((x1 + x0) / E(2));
+		cy.push_back((y1 + y0) / E(2));
+		cz.push_back((z1 + z0) / E(2));
+		ex.push_back((x1 - x0) / E(2));
+		ey.push_back((y1 - y0) / E(2));
+		ez.push_back((z1 - z0) / E(2));
+	}
+
+	EUCVECTORINLINE void assign(const EuclideanCmplVector3<E>* mins, const EuclideanCmplVector3<E>* maxs, size_t count) {
+		clear();
+		reserve(count);
+		for (size_t i = 0; i < count; ++i) push_back(mins[i], maxs[i]);
+	}
+};
+
+//details.
+namespace detail {
+
+	constexpr size_t cull_grain = 16384;
+
+	/*
+		Plane coefficients broadcast once per call.
+	*/
+	template<class E>
+	struct CullPlanes {
+		E a[EucFrustum<E>::MaxPlanes], b[EucFrustum<E>::MaxPlanes], c[EucFrustum<E>::MaxPlanes], d[EucFrustum<E>::MaxPlanes];
+		size_t count;
+
+		explicit CullPlanes(const EucFrustum<E>& f) noexcept
+			: count(f.size())
+		{
+			for (size_t p = 0; p < count; ++p) {
+				a[p] = f[p].x_;
+				b[p] = f[p].y_;
+				c[p] = f[p].z_;
+				d[p] = f[p].w_;
+			}
+		}
+	};
+
+	/*
+		@brief
+			Cull volumes [i0, i1) and write the visible indices to out. Returns their count.
+			Sphere: radius = r[i]. Box: radius = |a| ex + |b| ey + |c| ez.
+	*/
+	template<bool Box, class E>
+	EUCVECTORINLINE size_t cull_range(const CullPlanes<E>& pl, const E* x, const E* y, const E* z,
+		const E* r0, const E* r1, const E* r2, size_t i0, size_t i1, uint32_t* out) noexcept {
+		size_t n = 0;
+		size_t i = i0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			const __m256 sign = _mm256_set1_ps(-0.0f);
+			for (; i + 8 <= i1; i += 8) {
+				const __m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+				__m256 ra, rb, rc;
+				if constexpr (Box) {
+					ra = _mm256_loadu_ps(r0 + i);
+					rb = _mm256_loadu_ps(r1 + i);
+					rc = _mm256_loadu_ps(r2 + i);
+				}
+				else {
+					ra = _mm256_xor_ps(_mm256_loadu_ps(r0 + i), sign);	// -r
+					rb = rc = ra;
+				}
+				int outside = 0;
+				for (size_t p = 0; p < pl.count && outside != 0xff; ++p) {
+					__m256 dist = _mm256_add_ps(_mm256_mul_ps(vx, _mm256_set1_ps(pl.a[p])), _mm256_set1_ps(pl.d[p]));
+					dist = _mm256_add_ps(dist, _mm256_mul_ps(vy, _mm256_set1_ps(pl.b[p])));
+					dist = _mm256_add_ps(dist, _mm256_mul_ps(vz, _mm256_set1_ps(pl.c[p])));
+					__m256 limit;
+					if constexpr (Box) {
+						limit = _mm256_mul_ps(ra, _mm256_set1_ps(-_STD fabs(pl.a[p])));
+						limit = _mm256_sub_ps(limit, _mm256_mul_ps(rb, _mm256_set1_ps(_STD fabs(pl.b[p]))));
+						limit = _mm256_sub_ps(limit, _mm256_mul_ps(rc, _mm256_set1_ps(_STD fabs(pl.c[p]))));
+					}
+					else {
+						limit = ra;
+					}
+					outside |= _mm256_movemask_ps(_mm256_cmp_ps(dist, limit, _CMP_LT_OQ));
+				}
+				for (int keep = ~outside & 0xff; keep; keep &= keep - 1) {
+					int lane = 0;
+					while (!((keep >> lane) & 1)) ++lane;
+					out[n++] = static_cast<uint32_t>(i + static_cast<size_t>(lane));
+				}
+			}
+		}
+#endif
+		for (; i < i1; ++i) {
+			bool visible = true;
+			for (size_t p = 0; p < pl.count; ++p) {
+				const E dist = pl.a[p] * x[i] + pl.b[p] * y[i] + pl.c[p] * z[i] + pl.d[p];
+				E radius;
+				if constexpr (Box) {
+					radius = _STD fabs(pl.a[p]) * r0[i] + _STD fabs(pl.b[p]) * r1[i] + _STD fabs(pl.c[p]) * r2[i];
+				}
+				else {
+					radius = r0[i];
+				}
+				if (dist < -radius) {
+					visible = false;
+					break;
+				}
+			}
+			if (visible) out[n++] = static_cast<uint32_t>(i);
+		}
+		return n;
+	}
+
+	template<bool Box, class E>
+	EUCVECTORINLINE size_t cull_all(const EucFrustum<E>& frustum, const E* x, const E* y, const E* z,
+		const E* r0, const E* r1, const E* r2, size_t count, _STD vector<uint32_t>& visible, unsigned threads) {
+		visible.resize(count);
+		if (count == 0) return 0;
+		const CullPlanes<E> planes(frustum);
+		const size_t chunks = chunk_count(count, cull_grain, threads);
+		// Chunk c compacts into visible[begin(c), ...); the slices are then joined in order.
+		_STD vector<size_t> found(chunks);
+		parallel_invoke(chunks, [&](size_t ch) {
+			const size_t i0 = count * ch / chunks, i1 = count * (ch + 1) / chunks;
+			found[ch] = cull_range<Box>(planes, x, y, z, r0, r1, r2, i0, i1, visible.data() + i0);
+		});
+		size_t n = found[0];
+		for (size_t ch = 1; ch < chunks; ++ch) {
+			const size_t i0 = count * ch / chunks;
+			_STD copy(visible.begin() + i0, visible.begin() + i0 + found[ch], visible.begin() + n);
+			n += found[ch];
+		}
+		visible.resize(n);
+		return n;
+	}
+
+}
+
+/*
+	@brief
+		Write the indices of the spheres that are not fully outside the frustum to visible, in ascending order.
+		Returns their count. visible keeps its capacity between calls.
+*/
+template<class E>
+EUCVECTORINLINE size_t cull_spheres(const EucFrustum<E>& frustum, const EucSphereSoA<E>& spheres, _STD vector<uint32_t>& visible, unsigned threads = 0) {
+	return detail::cull_all<false, E>(frustum, spheres.x.data(), spheres.y.data(), spheres.z.data(),
+		spheres.r.data(), nullptr, nullptr, spheres.size(), visible, threads);
+}
+
+/*
+	@brief
+		Write the indices of the boxes that are not fully outside the frustum to visible, in ascending order.
+		Returns their count.
+*/
+template<class E>
+EUCVECTORINLINE size_t cull_aabbs(const EucFrustum<E>& frustum, const EucAabbSoA<E>& boxes, _STD vector<uint32_t>& visible, unsigned threads = 0) {
+	return detail::cull_all<true, E>(frustum, boxes.cx.data(), boxes.cy.data(), boxes.cz.data(),
+		boxes.ex.data(), boxes.ey.data(), boxes.ez.data(), boxes.size(), visible, threads);
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,277 @@
+//
+//	EuclideanVector Distance
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	All-pairs squared distances between two arrays of EuclideanCmplVector2/3/4 (float or double).
+//
+//	Each distance uses |a|^2 + |b|^2 - 2a.b rather than eucnorm_squared(a - b). The right-hand set is packed once
+//	into SoA columns with precomputed norms, and the output is produced in register tiles of
+//	4 rows x 8 columns. Each column load serves four rows.
+//	Row tiles are spread over threads. Each tile sweeps the whole packed set; the kernels are bound by the
+//	output stores (full matrix) or the heap updates (top-k), not by re-reading the packed columns.
+//
+//	Results are clamped at zero. Cancellation in the identity makes distances between nearly equal points
+//	less accurate than (a - b).eucnorm_squared(). Where that matters, re-check the few candidates that survive.
+//
+//	pairwise_topk keeps the k nearest references for every query while streaming over the same tiles,
+//	without materializing the full matrix.
+//.
+
+#ifndef THL_EUCLID_VECTOR_DISTANCE_HPP
+#define THL_EUCLID_VECTOR_DISTANCE_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+//meta functions.
+namespace meta {
+
+	template<class V>
+	constexpr bool is_euc_distance_operand_v = [] {
+		if constexpr (is_euc_flat_v<V>) {
+			return _STD is_floating_point_v<euc_elem_t<V>> && euc_dimension_v<V> >= 2;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	constexpr size_t dist_tile_rows = 4;
+	constexpr size_t dist_tile_cols = 8;
+	constexpr size_t dist_block_cols = 512;
+
+	/*
+		Right-hand set in SoA form, padded to a multiple of dist_tile_cols.
+	*/
+	template<class E, size_t D>
+	struct DistPackedSet {
+		_STD vector<E> comp[D];
+		_STD vector<E> norm;
+		size_t count;
+
+		template<class V>
+		void pack(const V* src, size_t n) {
+			count = n;
+			const size_t padded = (n + dist_tile_cols - 1) / dist_tile_cols * dist_tile_cols;
+			for (size_t k = 0; k < D; ++k) comp[k].assign(padded, E(0));
+			norm.assign(padded, E(0));
+			const E* flat = reinterpret_cast<const E*>(src);
+			for (size_t j = 0; j < n; ++j) {
+				E sum = E(0);
+				for (size_t k = 0; k < D; ++k) {
+					const E v = flat[j * D + k];
+					comp[k][j] = v;
+					sum += v * v;
+				}
+				norm[j] = sum;
+			}
+		}
+	};
+
+	/*
+		@brief
+			out[r * ld + j - col0] = |a_r|^2 + |b_j|^2 - 2 a_r.b_j for r < rows (<= 4) and j in [j0, j1).
+			a holds rows * D components, an holds rows norms.
+	*/
+	template<class E, size_t D>
+	EUCVECTORINLINE void dist_tile(const E* a, const E* an, size_t rows, const DistPackedSet<E, D>& b, size_t j0, size_t j1, E* out, size_t ld, size_t col0) noexcept {
+		size_t j = j0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			if (rows == dist_tile_rows) {
+				__m256 ak[dist_tile_rows][D];
+				__m256 anv[dist_tile_rows];
+				for (size_t r = 0; r < dist_tile_rows; ++r) {
+					for (size_t k = 0; k < D; ++k) ak[r][k] = _mm256_set1_ps(-2.0f * a[r * D + k]);
+					anv[r] = _mm256_set1_ps(an[r]);
+				}
+				const __m256 zero = _mm256_setzero_ps();
+				for (; j + dist_tile_cols <= j1; j += dist_tile_cols) {
+					const __m256 bn = _mm256_loadu_ps(b.norm.data() + j);
+					__m256 acc[dist_tile_rows];
+					for (size_t r = 0; r < dist_tile_rows; ++r) acc[r] = _mm256_add_ps(anv[r], bn);
+					for (size_t k = 0; k < D; ++k) {
+						const __m256 bk = _mm256_loadu_ps(b.comp[k].data() + j);
+						for (size_t r = 0; r < dist_tile_rows; ++r) {
+#if defined(THL_EUC_FMA)
+							acc[r] = _mm256_fmadd_ps(ak[r][k], bk, acc[r]);
+#else
+							acc[r] = _mm256_add_ps(acc[r], _mm256_mul_ps(ak[r][k], bk));
+#endif
+						}
+					}
+					for (size_t r = 0; r < dist_tile_rows; ++r) _mm256_storeu_ps(out + r * ld + (j - col0), _mm256_max_ps(acc[r], zero));
+				}
+			}
+		}
+#endif
+		for (; j < j1; ++j) {
+			for (size_t r = 0; r < rows; ++r) {
+				E acc = an[r] + b.norm[j];
+				for (size_t k = 0; k < D; ++k) acc -= E(2) * a[r * D + k] * b.comp[k][j];
+				out[r * ld + (j - col0)] = acc > E(0) ? acc : E(0);
+			}
+		}
+	}
+
+	template<class E, size_t D, class V>
+	EUCVECTORINLINE void dist_load_rows(const V* src, size_t i, size_t rows, E* a, E* an) noexcept {
+		const E* flat = reinterpret_cast<const E*>(src);
+		for (size_t r = 0; r < rows; ++r) {
+			E sum = E(0);
+			for (size_t k = 0; k < D; ++k) {
+				a[r * D + k] = flat[(i + r) * D + k];
+				sum += a[r * D + k] * a[r * D + k];
+			}
+			an[r] = sum;
+		}
+	}
+
+}
+
+/*
+	@brief
+		out[i * ld + j] = (a[i] - b[j]).eucnorm_squared() for every i < na, j < nb.
+		out must hold na rows of ld >= nb elements.
+*/
+template<class V, meta::if_t<meta::is_euc_distance_operand_v<V>> = 0>
+EUCVECTORINLINE void pairwise_distance_squared(const V* a, size_t na, const V* b, size_t nb, meta::euc_elem_t<V>* out, size_t ld = 0, unsigned threads = 0) {
+	EUCINSTRUMENT_SCOPE("pairwise_distance_squared");
+	using E = meta::euc_elem_t<V>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	constexpr size_t MR = detail::dist_tile_rows;
+	if (ld == 0) ld = nb;
+	if (na == 0 || nb == 0) return;
+
+	detail::DistPackedSet<E, D> packed;
+	packed.pack(b, nb);
+
+	const size_t row_tiles = (na + MR - 1) / MR;
+	detail::parallel_for(row_tiles, 16, threads, [&](size_t t0, size_t t1) {
+		E ra[MR * D], rn[MR];
+		for (size_t t = t0; t < t1; ++t) {
+			const size_t i = t * MR;
+			const size_t rows = (na - i) < MR ? (na - i) : MR;
+			detail::dist_load_rows<E, D>(a, i, rows, ra, rn);
+			detail::dist_tile<E, D>(ra, rn, rows, packed, 0, nb, out + i * ld, ld, 0);
+		}
+	});
+}
+
+/*
+	A thread count in place of out is rejected instead of being taken as a null pointer.
+	Use pairwise_distance_squared_matrix to get the distances as a std::vector.
+*/
+template<class V, meta::if_t<meta::is_euc_distance_operand_v<V>> = 0>
+void pairwise_distance_squared(const V*, size_t, const V*, size_t, int, size_t = 0, unsigned = 0) = delete;
+
+/*
+	@brief
+		Squared distances as a std::vector, na x nb row-major.
+		Named apart from pairwise_distance_squared so that a literal 0 for threads cannot be taken as a null out pointer.
+*/
+template<class V, meta::if_t<meta::is_euc_distance_operand_v<V>> = 0>
+EUCNODISCARD_MSG("The distance matrix was ignored. This may be an unintended call.")
+	EUCVECTORINLINE _STD vector<meta::euc_elem_t<V>> pairwise_distance_squared_matrix(const V* a, size_t na, const V* b, size_t nb, unsigned threads = 0) {
+	_STD vector<meta::euc_elem_t<V>> out(na * nb);
+	pairwise_distance_squared(a, na, b, nb, out.data(), nb, threads);
+	return out;
+}
+
+/*
+	@brief
+		For every query i, write the k nearest references in ascending order of squared distance:
+		out_index[i * k + n] and out_distance[i * k + n] for n < k.
+		If k exceeds ref_count, the remaining slots get UINT32_MAX with an infinite distance.
+		Only a tile of 4 x 512 distances per thread exists at any time.
+*/
+template<class V, meta::if_t<meta::is_euc_distance_operand_v<V>> = 0>
+EUCVECTORINLINE void pairwise_topk(const V* queries, size_t query_count, const V* refs, size_t ref_count, size_t k,
+	uint32_t* out_index, meta::euc_elem_t<V>* out_distance, unsigned threads = 0) {
+	EUCINSTRUMENT_SCOPE("pairwise_topk");
+	using E = meta::euc_elem_t<V>;
+	using Entry = _STD pair<E, uint32_t>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	constexpr size_t MR = detail::dist_tile_rows;
+	constexpr size_t NB = detail::dist_block_cols;
+	if (query_count == 0 || k == 0) return;
+
+	detail::DistPackedSet<E, D> packed;
+	packed.pack(refs, ref_count);
+
+	const size_t row_tiles = (query_count + MR - 1) / MR;
+	detail::parallel_for(row_tiles, 4, threads, [&](size_t t0, size_t t1) {
+		E ra[MR * D], rn[MR];
+		_STD vector<E> tile(MR * NB);
+		_STD vector<Entry> heaps[MR];
+		for (auto& heap : heaps) heap.reserve(k);
+
+		for (size_t t = t0; t < t1; ++t) {
+			const size_t i = t * MR;
+			const size_t rows = (query_count - i) < MR ? (query_count - i) : MR;
+			detail::dist_load_rows<E, D>(queries, i, rows, ra, rn);
+			for (auto& heap : heaps) heap.clear();
+
+			for (size_t j0 = 0; j0 < ref_count; j0 += NB) {
+				const size_t j1 = (j0 + NB) < ref_count ? (j0 + NB) : ref_count;
+				detail::dist_tile<E, D>(ra, rn, rows, packed, j0, j1, tile.data(), NB, j0);
+				for (size_t r = 0; r < rows; ++r) {
+					auto& heap = heaps[r];
+					const E* row = tile.data() + r * NB;
+					for (size_t j = j0; j < j1; ++j) {
+						if (heap.size() < k) {
+							heap.emplace_back(row[j - j0], static_cast<uint32_t>(j));
+							_STD push_heap(heap.begin(), heap.end());
+						}
+						else if (row[j - j0] < heap.front().first) {
+							_STD pop_heap(heap.begin(), heap.end());
+							heap.back() = Entry(row[j - j0], static_cast<uint32_t>(j));
+							_STD push_heap(heap.begin(), heap.end());
+						}
+					}
+				}
+			}
+
+			for (size_t r = 0; r < rows; ++r) {
+				auto& heap = heaps[r];
+				_STD sort_heap(heap.begin(), heap.end());
+				uint32_t* idx = out_index + (i + r) * k;
+				E* dist = out_distance + (i + r) * k;
+				for (size_t n = 0; n < k; ++n) {
+					if (n < heap.size()) {
+						idx[n] = heap[n].second;
+						dist[n] = heap[n].first;
+					}
+					else {
+						idx[n] = UINT32_MAX;
+						dist[n] = _STD numeric_limits<E>::infinity();
+					}
+				}
+			}
+		}
+	});
+}
+
+//name space end.
+}
+
+#endif
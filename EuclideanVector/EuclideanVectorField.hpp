@@ -0,0 +1,430 @@
+//
+//	EuclideanVector Field
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Dense 3D vector field on a regular grid with batched trilinear and tricubic sampling.
+//
+//	Cells are stored in 8x8x8 bricks, and each cell is padded to four elements (x, y, z, 0).
+//	The neighbours of a sample are therefore close in memory along all three axes, and one cell is one
+//	SSE (float) or AVX (double) register.
+//	The address of cell (i, j, k) separates into X(i) + Y(j) + Z(k), so a sample computes 2 (trilinear) or
+//	4 (tricubic) offsets per axis and adds them. It does not evaluate a full index per corner.
+//	Batches convert positions to cell coordinates 8 at a time (AVX, float), then blend the corners as whole
+//	registers with broadcast weights.
+//
+//	Positions are in world units: cell (i, j, k) sits at origin + (i, j, k) * spacing.
+//	Samples outside the grid are clamped to the border cells. The tricubic filter is Catmull-Rom, so it
+//	interpolates the cell values.
+//.
+
+#ifndef THL_EUCLID_VECTOR_FIELD_HPP
+#define THL_EUCLID_VECTOR_FIELD_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+//details.
+namespace detail {
+
+	constexpr size_t field_brick_bits = 3;
+	constexpr size_t field_brick = size_t(1) << field_brick_bits;
+	constexpr size_t field_brick_mask = field_brick - 1;
+	constexpr size_t field_block = 64;
+	constexpr size_t field_grain = 16384;
+
+	/*
+		One padded cell as a register: acc + w * v and conversion back to a vector.
+	*/
+	template<class E>
+	struct FieldCell {
+		E v[4];
+
+		EUCNODISCARD static EUCVECTORINLINE FieldCell zero() noexcept { return FieldCell{ { E(0), E(0), E(0), E(0) } }; }
+		EUCNODISCARD static EUCVECTORINLINE FieldCell madd(const FieldCell& acc, E w, const E* cell) noexcept {
+			return FieldCell{ { acc.v[0] + w * cell[0], acc.v[1] + w * cell[1], acc.v[2] + w * cell[2], E(0) } };
+		}
+		EUCNODISCARD static EUCVECTORINLINE FieldCell scale(const FieldCell& acc, E w, const FieldCell& s) noexcept {
+			return FieldCell{ { acc.v[0] + w * s.v[0], acc.v[1] + w * s.v[1], acc.v[2] + w * s.v[2], E(0) } };
+		}
+		EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> vector() const noexcept { return EuclideanCmplVector3<E>(v[0], v[1], v[2]); }
+	};
+
+#if defined(THL_EUC_SSE2)
+	template<>
+	struct FieldCell<float> {
+		__m128 v;
+
+		EUCNODISCARD static EUCVECTORINLINE FieldCell zero() noexcept { return FieldCell{ _mm_setzero_ps() }; }
+		EUCNODISCARD static EUCVECTORINLINE FieldCell madd(const FieldCell& acc, float w, const float* cell) noexcept {
+			return FieldCell{ _mm_add_ps(acc.v, _mm_mul_ps(_mm_set1_ps(w), _mm_loadu_ps(cell))) };
+		}
+		EUCNODISCARD static EUCVECTORINLINE FieldCell scale(const FieldCell& acc, float w, const FieldCell& s) noexcept {
+			return FieldCell{ _mm_add_ps(acc.v, _mm_mul_ps(_mm_set1_ps(w), s.v)) };
+		}
+		EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<float> vector() const noexcept {
+			alignas(16) float r[4];
+			_mm_store_ps(r, v);
+			return EuclideanCmplVector3<float>(r[0], r[1], r[2]);
+		}
+	};
+#endif
+
+#if defined(THL_EUC_AVX)
+	template<>
+	struct FieldCell<double> {
+		__m256d v;
+
+		EUCNODISCARD static EUCVECTORINLINE FieldCell zero() noexcept { return FieldCell{ _mm256_setzero_pd() }; }
+		EUCNODISCARD static EUCVECTORINLINE FieldCell madd(const FieldCell& acc, double w, const double* cell) noexcept {
+			return FieldCell{ _mm256_add_pd(acc.v, _mm256_mul_pd(_mm256_set1_pd(w), _mm256_loadu_pd(cell))) };
+		}
+		EUCNODISCARD static EUCVECTORINLINE FieldCell scale(const FieldCell& acc, double w, const FieldCell& s) noexcept {
+			return FieldCell{ _mm256_add_pd(acc.v, _mm256_mul_pd(_mm256_set1_pd(w), s.v)) };
+		}
+		EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<double> vector() const noexcept {
+			alignas(32) double r[4];
+			_mm256_store_pd(r, v);
+			return EuclideanCmplVector3<double>(r[0], r[1], r[2]);
+		}
+	};
+#endif
+
+	/*
+		Catmull-Rom weights of the four cells around fraction t.
+	*/
+	template<class E>
+	EUCVECTORINLINE void field_cubic_weights(E t, E* w) noexcept {
+		const E t2 = t * t, t3 = t2 * t;
+		w[0] = E(0.5) * (-t3 + E(2) * t2 - t);
+		w[1] = E(0.5) * (E(3) * t3 - E(5) * t2 + E(2));
+		w[2] = E(0.5) * (E(-3) * t3 + E(4) * t2 + t);
+		w[3] = E(0.5) * (t3 - t2);
+	}
+
+}
+
+/*
+	Vector field of EuclideanCmplVector3<E> on an nx x ny x nz grid.
+*/
+template<class E = float>
+class EucVectorField3 {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucVectorField3 needs a floating point element type");
+
+	static constexpr size_t CellStride = 4;
+
+protected:
+
+	size_t n_[3];
+	size_t bricks_[3];
+	E origin_[3];
+	E inv_spacing_[3];
+	E spacing_[3];
+	// Offset tables X(i), Y(j), Z(k) in elements; the address of a cell is their sum.
+	_STD vector<size_t> offset_[3];
+	_STD vector<E> data_;
+
+	/*
+		Cell coordinates of a position: base cells b (clamped so that b + 1 is inside when the axis has two
+		or more cells) and fractions f. Requires a non-empty field.
+		NaN and -inf coordinates map to 0 and +inf to the last cell, so the cast to size_t is always defined.
+	*/
+	EUCVECTORINLINE void locate(const E* g, size_t* b, E* f) const noexcept {
+		for (size_t a = 0; a < 3; ++a) {
+			const E hi = static_cast<E>(n_[a] - 1);
+			const E c = !(g[a] > E(0)) ? E(0) : _STD min(g[a], hi);
+			size_t i = static_cast<size_t>(c);
+			if (i + 1 >= n_[a]) i = n_[a] >= 2 ? n_[a] - 2 : 0;
+			b[a] = i;
+			f[a] = c - static_cast<E>(i);
+		}
+	}
+
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> trilinear_cell(const size_t* b, const E* f) const noexcept {
+		using Cell = detail::FieldCell<E>;
+		// Offsets of cells b and b + 1 per axis. b + 1 is clamped for axes of one cell, where f is 0.
+		size_t o[3][2];
+		for (size_t a = 0; a < 3; ++a) {
+			o[a][0] = offset_[a][b[a]];
+			o[a][1] = offset_[a][b[a] + 1 < n_[a] ? b[a] + 1 : b[a]];
+		}
+		const size_t* ox = o[0];
+		const size_t* oy = o[1];
+		const size_t* oz = o[2];
+		const E wx[2] = { E(1) - f[0], f[0] }, wy[2] = { E(1) - f[1], f[1] }, wz[2] = { E(1) - f[2], f[2] };
+		const E* d = data_.data();
+		Cell acc = Cell::zero();
+		for (size_t k = 0; k < 2; ++k) {
+			for (size_t j = 0; j < 2; ++j) {
+				const E w = wz[k] * wy[j];
+				const size_t row = oz[k] + oy[j];
+				acc = Cell::madd(acc, w * wx[0], d + row + ox[0]);
+				acc = Cell::madd(acc, w * wx[1], d + row + ox[1]);
+			}
+		}
+		return acc.vector();
+	}
+
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> tricubic_cell(const size_t* b, const E* f) const noexcept {
+		using Cell = detail::FieldCell<E>;
+		// Offsets of cells b - 1 .. b + 2 per axis, clamped to the grid.
+		size_t o[3][4];
+		E w[3][4];
+		for (size_t a = 0; a < 3; ++a) {
+			for (size_t t = 0; t < 4; ++t) {
+				const ptrdiff_t i = static_cast<ptrdiff_t>(b[a]) + static_cast<ptrdiff_t>(t) - 1;
+				const size_t c = i < 0 ? 0 : static_cast<size_t>(i) >= n_[a] ? n_[a] - 1 : static_cast<size_t>(i);
+				o[a][t] = offset_[a][c];
+			}
+			detail::field_cubic_weights(f[a], w[a]);
+		}
+		const E* d = data_.data();
+		Cell acc = Cell::zero();
+		for (size_t k = 0; k < 4; ++k) {
+			Cell plane = Cell::zero();
+			for (size_t j = 0; j < 4; ++j) {
+				const E* row = d + o[2][k] + o[1][j];
+				Cell line = Cell::zero();
+				line = Cell::madd(line, w[0][0], row + o[0][0]);
+				line = Cell::madd(line, w[0][1], row + o[0][1]);
+				line = Cell::madd(line, w[0][2], row + o[0][2]);
+				line = Cell::madd(line, w[0][3], row + o[0][3]);
+				plane = Cell::scale(plane, w[1][j], line);
+			}
+			acc = Cell::scale(acc, w[2][k], plane);
+		}
+		return acc.vector();
+	}
+
+	/*
+		@brief
+			Grid coordinates of positions [0, n): (p - origin) / spacing, 8 at a time with AVX.
+	*/
+	template<class V>
+	EUCVECTORINLINE void grid_coords(const V* positions, size_t n, E* gx, E* gy, E* gz) const noexcept {
+		for (size_t i = 0; i < n; ++i) {
+			gx[i] = static_cast<E>(detail::euc_get<0>(positions[i]));
+			gy[i] = static_cast<E>(detail::euc_get<1>(positions[i]));
+			gz[i] = static_cast<E>(detail::euc_get<2>(positions[i]));
+		}
+		E* g[3] = { gx, gy, gz };
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			for (; i + 8 <= n; i += 8) {
+				for (size_t a = 0; a < 3; ++a) {
+					const __m256 v = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(g[a] + i), _mm256_set1_ps(origin_[a])), _mm256_set1_ps(inv_spacing_[a]));
+					_mm256_storeu_ps(g[a] + i, v);
+				}
+			}
+		}
+#endif
+		for (; i < n; ++i) {
+			for (size_t a = 0; a < 3; ++a) g[a][i] = (g[a][i] - origin_[a]) * inv_spacing_[a];
+		}
+	}
+
+	template<bool Cubic, class V>
+	EUCVECTORINLINE void sample_batch(const V* positions, size_t count, EuclideanCmplVector3<E>* out, unsigned threads) const {
+		if (empty()) {
+			for (size_t i = 0; i < count; ++i) out[i] = EuclideanCmplVector3<E>(E(0), E(0), E(0));
+			return;
+		}
+		detail::parallel_for(count, detail::field_grain, threads, [&](size_t b, size_t e) {
+			E g[3][detail::field_block];
+			for (size_t blk = b; blk < e; blk += detail::field_block) {
+				const size_t n = _STD min(detail::field_block, e - blk);
+				grid_coords(positions + blk, n, g[0], g[1], g[2]);
+				for (size_t i = 0; i < n; ++i) {
+					const E p[3] = { g[0][i], g[1][i], g[2][i] };
+					size_t base[3];
+					E f[3];
+					locate(p, base, f);
+					if constexpr (Cubic) {
+						out[blk + i] = tricubic_cell(base, f);
+					}
+					else {
+						out[blk + i] = trilinear_cell(base, f);
+					}
+				}
+			}
+		});
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t address(size_t i, size_t j, size_t k) const noexcept {
+		return offset_[0][i] + offset_[1][j] + offset_[2][k];
+	}
+
+public:
+
+	EucVectorField3() noexcept
+		: n_{ 0, 0, 0 }
+		, bricks_{ 0, 0, 0 }
+		, origin_{ E(0), E(0), E(0) }
+		, inv_spacing_{ E(1), E(1), E(1) }
+		, spacing_{ E(1), E(1), E(1) }
+	{}
+
+	/*
+		@brief
+			Zero field of nx x ny x nz cells.
+	*/
+	EucVectorField3(size_t nx, size_t ny, size_t nz, const EuclideanCmplVector3<E>& origin, E spacing)
+		: EucVectorField3()
+	{
+		resize(nx, ny, nz);
+		set_origin(origin);
+		set_spacing(spacing);
+	}
+
+	/*
+		@brief
+			Zero field of nx x ny x nz cells. A size of 0 on any axis leaves the field empty, and samples of an
+			empty field are zero vectors.
+	*/
+	EUCVECTORINLINE void resize(size_t nx, size_t ny, size_t nz) {
+		const size_t n[3] = { nx, ny, nz };
+		for (size_t a = 0; a < 3; ++a) {
+			n_[a] = n[a];
+			bricks_[a] = (n[a] + detail::field_brick - 1) >> detail::field_brick_bits;
+		}
+		const size_t brick_cells = detail::field_brick * detail::field_brick * detail::field_brick;
+		// X(i) = (i / 8) * brick + (i % 8), Y(j) = (j / 8) * bx * brick + (j % 8) * 8, Z(k) = (k / 8) * bx * by * brick + (k % 8) * 64.
+		const size_t brick_stride[3] = { brick_cells, bricks_[0] * brick_cells, bricks_[0] * bricks_[1] * brick_cells };
+		const size_t local_stride[3] = { 1, detail::field_brick, detail::field_brick * detail::field_brick };
+		for (size_t a = 0; a < 3; ++a) {
+			offset_[a].resize(n_[a]);
+			for (size_t i = 0; i < n_[a]; ++i) {
+				offset_[a][i] = ((i >> detail::field_brick_bits) * brick_stride[a] + (i & detail::field_brick_mask) * local_stride[a]) * CellStride;
+			}
+		}
+		data_.assign(bricks_[0] * bricks_[1] * bricks_[2] * brick_cells * CellStride, E(0));
+	}
+
+	EUCVECTORINLINE void set_origin(const EuclideanCmplVector3<E>& origin) noexcept {
+		origin_[0] = origin.x_;
+		origin_[1] = origin.y_;
+		origin_[2] = origin.z_;
+	}
+
+	EUCVECTORINLINE void set_spacing(E spacing) noexcept {
+		for (size_t a = 0; a < 3; ++a) {
+			spacing_[a] = spacing;
+			inv_spacing_[a] = E(1) / spacing;
+		}
+	}
+
+	EUCNODISCARD EUCVECTORINLINE bool empty() const noexcept { return n_[0] == 0 || n_[1] == 0 || n_[2] == 0; }
+	EUCNODISCARD EUCVECTORINLINE size_t size_x() const noexcept { return n_[0]; }
+	EUCNODISCARD EUCVECTORINLINE size_t size_y() const noexcept { return n_[1]; }
+	EUCNODISCARD EUCVECTORINLINE size_t size_z() const noexcept { return n_[2]; }
+	EUCNODISCARD EUCVECTORINLINE E spacing() const noexcept { return spacing_[0]; }
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> origin() const noexcept { return EuclideanCmplVector3<E>(origin_[0], origin_[1], origin_[2]); }
+
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> at(size_t i, size_t j, size_t k) const noexcept {
+		const E* c = data_.data() + address(i, j, k);
+		return EuclideanCmplVector3<E>(c[0], c[1], c[2]);
+	}
+
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void set(size_t i, size_t j, size_t k, const V& v) noexcept {
+		E* c = data_.data() + address(i, j, k);
+		c[0] = static_cast<E>(detail::euc_get<0>(v));
+		c[1] = static_cast<E>(detail::euc_get<1>(v));
+		c[2] = static_cast<E>(detail::euc_get<2>(v));
+	}
+
+	/*
+		@brief
+			Copy from / to a dense x-fastest array of nx * ny * nz vectors.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void assign(const V* dense, unsigned threads = 0) {
+		detail::parallel_for(n_[2], 1, threads, [&](size_t b, size_t e) {
+			for (size_t k = b; k < e; ++k) {
+				for (size_t j = 0; j < n_[1]; ++j) {
+					const V* row = dense + (k * n_[1] + j) * n_[0];
+					for (size_t i = 0; i < n_[0]; ++i) set(i, j, k, row[i]);
+				}
+			}
+		});
+	}
+
+	EUCVECTORINLINE void store(EuclideanCmplVector3<E>* dense, unsigned threads = 0) const {
+		detail::parallel_for(n_[2], 1, threads, [&](size_t b, size_t e) {
+			for (size_t k = b; k < e; ++k) {
+				for (size_t j = 0; j < n_[1]; ++j) {
+					EuclideanCmplVector3<E>* row = dense + (k * n_[1] + j) * n_[0];
+					for (size_t i = 0; i < n_[0]; ++i) row[i] = at(i, j, k);
+				}
+			}
+		});
+	}
+
+	/*
+		@brief
+			Trilinear sample at a world position.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> sample_trilinear(const V& position) const noexcept {
+		if (empty()) return EuclideanCmplVector3<E>(E(0), E(0), E(0));
+		E g[3];
+		grid_coords(&position, 1, g, g + 1, g + 2);
+		size_t b[3];
+		E f[3];
+		locate(g, b, f);
+		return trilinear_cell(b, f);
+	}
+
+	/*
+		@brief
+			Tricubic (Catmull-Rom) sample at a world position.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> sample_tricubic(const V& position) const noexcept {
+		if (empty()) return EuclideanCmplVector3<E>(E(0), E(0), E(0));
+		E g[3];
+		grid_coords(&position, 1, g, g + 1, g + 2);
+		size_t b[3];
+		E f[3];
+		locate(g, b, f);
+		return tricubic_cell(b, f);
+	}
+
+	/*
+		@brief
+			Trilinear samples at count world positions, spread over threads.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void sample_trilinear(const V* positions, size_t count, EuclideanCmplVector3<E>* out, unsigned threads = 0) const {
+		sample_batch<false>(positions, count, out, threads);
+	}
+
+	/*
+		@brief
+			Tricubic samples at count world positions, spread over threads.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void sample_tricubic(const V* positions, size_t count, EuclideanCmplVector3<E>* out, unsigned threads = 0) const {
+		sample_batch<true>(positions, count, out, threads);
+	}
+};
+
+//name space end.
+}
+
+#endif
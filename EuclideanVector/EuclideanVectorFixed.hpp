@@ -0,0 +1,552 @@
+//
+//	EuclideanVector Fixed
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Fixed-point element type for results that must be bit-identical on every machine.
+//
+//	EucFixed<Raw, Frac> stores value * 2^Frac in a signed integer. EucQ16_16 (int32_t) and EucQ32_32 (int64_t)
+//	are the two formats in use. Every operation is integer arithmetic with a defined result:
+//		+ -		wrap modulo 2^bits.
+//		*		rounds to nearest, ties towards +inf, then wraps.
+//		/		truncates towards zero and saturates; x / 0 is the largest value of the sign of x (0 for 0).
+//		sqrt	floor of the exact root; negative input gives 0.
+//	sqrt uses a double estimate only as a starting point and corrects it with integer arithmetic, so the result
+//	does not depend on the floating point unit.
+//
+//	Integers convert implicitly; floating point only with an explicit cast, so float values cannot slip into a
+//	simulation step. All operators are constexpr and inline, and EuclideanCmplVectorN<EucQ16_16> compiles its
+//	operators down to plain integer instructions. eucnorm and normalize find sqrt through argument-dependent lookup.
+//
+//	Element-wise eucnorm_squared overflows early (EucQ16_16 components above 181). euc_fixed_norm,
+//	euc_fixed_dot and euc_fixed_normalize accumulate the products in 128 bits instead.
+//	euc_fixed_add / euc_fixed_sub / euc_fixed_scale are batch kernels over the raw integers, using the int32 SIMD
+//	paths of EuclideanVectorInt.hpp for EucQ16_16.
+//.
+
+#ifndef THL_EUCLID_VECTOR_FIXED_HPP
+#define THL_EUCLID_VECTOR_FIXED_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+#include "EuclideanVectorInt.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#if defined(_MSC_VER) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+//name space begin.
+namespace thl::vector {
+
+template<class Raw, unsigned Frac>
+class EucFixed;
+
+//meta functions.
+namespace meta {
+
+	template<class E>
+	struct is_euc_fixed {
+		static constexpr bool value = false;
+	};
+	template<class Raw, unsigned Frac>
+	struct is_euc_fixed<EucFixed<Raw, Frac>> {
+		static constexpr bool value = true;
+	};
+
+	template<class E>
+	constexpr bool is_euc_fixed_v = is_euc_fixed<_STD remove_cv_t<no_ref<E>>>::value;
+
+	template<class V>
+	constexpr bool is_euc_fixed_vector_v = [] {
+		if constexpr (is_euc_vector_v<V>) {
+			return is_euc_fixed_v<euc_elem_t<V>>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	/*
+		Unsigned 128-bit value.
+	*/
+	struct FixedWide {
+		uint64_t hi;
+		uint64_t lo;
+	};
+
+	EUCNODISCARD EUCVECTORINLINE constexpr bool fixed_less(FixedWide l, FixedWide r) noexcept {
+		return l.hi < r.hi || (l.hi == r.hi && l.lo < r.lo);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE constexpr FixedWide fixed_add(FixedWide l, FixedWide r) noexcept {
+		const uint64_t lo = l.lo + r.lo;
+		return { l.hi + r.hi + (lo < l.lo ? 1u : 0u), lo };
+	}
+
+	EUCNODISCARD EUCVECTORINLINE constexpr FixedWide fixed_umul(uint64_t a, uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+		__extension__ using U128 = unsigned __int128;
+		const U128 p = static_cast<U128>(a) * b;
+		return { static_cast<uint64_t>(p >> 64), static_cast<uint64_t>(p) };
+#else
+		const uint64_t al = a & 0xffffffffu, ah = a >> 32;
+		const uint64_t bl = b & 0xffffffffu, bh = b >> 32;
+		const uint64_t ll = al * bl, lh = al * bh, hl = ah * bl;
+		const uint64_t mid = (ll >> 32) + (lh & 0xffffffffu) + (hl & 0xffffffffu);
+		return { ah * bh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & 0xffffffffu) };
+#endif
+	}
+
+	/*
+		@brief
+			Two's complement 128-bit product of signed a and b.
+	*/
+	EUCNODISCARD EUCVECTORINLINE constexpr FixedWide fixed_smul(int64_t a, int64_t b) noexcept {
+		const uint64_t ua = static_cast<uint64_t>(a), ub = static_cast<uint64_t>(b);
+		FixedWide p = fixed_umul(ua, ub);
+		if (a < 0) p.hi -= ub;
+		if (b < 0) p.hi -= ua;
+		return p;
+	}
+
+	/*
+		@brief
+			n / d for n.hi < d, so the quotient fits in 64 bits.
+	*/
+	EUCNODISCARD EUCVECTORINLINE constexpr uint64_t fixed_udiv(FixedWide n, uint64_t d) noexcept {
+#if defined(__SIZEOF_INT128__)
+		__extension__ using U128 = unsigned __int128;
+		return static_cast<uint64_t>(((static_cast<U128>(n.hi) << 64) | n.lo) / d);
+#else
+#if defined(_MSC_VER) && _MSC_VER >= 1920 && defined(_M_X64)
+		if (!EUCCONSTANT_EVALUATED()) {
+			uint64_t rem = 0;
+			return _udiv128(n.hi, n.lo, d, &rem);
+		}
+#endif
+		uint64_t rem = n.hi, q = 0;
+		for (int i = 63; i >= 0; --i) {
+			const bool carry = (rem >> 63) != 0;
+			rem = (rem << 1) | ((n.lo >> i) & 1u);
+			q <<= 1;
+			if (carry || rem >= d) {
+				rem -= d;
+				q |= 1u;
+			}
+		}
+		return q;
+#endif
+	}
+
+	/*
+		@brief
+			floor(sqrt(n)). At run time a double estimate, one Newton step when n needs more than 64 bits, and an
+			exact integer correction; during constant evaluation a bitwise search.
+	*/
+	EUCNODISCARD EUCVECTORINLINE constexpr uint64_t fixed_isqrt(FixedWide n) noexcept {
+		uint64_t r = 0;
+		if (EUCCONSTANT_EVALUATED()) {
+			for (int b = 63; b >= 0; --b) {
+				const uint64_t t = r | (uint64_t(1) << b);
+				if (!fixed_less(n, fixed_umul(t, t))) r = t;
+			}
+			return r;
+		}
+		const double e = _STD sqrt(static_cast<double>(n.hi) * 18446744073709551616.0 + static_cast<double>(n.lo));
+		r = e >= 18446744073709551616.0 ? ~uint64_t(0) : static_cast<uint64_t>(e);
+		if (n.hi != 0 && n.hi < r) {
+			const uint64_t q = fixed_udiv(n, r);
+			r = (r >> 1) + (q >> 1) + (r & q & 1u);
+		}
+		while (r != 0 && fixed_less(n, fixed_umul(r, r))) --r;
+		while (r != ~uint64_t(0) && !fixed_less(n, fixed_umul(r + 1, r + 1))) ++r;
+		return r;
+	}
+
+	template<class Raw>
+	EUCNODISCARD EUCVECTORINLINE constexpr Raw fixed_clamp(uint64_t magnitude, bool negative) noexcept {
+		using U = _STD make_unsigned_t<Raw>;
+		constexpr uint64_t max = static_cast<uint64_t>(_STD numeric_limits<Raw>::max());
+		if (negative) return magnitude > max ? _STD numeric_limits<Raw>::min() : static_cast<Raw>(U(0) - static_cast<U>(magnitude));
+		return magnitude > max ? _STD numeric_limits<Raw>::max() : static_cast<Raw>(magnitude);
+	}
+
+	template<class Raw>
+	EUCNODISCARD EUCVECTORINLINE constexpr uint64_t fixed_abs(Raw v) noexcept {
+		return v < 0 ? uint64_t(0) - static_cast<uint64_t>(static_cast<int64_t>(v)) : static_cast<uint64_t>(v);
+	}
+
+	/*
+		@brief
+			(p + 2^(Frac-1)) >> Frac of a 128-bit product, wrapped to Raw.
+	*/
+	template<class Raw, unsigned Frac>
+	EUCNODISCARD EUCVECTORINLINE constexpr Raw fixed_round_shift(FixedWide p) noexcept {
+		using U = _STD make_unsigned_t<Raw>;
+		p = fixed_add(p, { 0, uint64_t(1) << (Frac - 1) });
+		return static_cast<Raw>(static_cast<U>((p.lo >> Frac) | (p.hi << (64 - Frac))));
+	}
+
+	template<class Raw, unsigned Frac>
+	EUCNODISCARD EUCVECTORINLINE constexpr Raw fixed_mul(Raw a, Raw b) noexcept {
+		using U = _STD make_unsigned_t<Raw>;
+		if constexpr (sizeof(Raw) == 4) {
+			const int64_t p = static_cast<int64_t>(a) * b + (int64_t(1) << (Frac - 1));
+			return static_cast<Raw>(static_cast<U>(p >> Frac));
+		}
+		else {
+			return fixed_round_shift<Raw, Frac>(fixed_smul(a, b));
+		}
+	}
+
+	template<class Raw, unsigned Frac>
+	EUCNODISCARD EUCVECTORINLINE constexpr Raw fixed_div(Raw a, Raw b) noexcept {
+		if (b == 0) return a > 0 ? _STD numeric_limits<Raw>::max() : a < 0 ? _STD numeric_limits<Raw>::min() : Raw(0);
+		if constexpr (sizeof(Raw) == 4) {
+			const int64_t q = static_cast<int64_t>(a) * (int64_t(1) << Frac) / b;
+			return fixed_clamp<Raw>(fixed_abs(q), q < 0);
+		}
+		else {
+			const bool negative = (a < 0) != (b < 0);
+			const uint64_t ua = fixed_abs(a), ub = fixed_abs(b);
+			const FixedWide n = { ua >> (64 - Frac), ua << Frac };
+			if (n.hi >= ub) return negative ? _STD numeric_limits<Raw>::min() : _STD numeric_limits<Raw>::max();
+			return fixed_clamp<Raw>(fixed_udiv(n, ub), negative);
+		}
+	}
+
+	template<class Raw, unsigned Frac>
+	EUCNODISCARD EUCVECTORINLINE constexpr Raw fixed_sqrt(Raw a) noexcept {
+		if (a <= 0) return Raw(0);
+		const uint64_t ua = static_cast<uint64_t>(a);
+		return static_cast<Raw>(fixed_isqrt({ ua >> (64 - Frac), ua << Frac }));
+	}
+
+}
+
+/*
+	@brief
+		Signed fixed-point number with Frac fractional bits.
+*/
+template<class Raw, unsigned Frac>
+class EucFixed {
+
+	static_assert(_STD is_same_v<Raw, int32_t> || _STD is_same_v<Raw, int64_t>, "EucFixed stores int32_t or int64_t");
+	static_assert(Frac > 0 && Frac < sizeof(Raw) * 8 - 1, "EucFixed needs at least one fractional and one integer bit");
+
+	using URaw = _STD make_unsigned_t<Raw>;
+
+	struct RawTag {};
+
+	constexpr EucFixed(RawTag, Raw raw) noexcept : raw_(raw) {}
+
+	template<class F>
+	static constexpr Raw from_floating(F v) noexcept {
+		const F limit = F(URaw(1) << (sizeof(Raw) * 8 - 1));
+		const F s = v * F(URaw(1) << Frac);
+		if (s != s) return Raw(0);
+		const F t = s < F(0) ? s - F(0.5) : s + F(0.5);
+		if (t >= limit) return _STD numeric_limits<Raw>::max();
+		if (t <= -limit) return _STD numeric_limits<Raw>::min();
+		return static_cast<Raw>(t);
+	}
+
+	Raw raw_;
+
+public:
+
+	using raw_type = Raw;
+	static constexpr unsigned frac_bits = Frac;
+
+	constexpr EucFixed() noexcept : raw_() {}
+
+	template<class I, meta::if_t<_STD is_integral_v<I>> = 0>
+	constexpr EucFixed(I v) noexcept : raw_(static_cast<Raw>(static_cast<URaw>(static_cast<URaw>(v) << Frac))) {}
+
+	/*
+		@brief
+			Nearest value, ties away from zero, saturated. NaN gives 0.
+	*/
+	template<class F, meta::if_t<_STD is_floating_point_v<F>> = 0>
+	explicit constexpr EucFixed(F v) noexcept : raw_(from_floating(v)) {}
+
+	/*
+		@brief
+			Integer part, rounded towards -inf.
+	*/
+	template<class I, meta::if_t<_STD is_integral_v<I>> = 0>
+	EUCNODISCARD explicit constexpr operator I() const noexcept { return static_cast<I>(raw_ >> Frac); }
+
+	template<class F, meta::if_t<_STD is_floating_point_v<F>> = 0>
+	EUCNODISCARD explicit constexpr operator F() const noexcept { return F(raw_) / F(URaw(1) << Frac); }
+
+	EUCNODISCARD static constexpr EucFixed from_raw(Raw raw) noexcept { return { RawTag{}, raw }; }
+
+	EUCNODISCARD constexpr Raw raw() const noexcept { return raw_; }
+
+	EUCNODISCARD friend constexpr EucFixed operator+(EucFixed v) noexcept { return v; }
+	EUCNODISCARD friend constexpr EucFixed operator-(EucFixed v) noexcept { return from_raw(detail::int_sub_wrap(Raw(0), v.raw_)); }
+
+	EUCNODISCARD friend constexpr EucFixed operator+(EucFixed l, EucFixed r) noexcept { return from_raw(detail::int_add_wrap(l.raw_, r.raw_)); }
+	EUCNODISCARD friend constexpr EucFixed operator-(EucFixed l, EucFixed r) noexcept { return from_raw(detail::int_sub_wrap(l.raw_, r.raw_)); }
+	EUCNODISCARD friend constexpr EucFixed operator*(EucFixed l, EucFixed r) noexcept { return from_raw(detail::fixed_mul<Raw, Frac>(l.raw_, r.raw_)); }
+	EUCNODISCARD friend constexpr EucFixed operator/(EucFixed l, EucFixed r) noexcept { return from_raw(detail::fixed_div<Raw, Frac>(l.raw_, r.raw_)); }
+
+	constexpr EucFixed& operator+=(EucFixed r) noexcept { return *this = *this + r; }
+	constexpr EucFixed& operator-=(EucFixed r) noexcept { return *this = *this - r; }
+	constexpr EucFixed& operator*=(EucFixed r) noexcept { return *this = *this * r; }
+	constexpr EucFixed& operator/=(EucFixed r) noexcept { return *this = *this / r; }
+
+	EUCNODISCARD friend constexpr bool operator==(EucFixed l, EucFixed r) noexcept { return l.raw_ == r.raw_; }
+	EUCNODISCARD friend constexpr bool operator!=(EucFixed l, EucFixed r) noexcept { return l.raw_ != r.raw_; }
+	EUCNODISCARD friend constexpr bool operator<(EucFixed l, EucFixed r) noexcept { return l.raw_ < r.raw_; }
+	EUCNODISCARD friend constexpr bool operator<=(EucFixed l, EucFixed r) noexcept { return l.raw_ <= r.raw_; }
+	EUCNODISCARD friend constexpr bool operator>(EucFixed l, EucFixed r) noexcept { return l.raw_ > r.raw_; }
+	EUCNODISCARD friend constexpr bool operator>=(EucFixed l, EucFixed r) noexcept { return l.raw_ >= r.raw_; }
+
+	EUCNODISCARD friend constexpr EucFixed sqrt(EucFixed v) noexcept { return from_raw(detail::fixed_sqrt<Raw, Frac>(v.raw_)); }
+	EUCNODISCARD friend constexpr EucFixed abs(EucFixed v) noexcept { return v.raw_ < 0 ? -v : v; }
+
+};
+
+using EucQ16_16 = EucFixed<int32_t, 16>;
+using EucQ32_32 = EucFixed<int64_t, 32>;
+
+//details.
+namespace detail {
+
+	template<class V>
+	constexpr bool is_fixed_stream_v = [] {
+		if constexpr (meta::is_euc_fixed_vector_v<V>) {
+			using E = meta::euc_elem_t<V>;
+			return _STD is_same_v<_STD remove_cv_t<V>, meta::euc_cmpl_vector_t<E, meta::euc_dimension_v<V>>> && sizeof(V) == sizeof(E) * meta::euc_dimension_v<V>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+	/*
+		Only four components of INT64_MIN reach 2^128; the sum saturates there instead of wrapping to zero.
+	*/
+	template<class V, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE constexpr FixedWide fixed_norm_squared(const V& v, _STD index_sequence<I...>) noexcept {
+		FixedWide sum = { 0, 0 };
+		bool carry = false;
+		const auto accumulate = [&](FixedWide t) {
+			sum = fixed_add(sum, t);
+			carry |= fixed_less(sum, t);
+		};
+		(accumulate(fixed_umul(fixed_abs(euc_get<I>(v).raw()), fixed_abs(euc_get<I>(v).raw()))), ...);
+		return carry ? FixedWide{ ~uint64_t(0), ~uint64_t(0) } : sum;
+	}
+
+	template<class V, class W, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE constexpr FixedWide fixed_dot(const V& a, const W& b, _STD index_sequence<I...>) noexcept {
+		FixedWide sum = { 0, 0 };
+		((sum = fixed_add(sum, fixed_smul(euc_get<I>(a).raw(), euc_get<I>(b).raw()))), ...);
+		return sum;
+	}
+
+	/*
+		@brief
+			a / norm for |a| <= norm, equal to fixed_div. The caller computes rcp = 2^63 / norm once per vector; the
+			product estimate is at most one below the quotient and the remainder test corrects it.
+	*/
+	template<unsigned Frac>
+	EUCNODISCARD EUCVECTORINLINE constexpr int32_t fixed_div_rcp(int32_t a, uint64_t norm, uint64_t rcp) noexcept {
+		const uint64_t m = fixed_abs(a) << Frac;
+		const FixedWide p = fixed_umul(m, rcp);
+		uint64_t q = (p.hi << 1) | (p.lo >> 63);
+		if (m - q * norm >= norm) ++q;
+		return fixed_clamp<int32_t>(q, a < 0);
+	}
+
+	/*
+		@brief
+			a / norm for |a| <= norm, with norm kept in 64 bits so that it may exceed the Raw range.
+	*/
+	template<class Raw, unsigned Frac>
+	EUCNODISCARD EUCVECTORINLINE constexpr Raw fixed_div_norm(Raw a, uint64_t norm) noexcept {
+		const uint64_t ua = fixed_abs(a);
+		return fixed_clamp<Raw>(fixed_udiv({ ua >> (64 - Frac), ua << Frac }, norm), a < 0);
+	}
+
+	/*
+		The norm is not clamped to Raw: a Q16.16 vector such as (30000, 30000) has a raw norm above INT32_MAX,
+		and every component is still at most the norm, so the quotients stay within [-1, 1].
+	*/
+	template<class E, class V, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE constexpr auto fixed_normalize(const V& v, _STD index_sequence<I...> seq) noexcept {
+		using Raw = typename E::raw_type;
+		const FixedWide sq = fixed_norm_squared(v, seq);
+		const uint64_t norm = fixed_isqrt(sq);
+		if (norm == 0) return meta::euc_packer_t<E, sizeof...(I)>{ ((void)I, E())... };
+		if constexpr (sizeof(Raw) == 4) {
+			const uint64_t rcp = (uint64_t(1) << 63) / norm;
+			return meta::euc_packer_t<E, sizeof...(I)>{ E::from_raw(fixed_div_rcp<E::frac_bits>(euc_get<I>(v).raw(), norm, rcp))... };
+		}
+		else {
+			return meta::euc_packer_t<E, sizeof...(I)>{ E::from_raw(fixed_div_norm<Raw, E::frac_bits>(euc_get<I>(v).raw(), norm))... };
+		}
+	}
+
+	/*
+		@brief
+			out[i] = a[i] * s over n raw EucQ16_16-style values, rounded like EucFixed::operator*.
+	*/
+	template<unsigned Frac>
+	EUCVECTORINLINE void fixed_scale_stream(const int32_t* a, int32_t s, int32_t* out, size_t n) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_AVX2)
+		const __m256i vs = _mm256_set1_epi32(s);
+		const __m256i half = _mm256_set1_epi64x(int64_t(1) << (Frac - 1));
+		for (; i + 8 <= n; i += 8) {
+			const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+			const __m256i even = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(v, vs), half), Frac);
+			const __m256i odd = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(v, 32), vs), half), Frac);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa));
+		}
+#elif defined(THL_EUC_SSE41)
+		const __m128i vs = _mm_set1_epi32(s);
+		const __m128i half = _mm_set1_epi64x(int64_t(1) << (Frac - 1));
+		for (; i + 4 <= n; i += 4) {
+			const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+			const __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(v, vs), half), Frac);
+			const __m128i odd = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(v, 32), vs), half), Frac);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xcc));
+		}
+#endif
+		for (; i < n; ++i) out[i] = fixed_mul<int32_t, Frac>(a[i], s);
+	}
+
+	template<bool Add, class V>
+	EUCVECTORINLINE void fixed_add_sub(const V* a, const V* b, V* out, size_t count, unsigned threads) {
+		using E = meta::euc_elem_t<V>;
+		using Raw = typename E::raw_type;
+		constexpr size_t D = meta::euc_dimension_v<V>;
+		parallel_for(count, int_grain, threads, [&](size_t s, size_t e) {
+			if constexpr (is_fixed_stream_v<V>) {
+				const Raw* pa = reinterpret_cast<const Raw*>(a + s);
+				const Raw* pb = reinterpret_cast<const Raw*>(b + s);
+				Raw* po = reinterpret_cast<Raw*>(out + s);
+				if constexpr (Add) int_stream(pa, pb, po, (e - s) * D, [](auto r, auto x, auto y) { return decltype(r)::add_wrap(x, y); }, int_add_wrap<Raw>);
+				else int_stream(pa, pb, po, (e - s) * D, [](auto r, auto x, auto y) { return decltype(r)::sub_wrap(x, y); }, int_sub_wrap<Raw>);
+			}
+			else {
+				for (size_t i = s; i < e; ++i) {
+					if constexpr (Add) out[i] = a[i] + b[i];
+					else out[i] = a[i] - b[i];
+				}
+			}
+		});
+	}
+
+}
+
+/*
+	@brief
+		Norm and dot product with the products summed in 128 bits, so only the final result can overflow.
+		The norm saturates; the dot product rounds like EucFixed::operator* and wraps.
+*/
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE constexpr meta::euc_elem_t<V> euc_fixed_norm(const V& v) noexcept {
+	using E = meta::euc_elem_t<V>;
+	const auto sq = detail::fixed_norm_squared(v, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+	return E::from_raw(detail::fixed_clamp<typename E::raw_type>(detail::fixed_isqrt(sq), false));
+}
+
+template<class V, class W, meta::if_t<meta::is_euc_fixed_vector_v<V> && _STD is_same_v<meta::euc_elem_t<V>, meta::euc_elem_t<W>>
+	&& meta::euc_dimension_v<V> == meta::euc_dimension_v<W>> = 0>
+EUCNODISCARD EUCVECTORINLINE constexpr meta::euc_elem_t<V> euc_fixed_dot(const V& a, const W& b) noexcept {
+	using E = meta::euc_elem_t<V>;
+	const auto sum = detail::fixed_dot(a, b, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+	return E::from_raw(detail::fixed_round_shift<typename E::raw_type, E::frac_bits>(sum));
+}
+
+/*
+	@brief
+		v / euc_fixed_norm(v), each component truncated towards zero. The zero vector stays zero.
+*/
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE constexpr auto euc_fixed_normalize(const V& v) noexcept {
+	return detail::fixed_normalize<meta::euc_elem_t<V>>(v, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+/*
+	@brief
+		euc_fixed_add: out[i] = a[i] + b[i]
+		euc_fixed_sub: out[i] = a[i] - b[i]
+		for count vectors, wrapping. out may be a or b.
+*/
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_fixed_add(const V* a, const V* b, V* out, size_t count, unsigned threads = 0) {
+	detail::fixed_add_sub<true>(a, b, out, count, threads);
+}
+
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_fixed_sub(const V* a, const V* b, V* out, size_t count, unsigned threads = 0) {
+	detail::fixed_add_sub<false>(a, b, out, count, threads);
+}
+
+/*
+	@brief
+		out[i] = src[i] * s for count vectors. out may be src.
+*/
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_fixed_scale(const V* src, meta::euc_elem_t<V> s, V* out, size_t count, unsigned threads = 0) {
+	using E = meta::euc_elem_t<V>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	detail::parallel_for(count, detail::int_grain, threads, [&](size_t b, size_t e) {
+		if constexpr (detail::is_fixed_stream_v<V> && _STD is_same_v<typename E::raw_type, int32_t>) {
+			detail::fixed_scale_stream<E::frac_bits>(reinterpret_cast<const int32_t*>(src + b), s.raw(), reinterpret_cast<int32_t*>(out + b), (e - b) * D);
+		}
+		else {
+			for (size_t i = b; i < e; ++i) out[i] = src[i] * s;
+		}
+	});
+}
+
+/*
+	@brief
+		euc_fixed_dot: out[i] = euc_fixed_dot(a[i], b[i])
+		euc_fixed_normalize: out[i] = euc_fixed_normalize(src[i])
+		for count vectors.
+*/
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_fixed_dot(const V* a, const V* b, meta::euc_elem_t<V>* out, size_t count, unsigned threads = 0) {
+	detail::parallel_for(count, detail::int_grain, threads, [&](size_t s, size_t e) {
+		for (size_t i = s; i < e; ++i) out[i] = euc_fixed_dot(a[i], b[i]);
+	});
+}
+
+template<class V, meta::if_t<meta::is_euc_fixed_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_fixed_normalize(const V* src, V* out, size_t count, unsigned threads = 0) {
+	detail::parallel_for(count, detail::int_grain, threads, [&](size_t s, size_t e) {
+		for (size_t i = s; i < e; ++i) out[i] = euc_fixed_normalize(src[i]);
+	});
+}
+
+/*
+	Normalizing vectors whose raw norm exceeds the Raw range: 1 / sqrt(2), truncated.
+*/
+static_assert(EuclideanCmplVector2<EucQ16_16>(euc_fixed_normalize(EuclideanCmplVector2<EucQ16_16>(30000, -30000))).y_.raw() == -46340);
+static_assert(EuclideanCmplVector2<EucQ32_32>(euc_fixed_normalize(EuclideanCmplVector2<EucQ32_32>(1 << 30, 1 << 30))).x_.raw() == 3037000499);
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,341 @@
+//
+//	EuclideanVector IO
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Text parsing and formatting for every vector and ResultPacker type, built on std::from_chars / std::to_chars.
+//	Neither locale nor iostream is involved, so parsing a line costs only the number conversions.
+//
+//	Elements may be separated by spaces, tabs, ',' or ';'. A leading '+' is accepted.
+//	For bulk input, one vector is read per line. Blank lines and lines starting with '#' are skipped,
+//	and "\r\n" line endings are accepted.
+//
+//	Only arithmetic element types are supported, since std::from_chars / std::to_chars require them.
+//.
+
+#ifndef THL_EUCLID_VECTOR_IO_HPP
+#define THL_EUCLID_VECTOR_IO_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+//meta functions.
+namespace meta {
+
+	template<class V>
+	constexpr bool is_euc_text_convertible_v = [] {
+		if constexpr (is_euc_vector_v<V>) {
+			return _STD is_arithmetic_v<euc_elem_t<V>> && !_STD is_same_v<euc_elem_t<V>, bool>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+/*
+	Result of a bulk parse.
+*/
+struct EucParseResult {
+	// Number of vectors appended to the output.
+	size_t count;
+	// 1-based line of the first malformed record, 0 when every record was read.
+	size_t line;
+	// Position of the first malformed element, or the end of the input.
+	const char* ptr;
+	// errc() on success, invalid_argument / result_out_of_range otherwise.
+	_STD errc ec;
+
+	EUCNODISCARD EUCVECTORINLINE explicit operator bool() const noexcept { return ec == _STD errc(); }
+};
+
+//details.
+namespace detail {
+
+	// Longest text produced for one element (sign, digits, exponent, and separator).
+	template<class E>
+	constexpr size_t io_elem_chars = _STD is_floating_point_v<E> ? 32 : 24;
+
+	EUCNODISCARD EUCVECTORINLINE constexpr bool io_is_separator(char c) noexcept {
+		return c == ' ' || c == '\t' || c == ',' || c == ';';
+	}
+
+	EUCNODISCARD EUCVECTORINLINE const char* io_skip_separators(const char* p, const char* last) noexcept {
+		while (p != last && io_is_separator(*p)) ++p;
+		return p;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE const char* io_line_end(const char* p, const char* last) noexcept {
+		const void* nl = _STD memchr(p, '\n', static_cast<size_t>(last - p));
+		return nl ? static_cast<const char*>(nl) : last;
+	}
+
+	// The line [p, end) holds a vector (not blank, not a comment).
+	EUCNODISCARD EUCVECTORINLINE bool io_line_is_record(const char* p, const char* end) noexcept {
+		p = io_skip_separators(p, end);
+		return p != end && *p != '#' && *p != '\r';
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE _STD from_chars_result io_parse_elem(const char* p, const char* last, E& out) noexcept {
+		if (p != last && *p == '+' && (last - p) > 1 && *(p + 1) != '-') ++p;
+		return _STD from_chars(p, last, out);
+	}
+
+	/*
+		@brief
+			Parse the elements of v from [first, last), stopping after the last element.
+	*/
+	template<class V>
+	EUCNODISCARD EUCVECTORINLINE _STD from_chars_result io_parse_vector(const char* first, const char* last, V& v) noexcept {
+		_STD from_chars_result res{ first, _STD errc() };
+		euc_for_each(v, [&](auto& elem) {
+			if (res.ec != _STD errc()) return;
+			const char* p = io_skip_separators(res.ptr, last);
+			res = io_parse_elem(p, last, elem);
+		});
+		return res;
+	}
+
+	/*
+		@brief
+			Parse exactly one record from the line [first, end): trailing separators are allowed, trailing numbers are not.
+	*/
+	template<class V>
+	EUCNODISCARD EUCVECTORINLINE _STD from_chars_result io_parse_record(const char* first, const char* end, V& v) noexcept {
+		auto res = io_parse_vector(first, end, v);
+		if (res.ec != _STD errc()) return res;
+		const char* p = io_skip_separators(res.ptr, end);
+		if (p != end && *p == '\r') ++p;
+		if (p != end) return { p, _STD errc::invalid_argument };
+		return { end, _STD errc() };
+	}
+
+	template<class V>
+	EUCNODISCARD EUCVECTORINLINE _STD to_chars_result io_format_vector(char* first, char* last, const V& v, char separator) noexcept {
+		_STD to_chars_result res{ first, _STD errc() };
+		bool head = true;
+		euc_for_each(v, [&](const auto& elem) {
+			if (res.ec != _STD errc()) return;
+			if (!head) {
+				if (res.ptr == last) {
+					res.ec = _STD errc::value_too_large;
+					return;
+				}
+				*res.ptr++ = separator;
+			}
+			head = false;
+			res = _STD to_chars(res.ptr, last, elem);
+		});
+		return res;
+	}
+
+	// Start of the line containing the byte after offset (used to cut a buffer into line-aligned chunks).
+	EUCNODISCARD EUCVECTORINLINE const char* io_align_to_line(const char* first, const char* last, size_t offset) noexcept {
+		const char* p = first + offset;
+		if (p >= last) return last;
+		if (p == first) return first;
+		const char* nl = io_line_end(p - 1, last);
+		return nl == last ? last : nl + 1;
+	}
+
+}
+
+/*
+	@brief
+		Write v as text into [first, last), elements joined by separator.
+		No terminator is written. Returns value_too_large when the buffer is too short.
+*/
+template<class V, meta::if_t<meta::is_euc_text_convertible_v<V>> = 0>
+EUCNODISCARD_MSG("The output pointer was ignored. The written length cannot be known without it.")
+	EUCVECTORINLINE _STD to_chars_result to_chars(char* first, char* last, const V& v, char separator = ' ') noexcept {
+	return detail::io_format_vector(first, last, v, separator);
+}
+
+/*
+	@brief
+		Read the elements of v from [first, last).
+		Elements may be separated by spaces, tabs, ',' or ';'. Reading stops right after the last element.
+*/
+template<class V, meta::if_t<meta::is_euc_text_convertible_v<V>> = 0>
+EUCNODISCARD_MSG("The parse result was ignored. Errors cannot be detected without it.")
+	EUCVECTORINLINE _STD from_chars_result from_chars(const char* first, const char* last, V& v) noexcept {
+	return detail::io_parse_vector(first, last, v);
+}
+
+/*
+	@brief
+		Format v as a std::string.
+*/
+template<class V, meta::if_t<meta::is_euc_text_convertible_v<V>> = 0>
+EUCNODISCARD_MSG("The formatted string was ignored. This may be an unintended call.")
+	EUCVECTORINLINE _STD string to_string(const V& v, char separator = ' ') {
+	char buffer[detail::io_elem_chars<meta::euc_elem_t<V>> * 4];
+	auto res = detail::io_format_vector(buffer, buffer + sizeof(buffer), v, separator);
+	return _STD string(buffer, res.ptr);
+}
+
+/*
+	@brief
+		Count the records (non blank, non comment lines) in [first, last).
+		Lets callers size their own storage before calling parse_vectors.
+*/
+EUCNODISCARD_MSG("The record count was ignored. This may be an unintended call.")
+	EUCVECTORINLINE size_t count_vector_records(const char* first, const char* last, unsigned threads = 0) {
+	const size_t size = static_cast<size_t>(last - first);
+	const size_t chunks = detail::chunk_count(size, size_t(1) << 16, threads);
+	_STD vector<size_t> counts(chunks, 0);
+	detail::parallel_invoke(chunks, [&](size_t c) {
+		const char* p = detail::io_align_to_line(first, last, size * c / chunks);
+		const char* end = detail::io_align_to_line(first, last, size * (c + 1) / chunks);
+		size_t n = 0;
+		while (p < end) {
+			const char* eol = detail::io_line_end(p, end);
+			n += detail::io_line_is_record(p, eol);
+			p = eol == end ? eol : eol + 1;
+		}
+		counts[c] = n;
+	});
+	size_t total = 0;
+	for (size_t n : counts) total += n;
+	return total;
+}
+
+/*
+	@brief
+		Parse one vector per line from the memory buffer [first, last) and append them to out.
+
+		The buffer is cut into line-aligned chunks that are scanned concurrently:
+		the first pass counts records per chunk, out is resized once,
+		and the second pass converts each chunk directly into its slice of out.
+
+		On error, out keeps every vector that precedes the first malformed line.
+*/
+template<class V, class Alloc, meta::if_t<meta::is_euc_text_convertible_v<V>> = 0>
+EUCNODISCARD_MSG("The parse result was ignored. Errors cannot be detected without it.")
+	EUCVECTORINLINE EucParseResult parse_vectors(const char* first, const char* last, _STD vector<V, Alloc>& out, unsigned threads = 0) {
+	const size_t size = static_cast<size_t>(last - first);
+	const size_t chunks = detail::chunk_count(size, size_t(1) << 16, threads);
+	const size_t base = out.size();
+	if (chunks == 0) return { 0, 0, last, _STD errc() };
+
+	struct Chunk {
+		const char* begin;
+		const char* end;
+		size_t records;
+		size_t lines;
+		size_t parsed;
+		size_t error_line;
+		const char* error_ptr;
+		_STD errc ec;
+	};
+	_STD vector<Chunk> parts(chunks);
+	for (size_t c = 0; c < chunks; ++c) {
+		parts[c].begin = detail::io_align_to_line(first, last, size * c / chunks);
+		parts[c].end = detail::io_align_to_line(first, last, size * (c + 1) / chunks);
+	}
+
+	// Pass 1 : count records and lines.
+	detail::parallel_invoke(chunks, [&](size_t c) {
+		Chunk& part = parts[c];
+		size_t records = 0, lines = 0;
+		for (const char* p = part.begin; p < part.end; ++lines) {
+			const char* eol = detail::io_line_end(p, part.end);
+			records += detail::io_line_is_record(p, eol);
+			p = eol == part.end ? eol : eol + 1;
+		}
+		part.records = records;
+		part.lines = lines;
+	});
+
+	size_t total = 0;
+	for (auto& part : parts) total += part.records;
+	out.resize(base + total);
+
+	// Pass 2 : convert every chunk into its own slice of out.
+	detail::parallel_invoke(chunks, [&](size_t c) {
+		Chunk& part = parts[c];
+		size_t offset = base;
+		for (size_t i = 0; i < c; ++i) offset += parts[i].records;
+
+		V* dst = out.data() + offset;
+		size_t parsed = 0, line = 0;
+		part.ec = _STD errc();
+		for (const char* p = part.begin; p < part.end; ++line) {
+			const char* eol = detail::io_line_end(p, part.end);
+			if (detail::io_line_is_record(p, eol)) {
+				auto res = detail::io_parse_record(p, eol, dst[parsed]);
+				if (res.ec != _STD errc()) {
+					part.ec = res.ec;
+					part.error_ptr = res.ptr;
+					part.error_line = line;
+					break;
+				}
+				++parsed;
+			}
+			p = eol == part.end ? eol : eol + 1;
+		}
+		part.parsed = parsed;
+	});
+
+	size_t count = 0, lines = 0;
+	for (auto& part : parts) {
+		if (part.ec != _STD errc()) {
+			count += part.parsed;
+			out.resize(base + count);
+			return { count, lines + part.error_line + 1, part.error_ptr, part.ec };
+		}
+		count += part.parsed;
+		lines += part.lines;
+	}
+	return { count, 0, last, _STD errc() };
+}
+
+/*
+	@brief
+		Append count vectors to out as text, one per line, elements joined by separator.
+		Chunks are formatted concurrently and concatenated in order.
+*/
+template<class V, meta::if_t<meta::is_euc_text_convertible_v<V>> = 0>
+EUCVECTORINLINE void format_vectors(const V* data, size_t count, _STD string& out, char separator = ' ', unsigned threads = 0) {
+	constexpr size_t line_chars = detail::io_elem_chars<meta::euc_elem_t<V>> * meta::euc_dimension_v<V> + 1;
+	const size_t chunks = detail::chunk_count(count, size_t(1) << 14, threads);
+	_STD vector<_STD string> texts(chunks);
+
+	detail::parallel_invoke(chunks, [&](size_t c) {
+		const size_t begin = count * c / chunks;
+		const size_t end = count * (c + 1) / chunks;
+		_STD string& text = texts[c];
+		text.resize((end - begin) * line_chars);
+		char* p = text.data();
+		char* last = p + text.size();
+		for (size_t i = begin; i < end; ++i) {
+			p = detail::io_format_vector(p, last, data[i], separator).ptr;
+			*p++ = '\n';
+		}
+		text.resize(static_cast<size_t>(p - text.data()));
+	});
+
+	size_t total = out.size();
+	for (auto& text : texts) total += text.size();
+	out.reserve(total);
+	for (auto& text : texts) out += text;
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,396 @@
+//
+//	EuclideanVector Icp
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Point-to-point iterative closest point registration of 3D scans.
+//
+//	The target scan is indexed once in an EucKdTree3. Each iteration runs as one parallel pass over the source.
+//	Blocks of source points are transformed by the current estimate (AVX for float), each point is matched to its
+//	nearest target point, and each thread accumulates the centered cross-covariance of its matches in double.
+//	The per-thread sums are merged and the best rigid increment is solved in closed form (Kabsch).
+//	The SVD of the 3x3 cross-covariance comes from euc_eigen_symmetric of H^T H; the rotation axes use dot and cross of
+//	EuclideanCmplVector3. Each point is matched, accumulated and forgotten in one pass, so no correspondence list is
+//	built.
+//
+//	Iteration stops at max_iterations, when the relative RMS change falls below tolerance, or when the increment
+//	is below the rotation / translation thresholds. Every iteration reports its time, split into the search and
+//	the solve.
+//.
+
+#ifndef THL_EUCLID_VECTOR_ICP_HPP
+#define THL_EUCLID_VECTOR_ICP_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+#include "EuclideanVectorKdTree.hpp"
+#include "EuclideanVectorCovariance.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Rigid transform p -> R p + t. rows[i] is the i-th row of R.
+*/
+template<class E = double>
+struct EucRigid3 {
+	EuclideanCmplVector3<E> rows[3];
+	EuclideanCmplVector3<E> t;
+
+	EUCNODISCARD static EUCVECTORINLINE EucRigid3 identity() noexcept {
+		return EucRigid3{
+			{ EuclideanCmplVector3<E>(E(1), E(0), E(0)), EuclideanCmplVector3<E>(E(0), E(1), E(0)), EuclideanCmplVector3<E>(E(0), E(0), E(1)) },
+			EuclideanCmplVector3<E>(E(0), E(0), E(0)) };
+	}
+
+	EUCNODISCARD EUCVECTORINLINE EuclideanCmplVector3<E> apply(const EuclideanCmplVector3<E>& p) const noexcept {
+		return EuclideanCmplVector3<E>(rows[0].dot(p) + t.x_, rows[1].dot(p) + t.y_, rows[2].dot(p) + t.z_);
+	}
+
+	/*
+		@brief
+			this after other: p -> this(other(p)).
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucRigid3 compose(const EucRigid3& other) const noexcept {
+		const EuclideanCmplVector3<E> cols[3] = {
+			EuclideanCmplVector3<E>(other.rows[0].x_, other.rows[1].x_, other.rows[2].x_),
+			EuclideanCmplVector3<E>(other.rows[0].y_, other.rows[1].y_, other.rows[2].y_),
+			EuclideanCmplVector3<E>(other.rows[0].z_, other.rows[1].z_, other.rows[2].z_) };
+		EucRigid3 r;
+		for (size_t i = 0; i < 3; ++i) r.rows[i] = EuclideanCmplVector3<E>(rows[i].dot(cols[0]), rows[i].dot(cols[1]), rows[i].dot(cols[2]));
+		r.t = apply(other.t);
+		return r;
+	}
+
+	/*
+		@brief
+			Rotation angle in radians.
+	*/
+	EUCNODISCARD EUCVECTORINLINE E angle() const noexcept {
+		const E c = (rows[0].x_ + rows[1].y_ + rows[2].z_ - E(1)) / E(2);
+		return _STD acos(c < E(-1) ? E(-1) : c > E(1) ? E(1) : c);
+	}
+};
+
+struct EucIcpOptions {
+	size_t max_iterations = 30;
+	double tolerance = 1e-6;						// relative change of the RMS error.
+	double max_correspondence_distance = _STD numeric_limits<double>::infinity();
+	double min_rotation = 1e-7;						// radians; smaller increments stop the iteration,
+	double min_translation = 1e-7;					// together with a centroid displacement below this.
+	unsigned threads = 0;
+};
+
+struct EucIcpIterationStats {
+	double seconds;
+	double search_seconds;		// transform, nearest neighbour search and accumulation.
+	double solve_seconds;
+	size_t correspondences;
+	double rms;					// RMS distance of the matches before this iteration's update.
+};
+
+template<class E = double>
+struct EucIcpResult {
+	EucRigid3<E> transform;		// maps the source onto the target.
+	_STD vector<EucIcpIterationStats> iterations;
+	double rms;
+	double total_seconds;
+	bool converged;
+};
+
+//details.
+namespace detail {
+
+	constexpr size_t icp_block = 256;
+	constexpr size_t icp_grain = 8192;
+
+	/*
+		Matches of one thread, relative to a fixed reference point.
+	*/
+	struct IcpAccumulator {
+		double sp[3], sq[3];
+		double h[3][3];
+		double error;
+		size_t count;
+
+		EUCVECTORINLINE void add(const double* p, const double* q, double d2) noexcept {
+			for (size_t i = 0; i < 3; ++i) {
+				sp[i] += p[i];
+				sq[i] += q[i];
+				for (size_t j = 0; j < 3; ++j) h[i][j] += p[i] * q[j];
+			}
+			error += d2;
+			++count;
+		}
+
+		EUCVECTORINLINE void merge(const IcpAccumulator& o) noexcept {
+			for (size_t i = 0; i < 3; ++i) {
+				sp[i] += o.sp[i];
+				sq[i] += o.sq[i];
+				for (size_t j = 0; j < 3; ++j) h[i][j] += o.h[i][j];
+			}
+			error += o.error;
+			count += o.count;
+		}
+	};
+
+	/*
+		@brief
+			Transform n source points (SoA) by the row-major rotation r and translation t.
+	*/
+	template<class E>
+	EUCVECTORINLINE void icp_transform(const E* x, const E* y, const E* z, size_t n, const E* r, const E* t, E* ox, E* oy, E* oz) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			__m256 m[9], v[3];
+			for (size_t k = 0; k < 9; ++k) m[k] = _mm256_set1_ps(r[k]);
+			for (size_t k = 0; k < 3; ++k) v[k] = _mm256_set1_ps(t[k]);
+			for (; i + 8 <= n; i += 8) {
+				const __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+				E* out[3] = { ox, oy, oz };
+				for (size_t k = 0; k < 3; ++k) {
+					const __m256 s = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[k * 3], px), _mm256_mul_ps(m[k * 3 + 1], py)),
+						_mm256_add_ps(_mm256_mul_ps(m[k * 3 + 2], pz), v[k]));
+					_mm256_storeu_ps(out[k] + i, s);
+				}
+			}
+		}
+#endif
+		for (; i < n; ++i) {
+			ox[i] = r[0] * x[i] + r[1] * y[i] + r[2] * z[i] + t[0];
+			oy[i] = r[3] * x[i] + r[4] * y[i] + r[5] * z[i] + t[1];
+			oz[i] = r[6] * x[i] + r[7] * y[i] + r[8] * z[i] + t[2];
+		}
+	}
+
+	/*
+		@brief
+			Rotation R and translation t minimizing sum |R p + t - q|^2 over the accumulated matches (Kabsch).
+			p and q were accumulated relative to ref.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucRigid3<double> icp_solve(const IcpAccumulator& acc, const double* ref) noexcept {
+		const double inv = 1.0 / static_cast<double>(acc.count);
+		const double mp[3] = { acc.sp[0] * inv, acc.sp[1] * inv, acc.sp[2] * inv };
+		const double mq[3] = { acc.sq[0] * inv, acc.sq[1] * inv, acc.sq[2] * inv };
+		double h[3][3];
+		for (size_t i = 0; i < 3; ++i) {
+			for (size_t j = 0; j < 3; ++j) h[i][j] = acc.h[i][j] * inv - mp[i] * mq[j];
+		}
+		// H = U S V^T; V and S^2 from H^T H, then u_i = H v_i / s_i.
+		EucSymmetric3<double> hth = {};
+		double* e[6] = { &hth.xx, &hth.xy, &hth.xz, &hth.yy, &hth.yz, &hth.zz };
+		const size_t ij[6][2] = { { 0, 0 }, { 0, 1 }, { 0, 2 }, { 1, 1 }, { 1, 2 }, { 2, 2 } };
+		for (size_t k = 0; k < 6; ++k) {
+			for (size_t r = 0; r < 3; ++r) *e[k] += h[r][ij[k][0]] * h[r][ij[k][1]];
+		}
+		const EucEigen3<double> eig = euc_eigen_symmetric(hth);
+		const EuclideanCmplVector3<double> hrows[3] = {
+			EuclideanCmplVector3<double>(h[0][0], h[0][1], h[0][2]),
+			EuclideanCmplVector3<double>(h[1][0], h[1][1], h[1][2]),
+			EuclideanCmplVector3<double>(h[2][0], h[2][1], h[2][2]) };
+		EuclideanCmplVector3<double> u[3];
+		for (size_t k = 0; k < 2; ++k) {
+			const auto& v = eig.vectors[k];
+			u[k] = EuclideanCmplVector3<double>(hrows[0].dot(v), hrows[1].dot(v), hrows[2].dot(v));
+		}
+		const double n0 = u[0].eucnorm();
+		if (!(n0 > 0.0)) return EucRigid3<double>::identity();
+		u[0] = EuclideanCmplVector3<double>(u[0].x_ / n0, u[0].y_ / n0, u[0].z_ / n0);
+		// Keep u1 orthogonal to u0; a degenerate (collinear) match set leaves the roll about u0 arbitrary.
+		const double d01 = u[0].dot(u[1]);
+		u[1] = EuclideanCmplVector3<double>(u[1].x_ - d01 * u[0].x_, u[1].y_ - d01 * u[0].y_, u[1].z_ - d01 * u[0].z_);
+		double n1 = u[1].eucnorm();
+		if (!(n1 > n0 * 1e-12)) {
+			u[1] = _STD fabs(u[0].x_) < 0.9 ? EuclideanCmplVector3<double>(0.0, -u[0].z_, u[0].y_) : EuclideanCmplVector3<double>(-u[0].z_, 0.0, u[0].x_);
+			n1 = u[1].eucnorm();
+		}
+		u[1] = EuclideanCmplVector3<double>(u[1].x_ / n1, u[1].y_ / n1, u[1].z_ / n1);
+		// u2 = u0 x u1 makes det(U) = det(V) = 1, so R = V U^T is the optimal proper rotation.
+		u[2] = u[0].cross(u[1]);
+		const auto& v = eig.vectors;
+		const double vc[3][3] = { { v[0].x_, v[0].y_, v[0].z_ }, { v[1].x_, v[1].y_, v[1].z_ }, { v[2].x_, v[2].y_, v[2].z_ } };
+
+		EucRigid3<double> r;
+		for (size_t i = 0; i < 3; ++i) {
+			const double vi[3] = { vc[0][i], vc[1][i], vc[2][i] };
+			r.rows[i] = EuclideanCmplVector3<double>(
+				vi[0] * u[0].x_ + vi[1] * u[1].x_ + vi[2] * u[2].x_,
+				vi[0] * u[0].y_ + vi[1] * u[1].y_ + vi[2] * u[2].y_,
+				vi[0] * u[0].z_ + vi[1] * u[1].z_ + vi[2] * u[2].z_);
+		}
+		// t = mean q - R mean p, in absolute coordinates.
+		const EuclideanCmplVector3<double> pbar(mp[0] + ref[0], mp[1] + ref[1], mp[2] + ref[2]);
+		r.t = EuclideanCmplVector3<double>(mq[0] + ref[0] - r.rows[0].dot(pbar), mq[1] + ref[1] - r.rows[1].dot(pbar), mq[2] + ref[2] - r.rows[2].dot(pbar));
+		return r;
+	}
+
+}
+
+/*
+	ICP registration engine. E is the coordinate type of the KD-tree and the transformed source points.
+	The target is kept between calls, so many scans can be registered against one map.
+*/
+template<class E = float>
+class EucIcp {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucIcp needs a floating point coordinate type");
+
+protected:
+
+	EucIcpOptions options_;
+	EucKdTree3<E> tree_;
+	_STD vector<EuclideanCmplVector3<E>> target_;
+	_STD vector<E> sx_, sy_, sz_;
+	_STD vector<detail::IcpAccumulator> partial_;
+
+	using Clock = _STD chrono::steady_clock;
+
+	EUCNODISCARD static EUCVECTORINLINE double elapsed(Clock::time_point since) noexcept {
+		return _STD chrono::duration<double>(Clock::now() - since).count();
+	}
+
+public:
+
+	explicit EucIcp(const EucIcpOptions& options = EucIcpOptions()) noexcept
+		: options_(options)
+	{}
+
+	EUCNODISCARD EUCVECTORINLINE const EucIcpOptions& options() const noexcept { return options_; }
+	EUCVECTORINLINE void set_options(const EucIcpOptions& options) noexcept { options_ = options; }
+
+	/*
+		@brief
+			Set the target scan and build its KD-tree.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void set_target(const V* points, size_t count) {
+		target_.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			target_[i] = EuclideanCmplVector3<E>(static_cast<E>(detail::euc_get<0>(points[i])),
+				static_cast<E>(detail::euc_get<1>(points[i])), static_cast<E>(detail::euc_get<2>(points[i])));
+		}
+		tree_.build(target_.data(), count);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE const EucKdTree3<E>& tree() const noexcept { return tree_; }
+
+	/*
+		@brief
+			Register count source points onto the target, starting from initial.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE EucIcpResult<double> align(const V* points, size_t count, const EucRigid3<double>& initial = EucRigid3<double>::identity()) {
+		const Clock::time_point start = Clock::now();
+		EucIcpResult<double> result = { initial, {}, 0.0, 0.0, false };
+		result.iterations.reserve(options_.max_iterations);
+		if (count == 0 || tree_.empty()) {
+			result.total_seconds = elapsed(start);
+			return result;
+		}
+
+		// Source centroid and columns; the centroid is the accumulation origin for p.
+		sx_.resize(count);
+		sy_.resize(count);
+		sz_.resize(count);
+		double centroid[3] = {};
+		for (size_t i = 0; i < count; ++i) {
+			sx_[i] = static_cast<E>(detail::euc_get<0>(points[i]));
+			sy_[i] = static_cast<E>(detail::euc_get<1>(points[i]));
+			sz_[i] = static_cast<E>(detail::euc_get<2>(points[i]));
+			centroid[0] += static_cast<double>(sx_[i]);
+			centroid[1] += static_cast<double>(sy_[i]);
+			centroid[2] += static_cast<double>(sz_[i]);
+		}
+		const EuclideanCmplVector3<double> c(centroid[0] / static_cast<double>(count), centroid[1] / static_cast<double>(count), centroid[2] / static_cast<double>(count));
+
+		const double max_d = options_.max_correspondence_distance;
+		const E max_d2 = _STD isinf(max_d) ? _STD numeric_limits<E>::infinity() : static_cast<E>(max_d * max_d);
+		const size_t chunks = detail::chunk_count(count, detail::icp_grain, options_.threads);
+		partial_.resize(chunks);
+		double previous_rms = _STD numeric_limits<double>::infinity();
+
+		for (size_t it = 0; it < options_.max_iterations; ++it) {
+			const Clock::time_point begin = Clock::now();
+			const EucRigid3<double>& tf = result.transform;
+			E r[9], t[3];
+			for (size_t i = 0; i < 3; ++i) {
+				r[i * 3] = static_cast<E>(tf.rows[i].x_);
+				r[i * 3 + 1] = static_cast<E>(tf.rows[i].y_);
+				r[i * 3 + 2] = static_cast<E>(tf.rows[i].z_);
+			}
+			t[0] = static_cast<E>(tf.t.x_);
+			t[1] = static_cast<E>(tf.t.y_);
+			t[2] = static_cast<E>(tf.t.z_);
+			// Matches are accumulated relative to the moved source centroid, which keeps the sums small far from the origin.
+			const EuclideanCmplVector3<double> ref = tf.apply(c);
+			const double rp[3] = { ref.x_, ref.y_, ref.z_ };
+
+			detail::parallel_invoke(chunks, [&](size_t ch) {
+				detail::IcpAccumulator acc = {};
+				const size_t b = count * ch / chunks, e = count * (ch + 1) / chunks;
+				E bx[detail::icp_block], by[detail::icp_block], bz[detail::icp_block];
+				for (size_t blk = b; blk < e; blk += detail::icp_block) {
+					const size_t n = _STD min(detail::icp_block, e - blk);
+					detail::icp_transform(sx_.data() + blk, sy_.data() + blk, sz_.data() + blk, n, r, t, bx, by, bz);
+					for (size_t i = 0; i < n; ++i) {
+						const EucKdNeighbor<E> nb = tree_.nearest(bx[i], by[i], bz[i], max_d2);
+						if (nb.index == EucKdTree3<E>::npos) continue;
+						const auto& q = target_[nb.index];
+						const double p3[3] = { static_cast<double>(bx[i]) - rp[0], static_cast<double>(by[i]) - rp[1], static_cast<double>(bz[i]) - rp[2] };
+						const double q3[3] = { static_cast<double>(q.x_) - rp[0], static_cast<double>(q.y_) - rp[1], static_cast<double>(q.z_) - rp[2] };
+						acc.add(p3, q3, static_cast<double>(nb.distance_squared));
+					}
+				}
+				partial_[ch] = acc;
+			});
+			detail::IcpAccumulator acc = partial_[0];
+			for (size_t ch = 1; ch < chunks; ++ch) acc.merge(partial_[ch]);
+			const Clock::time_point solved = Clock::now();
+
+			EucIcpIterationStats stats = {};
+			stats.search_seconds = _STD chrono::duration<double>(solved - begin).count();
+			stats.correspondences = acc.count;
+			stats.rms = acc.count > 0 ? _STD sqrt(acc.error / static_cast<double>(acc.count)) : 0.0;
+			result.rms = stats.rms;
+			if (acc.count < 3) {
+				stats.seconds = elapsed(begin);
+				result.iterations.push_back(stats);
+				break;
+			}
+
+			const EucRigid3<double> step = detail::icp_solve(acc, rp);
+			result.transform = step.compose(result.transform);
+			stats.solve_seconds = elapsed(solved);
+			stats.seconds = elapsed(begin);
+			result.iterations.push_back(stats);
+
+			const EuclideanCmplVector3<double> moved = step.apply(ref);
+			const double shift = EuclideanCmplVector3<double>(moved.x_ - ref.x_, moved.y_ - ref.y_, moved.z_ - ref.z_).eucnorm();
+			const bool small_step = step.angle() < options_.min_rotation && shift < options_.min_translation;
+			const bool flat = _STD fabs(previous_rms - stats.rms) <= options_.tolerance * stats.rms;
+			previous_rms = stats.rms;
+			if (small_step || flat) {
+				result.converged = true;
+				break;
+			}
+		}
+		result.total_seconds = elapsed(start);
+		return result;
+	}
+};
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,323 @@
+//
+//	EuclideanVector Instrument
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Operation counters for the vector classes, enabled by defining THL_EUC_INSTRUMENT before including EuclideanVector.hpp.
+//
+//	When enabled, dot(), cross(), eucnorm_squared(), eucnorm(), normalize(), normalize_self()
+//	and every ResultPacker that is created increment a counter keyed by operation, element type and dimension.
+//	normalize() and normalize_self() also count the eucnorm() they call.
+//	Each thread owns its counters, so an increment is a relaxed load and store with no lock and no shared cache line.
+//	euc_instrument_snapshot() sums every live and finished thread. euc_instrument_reset() starts a new measurement window.
+//
+//	EUCINSTRUMENT_SCOPE("name") times the rest of the enclosing block with an EucInstrumentScope (at most one per source line).
+//	Each named scope accumulates its call count and elapsed nanoseconds per thread, and the snapshot reports them next to the counters.
+//	Call sites with the same name share one entry, so a scope inside a template is reported once for all its instantiations.
+//	The batch kernels (pairwise distances, top-k, k-means) carry such scopes.
+//
+//	When THL_EUC_INSTRUMENT is not defined, the hooks expand to nothing and ResultPacker keeps its layout.
+//	This header can also be included on its own to read the counters.
+//.
+
+// Ahead of the guard: EuclideanVector.hpp includes this header back once its macros are defined.
+#include "EuclideanVector.hpp"
+
+#ifndef THL_EUCLID_VECTOR_INSTRUMENT_HPP
+#define THL_EUCLID_VECTOR_INSTRUMENT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Counted operation classes.
+*/
+enum class EucOp : unsigned char {
+	dot,
+	cross,
+	eucnorm_squared,
+	eucnorm,
+	normalize,
+	normalize_self,
+	packer,
+};
+
+constexpr size_t EucOpCount = 7;
+
+EUCNODISCARD EUCVECTORINLINE const char* euc_op_name(EucOp op) noexcept {
+	constexpr const char* names[EucOpCount] = { "dot", "cross", "eucnorm_squared", "eucnorm", "normalize", "normalize_self", "packer" };
+	return names[static_cast<size_t>(op)];
+}
+
+/*
+	Counts of one element type and dimension.
+*/
+struct EucInstrumentEntry {
+	// typeid(E).name(), or "(other)" once every type slot is taken.
+	const char* type_name;
+	size_t dimension;
+	uint64_t counts[EucOpCount];
+
+	EUCNODISCARD EUCVECTORINLINE uint64_t operator[](EucOp op) const noexcept { return counts[static_cast<size_t>(op)]; }
+};
+
+/*
+	Calls and elapsed time of one named scope.
+*/
+struct EucInstrumentScopeEntry {
+	// The name given to EUCINSTRUMENT_SCOPE, or "(other)" once every scope slot is taken.
+	const char* name;
+	uint64_t calls;
+	uint64_t nanoseconds;
+};
+
+/*
+	Totals since the last reset. Entries with no counts are left out.
+*/
+struct EucInstrumentSnapshot {
+	_STD vector<EucInstrumentEntry> entries;
+	_STD vector<EucInstrumentScopeEntry> scopes;
+
+	EUCNODISCARD EUCVECTORINLINE uint64_t total(EucOp op) const noexcept {
+		uint64_t sum = 0;
+		for (const auto& e : entries) sum += e[op];
+		return sum;
+	}
+};
+
+//details.
+namespace detail {
+
+	constexpr size_t instrument_type_slots = 32;	// slot 0 collects the types that do not fit.
+	constexpr size_t instrument_dimensions = 4;
+	constexpr size_t instrument_cells = instrument_type_slots * instrument_dimensions * EucOpCount;
+	constexpr size_t instrument_scope_slots = 64;	// slot 0 collects the scopes that do not fit.
+
+	constexpr size_t instrument_cell(size_t slot, size_t dimension, EucOp op) noexcept {
+		return (slot * instrument_dimensions + (dimension - 1)) * EucOpCount + static_cast<size_t>(op);
+	}
+
+	struct InstrumentThread;
+
+	struct InstrumentRegistry {
+		_STD mutex mutex;
+		_STD vector<InstrumentThread*> threads;
+		const char* names[instrument_type_slots] = { "(other)" };
+		size_t used = 1;
+		uint64_t retired[instrument_cells] = {};	// counts of finished threads.
+		uint64_t baseline[instrument_cells] = {};	// totals at the last reset.
+		const char* scope_names[instrument_scope_slots] = { "(other)" };
+		size_t scopes_used = 1;
+		uint64_t retired_calls[instrument_scope_slots] = {};
+		uint64_t retired_nanos[instrument_scope_slots] = {};
+		uint64_t baseline_calls[instrument_scope_slots] = {};
+		uint64_t baseline_nanos[instrument_scope_slots] = {};
+	};
+
+	EUCVECTORINLINE InstrumentRegistry& instrument_registry() {
+		static InstrumentRegistry registry;
+		return registry;
+	}
+
+	struct InstrumentThread {
+		// Written only by the owning thread; atomic so that snapshots may read them.
+		_STD atomic<uint64_t> counts[instrument_cells];
+		_STD atomic<uint64_t> scope_calls[instrument_scope_slots];
+		_STD atomic<uint64_t> scope_nanos[instrument_scope_slots];
+
+		InstrumentThread() {
+			for (auto& c : counts) c.store(0, _STD memory_order_relaxed);
+			for (auto& c : scope_calls) c.store(0, _STD memory_order_relaxed);
+			for (auto& c : scope_nanos) c.store(0, _STD memory_order_relaxed);
+			auto& registry = instrument_registry();
+			_STD lock_guard<_STD mutex> lock(registry.mutex);
+			registry.threads.push_back(this);
+		}
+
+		~InstrumentThread() {
+			auto& registry = instrument_registry();
+			_STD lock_guard<_STD mutex> lock(registry.mutex);
+			for (size_t i = 0; i < instrument_cells; ++i) registry.retired[i] += counts[i].load(_STD memory_order_relaxed);
+			for (size_t i = 0; i < instrument_scope_slots; ++i) {
+				registry.retired_calls[i] += scope_calls[i].load(_STD memory_order_relaxed);
+				registry.retired_nanos[i] += scope_nanos[i].load(_STD memory_order_relaxed);
+			}
+			for (auto it = registry.threads.begin(); it != registry.threads.end(); ++it) {
+				if (*it == this) {
+					registry.threads.erase(it);
+					break;
+				}
+			}
+		}
+	};
+
+	EUCVECTORINLINE InstrumentThread& instrument_thread() {
+		thread_local InstrumentThread counters;
+		return counters;
+	}
+
+	EUCVECTORINLINE size_t instrument_register_type(const char* name) {
+		auto& registry = instrument_registry();
+		_STD lock_guard<_STD mutex> lock(registry.mutex);
+		if (registry.used == instrument_type_slots) return 0;
+		registry.names[registry.used] = name;
+		return registry.used++;
+	}
+
+	// The slot already named name, or a new one. Every instantiation of a template registers its scope again.
+	EUCVECTORINLINE size_t instrument_register_scope(const char* name) {
+		auto& registry = instrument_registry();
+		_STD lock_guard<_STD mutex> lock(registry.mutex);
+		for (size_t slot = 1; slot < registry.scopes_used; ++slot) {
+			if (_STD strcmp(registry.scope_names[slot], name) == 0) return slot;
+		}
+		if (registry.scopes_used == instrument_scope_slots) return 0;
+		registry.scope_names[registry.scopes_used] = name;
+		return registry.scopes_used++;
+	}
+
+	template<class E>
+	EUCVECTORINLINE size_t instrument_type_slot() {
+		static const size_t slot = instrument_register_type(typeid(E).name());
+		return slot;
+	}
+
+	// Sum of every thread since start-up. The registry lock must be held.
+	EUCVECTORINLINE void instrument_totals(InstrumentRegistry& registry, uint64_t* out) noexcept {
+		for (size_t i = 0; i < instrument_cells; ++i) out[i] = registry.retired[i];
+		for (const InstrumentThread* t : registry.threads) {
+			for (size_t i = 0; i < instrument_cells; ++i) out[i] += t->counts[i].load(_STD memory_order_relaxed);
+		}
+	}
+
+	// Scope totals of every thread since start-up. The registry lock must be held.
+	EUCVECTORINLINE void instrument_scope_totals(InstrumentRegistry& registry, uint64_t* calls, uint64_t* nanos) noexcept {
+		for (size_t i = 0; i < instrument_scope_slots; ++i) {
+			calls[i] = registry.retired_calls[i];
+			nanos[i] = registry.retired_nanos[i];
+		}
+		for (const InstrumentThread* t : registry.threads) {
+			for (size_t i = 0; i < instrument_scope_slots; ++i) {
+				calls[i] += t->scope_calls[i].load(_STD memory_order_relaxed);
+				nanos[i] += t->scope_nanos[i].load(_STD memory_order_relaxed);
+			}
+		}
+	}
+
+	/*
+		@brief
+			Count one operation on a vector of element type E and dimension D.
+	*/
+	template<class E, size_t D>
+	EUCVECTORINLINE void instrument_record(EucOp op) noexcept {
+		static_assert(D >= 1 && D <= instrument_dimensions, "Dimension is out of range");
+		auto& c = instrument_thread().counts[instrument_cell(instrument_type_slot<E>(), D, op)];
+		c.store(c.load(_STD memory_order_relaxed) + 1, _STD memory_order_relaxed);
+	}
+
+	/*
+		Member of ResultPacker in instrumented builds.
+		Its default member initializer runs once per packer created by aggregate initialization. Copies are not counted.
+		The constructor is constexpr so that packers stay literal types; constant evaluation is not counted.
+	*/
+	template<class E, size_t D>
+	struct InstrumentPackerTag {
+		constexpr InstrumentPackerTag() noexcept {
+#if defined(EUCCONSTANT_EVALUATED)
+			if (EUCCONSTANT_EVALUATED()) return;
+#elif defined(__cpp_lib_is_constant_evaluated)
+			if (_STD is_constant_evaluated()) return;
+#endif
+			instrument_record<E, D>(EucOp::packer);
+		}
+		constexpr InstrumentPackerTag(const InstrumentPackerTag&) noexcept = default;
+	};
+
+}
+
+/*
+	@brief
+		Times its own lifetime and adds it to a named scope of the calling thread.
+		slot comes from detail::instrument_register_scope; EUCINSTRUMENT_SCOPE looks the slot up once per call site.
+*/
+class EucInstrumentScope {
+public:
+	explicit EucInstrumentScope(size_t slot) noexcept : slot_(slot), start_(_STD chrono::steady_clock::now()) {}
+
+	EucInstrumentScope(const EucInstrumentScope&) = delete;
+	EucInstrumentScope& operator=(const EucInstrumentScope&) = delete;
+
+	~EucInstrumentScope() {
+		const auto elapsed = _STD chrono::duration_cast<_STD chrono::nanoseconds>(_STD chrono::steady_clock::now() - start_).count();
+		auto& thread = detail::instrument_thread();
+		auto& calls = thread.scope_calls[slot_];
+		auto& nanos = thread.scope_nanos[slot_];
+		calls.store(calls.load(_STD memory_order_relaxed) + 1, _STD memory_order_relaxed);
+		nanos.store(nanos.load(_STD memory_order_relaxed) + static_cast<uint64_t>(elapsed), _STD memory_order_relaxed);
+	}
+
+private:
+	size_t slot_;
+	_STD chrono::steady_clock::time_point start_;
+};
+
+/*
+	@brief
+		Counts of every thread since the last euc_instrument_reset().
+*/
+EUCNODISCARD EUCVECTORINLINE EucInstrumentSnapshot euc_instrument_snapshot() {
+	auto& registry = detail::instrument_registry();
+	_STD vector<uint64_t> totals(detail::instrument_cells);
+	uint64_t calls[detail::instrument_scope_slots], nanos[detail::instrument_scope_slots];
+	EucInstrumentSnapshot snapshot;
+
+	_STD lock_guard<_STD mutex> lock(registry.mutex);
+	detail::instrument_totals(registry, totals.data());
+	detail::instrument_scope_totals(registry, calls, nanos);
+	for (size_t slot = 0; slot < registry.used; ++slot) {
+		for (size_t d = 1; d <= detail::instrument_dimensions; ++d) {
+			EucInstrumentEntry entry{ registry.names[slot], d, {} };
+			bool any = false;
+			for (size_t op = 0; op < EucOpCount; ++op) {
+				const size_t cell = detail::instrument_cell(slot, d, static_cast<EucOp>(op));
+				entry.counts[op] = totals[cell] - registry.baseline[cell];
+				any |= entry.counts[op] != 0;
+			}
+			if (any) snapshot.entries.push_back(entry);
+		}
+	}
+	for (size_t slot = 0; slot < registry.scopes_used; ++slot) {
+		const uint64_t n = calls[slot] - registry.baseline_calls[slot];
+		if (n != 0) snapshot.scopes.push_back({ registry.scope_names[slot], n, nanos[slot] - registry.baseline_nanos[slot] });
+	}
+	return snapshot;
+}
+
+/*
+	@brief
+		Start a new measurement window.
+		Other threads keep counting without interruption; their counts so far are moved into the baseline.
+*/
+EUCVECTORINLINE void euc_instrument_reset() {
+	auto& registry = detail::instrument_registry();
+	_STD lock_guard<_STD mutex> lock(registry.mutex);
+	detail::instrument_totals(registry, registry.baseline);
+	detail::instrument_scope_totals(registry, registry.baseline_calls, registry.baseline_nanos);
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,458 @@
+//
+//	EuclideanVector Int
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Integer vector arithmetic with explicit overflow behaviour, and SSE2 / AVX2 batch kernels.
+//
+//	The element operators of EuclideanCmplVectorN<int> follow C++ rules: signed overflow is undefined, and
+//	int16 / uint8 results are promoted to int and narrowed back. The functions here define the result instead:
+//		Wrap		modulo 2^bits.
+//		Saturate	clamped to the range of the element type.
+//	Shifts by the element width or more give 0 (left, unsigned right) or the sign (signed right).
+//
+//	euc_add_wrap / euc_add_sat / euc_sub_wrap / euc_sub_sat / euc_shl / euc_shr work on one vector or packer
+//	and return a packer.
+//	euc_int_add / euc_int_sub / euc_int_shift_left / euc_int_shift_right work on arrays. For flat int32, int16
+//	and uint8 vectors, the arrays are processed as one element stream, 32 bytes per step with AVX2 and 16 bytes
+//	with SSE2. int32 has no saturating instruction, so the overflow lanes are detected from the sign bits and
+//	replaced.
+//	euc_int_tile_index turns int32 coordinates into linear tile indices (shift, range check, multiply-add),
+//	8 points per step with AVX2.
+//.
+
+#ifndef THL_EUCLID_VECTOR_INT_HPP
+#define THL_EUCLID_VECTOR_INT_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <cstdint>
+#include <limits>
+
+//name space begin.
+namespace thl::vector {
+
+enum class EucIntOverflow {
+	Wrap,
+	Saturate,
+};
+
+// Tile index of points outside the grid.
+inline constexpr uint32_t euc_tile_npos = 0xffffffffu;
+
+//meta functions.
+namespace meta {
+
+	template<class V>
+	constexpr bool is_euc_int_vector_v = [] {
+		if constexpr (is_euc_vector_v<V>) {
+			return _STD is_integral_v<euc_elem_t<V>> && !_STD is_same_v<euc_elem_t<V>, bool> && euc_dimension_v<V> >= 2;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	constexpr size_t int_grain = 65536;
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE constexpr E int_add_wrap(E a, E b) noexcept {
+		using U = _STD make_unsigned_t<E>;
+		return static_cast<E>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE constexpr E int_sub_wrap(E a, E b) noexcept {
+		using U = _STD make_unsigned_t<E>;
+		return static_cast<E>(static_cast<U>(static_cast<U>(a) - static_cast<U>(b)));
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE constexpr E int_add_sat(E a, E b) noexcept {
+		const E s = int_add_wrap(a, b);
+		if constexpr (_STD is_signed_v<E>) {
+			if ((a < 0) == (b < 0) && (s < 0) != (a < 0)) return a < 0 ? _STD numeric_limits<E>::min() : _STD numeric_limits<E>::max();
+			return s;
+		}
+		else {
+			return s < a ? _STD numeric_limits<E>::max() : s;
+		}
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE constexpr E int_sub_sat(E a, E b) noexcept {
+		const E d = int_sub_wrap(a, b);
+		if constexpr (_STD is_signed_v<E>) {
+			if ((a < 0) != (b < 0) && (d < 0) != (a < 0)) return a < 0 ? _STD numeric_limits<E>::min() : _STD numeric_limits<E>::max();
+			return d;
+		}
+		else {
+			return a < b ? E(0) : d;
+		}
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE constexpr E int_shl(E a, unsigned bits) noexcept {
+		using U = _STD make_unsigned_t<E>;
+		if (bits >= sizeof(E) * 8) return E(0);
+		return static_cast<E>(static_cast<U>(static_cast<U>(a) << bits));
+	}
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE constexpr E int_shr(E a, unsigned bits) noexcept {
+		if (bits >= sizeof(E) * 8) {
+			if constexpr (_STD is_signed_v<E>) return a < 0 ? E(-1) : E(0);
+			else return E(0);
+		}
+		return static_cast<E>(a >> bits);
+	}
+
+	template<class V, class W, class F, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE auto int_apply(const V& a, const W& b, F&& fn, _STD index_sequence<I...>) {
+		using E = meta::euc_elem_t<V>;
+		return meta::euc_packer_t<E, sizeof...(I)>{ fn(static_cast<E>(euc_get<I>(a)), static_cast<E>(euc_get<I>(b)))... };
+	}
+
+	template<class V, class F, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE auto int_apply(const V& a, F&& fn, _STD index_sequence<I...>) {
+		using E = meta::euc_elem_t<V>;
+		return meta::euc_packer_t<E, sizeof...(I)>{ fn(static_cast<E>(euc_get<I>(a)))... };
+	}
+
+	/*
+		Integer registers for the element types with SIMD kernels. lanes is 0 for the others.
+	*/
+	template<class E>
+	struct IntReg {
+		static constexpr size_t lanes = 0;
+	};
+
+#if defined(THL_EUC_AVX2)
+	struct IntRegBase {
+		using type = __m256i;
+		static EUCVECTORINLINE type load(const void* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+		static EUCVECTORINLINE void store(void* p, type v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+		static EUCVECTORINLINE __m128i count(unsigned bits) noexcept { return _mm_cvtsi32_si128(static_cast<int>(bits)); }
+	};
+
+	template<>
+	struct IntReg<int32_t> : IntRegBase {
+		static constexpr size_t lanes = 8;
+		static EUCVECTORINLINE type add_wrap(type a, type b) noexcept { return _mm256_add_epi32(a, b); }
+		static EUCVECTORINLINE type sub_wrap(type a, type b) noexcept { return _mm256_sub_epi32(a, b); }
+		static EUCVECTORINLINE type saturate(type a, type r, type overflow) noexcept {
+			const type sat = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7fffffff));
+			return _mm256_blendv_epi8(r, sat, _mm256_srai_epi32(overflow, 31));
+		}
+		static EUCVECTORINLINE type add_sat(type a, type b) noexcept {
+			const type s = _mm256_add_epi32(a, b);
+			return saturate(a, s, _mm256_and_si256(_mm256_xor_si256(a, s), _mm256_xor_si256(b, s)));
+		}
+		static EUCVECTORINLINE type sub_sat(type a, type b) noexcept {
+			const type d = _mm256_sub_epi32(a, b);
+			return saturate(a, d, _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, d)));
+		}
+		static EUCVECTORINLINE type shl(type a, unsigned bits) noexcept { return _mm256_sll_epi32(a, count(bits)); }
+		static EUCVECTORINLINE type shr(type a, unsigned bits) noexcept { return _mm256_sra_epi32(a, count(bits)); }
+	};
+
+	template<>
+	struct IntReg<int16_t> : IntRegBase {
+		static constexpr size_t lanes = 16;
+		static EUCVECTORINLINE type add_wrap(type a, type b) noexcept { return _mm256_add_epi16(a, b); }
+		static EUCVECTORINLINE type sub_wrap(type a, type b) noexcept { return _mm256_sub_epi16(a, b); }
+		static EUCVECTORINLINE type add_sat(type a, type b) noexcept { return _mm256_adds_epi16(a, b); }
+		static EUCVECTORINLINE type sub_sat(type a, type b) noexcept { return _mm256_subs_epi16(a, b); }
+		static EUCVECTORINLINE type shl(type a, unsigned bits) noexcept { return _mm256_sll_epi16(a, count(bits)); }
+		static EUCVECTORINLINE type shr(type a, unsigned bits) noexcept { return _mm256_sra_epi16(a, count(bits)); }
+	};
+
+	template<>
+	struct IntReg<uint8_t> : IntRegBase {
+		static constexpr size_t lanes = 32;
+		static EUCVECTORINLINE type add_wrap(type a, type b) noexcept { return _mm256_add_epi8(a, b); }
+		static EUCVECTORINLINE type sub_wrap(type a, type b) noexcept { return _mm256_sub_epi8(a, b); }
+		static EUCVECTORINLINE type add_sat(type a, type b) noexcept { return _mm256_adds_epu8(a, b); }
+		static EUCVECTORINLINE type sub_sat(type a, type b) noexcept { return _mm256_subs_epu8(a, b); }
+		// No 8-bit shifts: shift 16-bit lanes and mask off the bits that crossed a byte.
+		static EUCVECTORINLINE type shl(type a, unsigned bits) noexcept {
+			return _mm256_and_si256(_mm256_sll_epi16(a, count(bits)), _mm256_set1_epi8(static_cast<char>(0xffu << bits)));
+		}
+		static EUCVECTORINLINE type shr(type a, unsigned bits) noexcept {
+			return _mm256_and_si256(_mm256_srl_epi16(a, count(bits)), _mm256_set1_epi8(static_cast<char>(0xffu >> bits)));
+		}
+	};
+#elif defined(THL_EUC_SSE2)
+	struct IntRegBase {
+		using type = __m128i;
+		static EUCVECTORINLINE type load(const void* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+		static EUCVECTORINLINE void store(void* p, type v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+		static EUCVECTORINLINE __m128i count(unsigned bits) noexcept { return _mm_cvtsi32_si128(static_cast<int>(bits)); }
+	};
+
+	template<>
+	struct IntReg<int32_t> : IntRegBase {
+		static constexpr size_t lanes = 4;
+		static EUCVECTORINLINE type add_wrap(type a, type b) noexcept { return _mm_add_epi32(a, b); }
+		static EUCVECTORINLINE type sub_wrap(type a, type b) noexcept { return _mm_sub_epi32(a, b); }
+		static EUCVECTORINLINE type saturate(type a, type r, type overflow) noexcept {
+			const type sat = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7fffffff));
+			const type mask = _mm_srai_epi32(overflow, 31);
+			return _mm_or_si128(_mm_and_si128(mask, sat), _mm_andnot_si128(mask, r));
+		}
+		static EUCVECTORINLINE type add_sat(type a, type b) noexcept {
+			const type s = _mm_add_epi32(a, b);
+			return saturate(a, s, _mm_and_si128(_mm_xor_si128(a, s), _mm_xor_si128(b, s)));
+		}
+		static EUCVECTORINLINE type sub_sat(type a, type b) noexcept {
+			const type d = _mm_sub_epi32(a, b);
+			return saturate(a, d, _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, d)));
+		}
+		static EUCVECTORINLINE type shl(type a, unsigned bits) noexcept { return _mm_sll_epi32(a, count(bits)); }
+		static EUCVECTORINLINE type shr(type a, unsigned bits) noexcept { return _mm_sra_epi32(a, count(bits)); }
+	};
+
+	template<>
+	struct IntReg<int16_t> : IntRegBase {
+		static constexpr size_t lanes = 8;
+		static EUCVECTORINLINE type add_wrap(type a, type b) noexcept { return _mm_add_epi16(a, b); }
+		static EUCVECTORINLINE type sub_wrap(type a, type b) noexcept { return _mm_sub_epi16(a, b); }
+		static EUCVECTORINLINE type add_sat(type a, type b) noexcept { return _mm_adds_epi16(a, b); }
+		static EUCVECTORINLINE type sub_sat(type a, type b) noexcept { return _mm_subs_epi16(a, b); }
+		static EUCVECTORINLINE type shl(type a, unsigned bits) noexcept { return _mm_sll_epi16(a, count(bits)); }
+		static EUCVECTORINLINE type shr(type a, unsigned bits) noexcept { return _mm_sra_epi16(a, count(bits)); }
+	};
+
+	template<>
+	struct IntReg<uint8_t> : IntRegBase {
+		static constexpr size_t lanes = 16;
+		static EUCVECTORINLINE type add_wrap(type a, type b) noexcept { return _mm_add_epi8(a, b); }
+		static EUCVECTORINLINE type sub_wrap(type a, type b) noexcept { return _mm_sub_epi8(a, b); }
+		static EUCVECTORINLINE type add_sat(type a, type b) noexcept { return _mm_adds_epu8(a, b); }
+		static EUCVECTORINLINE type sub_sat(type a, type b) noexcept { return _mm_subs_epu8(a, b); }
+		// No 8-bit shifts: shift 16-bit lanes and mask off the bits that crossed a byte.
+		static EUCVECTORINLINE type shl(type a, unsigned bits) noexcept {
+			return _mm_and_si128(_mm_sll_epi16(a, count(bits)), _mm_set1_epi8(static_cast<char>(0xffu << bits)));
+		}
+		static EUCVECTORINLINE type shr(type a, unsigned bits) noexcept {
+			return _mm_and_si128(_mm_srl_epi16(a, count(bits)), _mm_set1_epi8(static_cast<char>(0xffu >> bits)));
+		}
+	};
+#endif
+
+	/*
+		@brief
+			out[i] = op(a[i], b[i]) over n elements. vop(IntReg<E>{}, ...) works on registers, sop on single elements.
+			vop takes the register struct as a parameter, so its body is only instantiated for the types that have one.
+	*/
+	template<class E, class VOp, class SOp>
+	EUCVECTORINLINE void int_stream(const E* a, const E* b, E* out, size_t n, VOp&& vop, SOp&& sop) noexcept {
+		size_t i = 0;
+		if constexpr (IntReg<E>::lanes != 0) {
+			constexpr size_t L = IntReg<E>::lanes;
+			for (; i + L <= n; i += L) IntReg<E>::store(out + i, vop(IntReg<E>{}, IntReg<E>::load(a + i), IntReg<E>::load(b + i)));
+		}
+		for (; i < n; ++i) out[i] = sop(a[i], b[i]);
+	}
+
+	template<class E, class VOp, class SOp>
+	EUCVECTORINLINE void int_stream(const E* a, E* out, size_t n, VOp&& vop, SOp&& sop) noexcept {
+		size_t i = 0;
+		if constexpr (IntReg<E>::lanes != 0) {
+			constexpr size_t L = IntReg<E>::lanes;
+			for (; i + L <= n; i += L) IntReg<E>::store(out + i, vop(IntReg<E>{}, IntReg<E>::load(a + i)));
+		}
+		for (; i < n; ++i) out[i] = sop(a[i]);
+	}
+
+	template<class V>
+	constexpr bool is_int_stream_v = [] {
+		if constexpr (meta::is_euc_flat_v<V>) {
+			return _STD is_integral_v<meta::euc_elem_t<V>>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+	template<bool Add, class V>
+	EUCVECTORINLINE void int_add_sub(const V* a, const V* b, V* out, size_t count, EucIntOverflow mode, unsigned threads) {
+		using E = meta::euc_elem_t<V>;
+		constexpr size_t D = meta::euc_dimension_v<V>;
+		parallel_for(count, int_grain, threads, [&](size_t s, size_t e) {
+			if constexpr (is_int_stream_v<V>) {
+				const E* pa = reinterpret_cast<const E*>(a + s);
+				const E* pb = reinterpret_cast<const E*>(b + s);
+				E* po = reinterpret_cast<E*>(out + s);
+				const size_t n = (e - s) * D;
+				if (mode == EucIntOverflow::Saturate) {
+					if constexpr (Add) int_stream(pa, pb, po, n, [](auto r, auto x, auto y) { return decltype(r)::add_sat(x, y); }, int_add_sat<E>);
+					else int_stream(pa, pb, po, n, [](auto r, auto x, auto y) { return decltype(r)::sub_sat(x, y); }, int_sub_sat<E>);
+				}
+				else {
+					if constexpr (Add) int_stream(pa, pb, po, n, [](auto r, auto x, auto y) { return decltype(r)::add_wrap(x, y); }, int_add_wrap<E>);
+					else int_stream(pa, pb, po, n, [](auto r, auto x, auto y) { return decltype(r)::sub_wrap(x, y); }, int_sub_wrap<E>);
+				}
+			}
+			else {
+				const auto fn = mode == EucIntOverflow::Saturate ? (Add ? int_add_sat<E> : int_sub_sat<E>) : (Add ? int_add_wrap<E> : int_sub_wrap<E>);
+				for (size_t i = s; i < e; ++i) out[i] = int_apply(a[i], b[i], fn, _STD make_index_sequence<D>());
+			}
+		});
+	}
+
+	template<bool Left, class V>
+	EUCVECTORINLINE void int_shift(const V* src, V* out, size_t count, unsigned bits, unsigned threads) {
+		using E = meta::euc_elem_t<V>;
+		constexpr size_t D = meta::euc_dimension_v<V>;
+		bits = bits > sizeof(E) * 8 ? static_cast<unsigned>(sizeof(E) * 8) : bits;
+		parallel_for(count, int_grain, threads, [&](size_t s, size_t e) {
+			if constexpr (is_int_stream_v<V>) {
+				const E* ps = reinterpret_cast<const E*>(src + s);
+				E* po = reinterpret_cast<E*>(out + s);
+				const size_t n = (e - s) * D;
+				if constexpr (Left) int_stream(ps, po, n, [bits](auto r, auto x) { return decltype(r)::shl(x, bits); }, [bits](E x) { return int_shl(x, bits); });
+				else int_stream(ps, po, n, [bits](auto r, auto x) { return decltype(r)::shr(x, bits); }, [bits](E x) { return int_shr(x, bits); });
+			}
+			else {
+				for (size_t i = s; i < e; ++i) {
+					out[i] = int_apply(src[i], [bits](E x) { return Left ? int_shl(x, bits) : int_shr(x, bits); }, _STD make_index_sequence<D>());
+				}
+			}
+		});
+	}
+
+}
+
+/*
+	@brief
+		Element-wise a + b and a - b modulo 2^bits, and clamped to the element range.
+*/
+template<class V, class W, meta::if_t<meta::is_euc_int_vector_v<V> && meta::is_euc_int_vector_v<W> && meta::euc_dimension_v<V> == meta::euc_dimension_v<W>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_add_wrap(const V& a, const W& b) noexcept {
+	return detail::int_apply(a, b, detail::int_add_wrap<meta::euc_elem_t<V>>, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+template<class V, class W, meta::if_t<meta::is_euc_int_vector_v<V> && meta::is_euc_int_vector_v<W> && meta::euc_dimension_v<V> == meta::euc_dimension_v<W>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_sub_wrap(const V& a, const W& b) noexcept {
+	return detail::int_apply(a, b, detail::int_sub_wrap<meta::euc_elem_t<V>>, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+template<class V, class W, meta::if_t<meta::is_euc_int_vector_v<V> && meta::is_euc_int_vector_v<W> && meta::euc_dimension_v<V> == meta::euc_dimension_v<W>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_add_sat(const V& a, const W& b) noexcept {
+	return detail::int_apply(a, b, detail::int_add_sat<meta::euc_elem_t<V>>, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+template<class V, class W, meta::if_t<meta::is_euc_int_vector_v<V> && meta::is_euc_int_vector_v<W> && meta::euc_dimension_v<V> == meta::euc_dimension_v<W>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_sub_sat(const V& a, const W& b) noexcept {
+	return detail::int_apply(a, b, detail::int_sub_sat<meta::euc_elem_t<V>>, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+/*
+	@brief
+		Element-wise shifts. Right shifts are arithmetic for signed elements.
+*/
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_shl(const V& a, unsigned bits) noexcept {
+	return detail::int_apply(a, [bits](meta::euc_elem_t<V> x) { return detail::int_shl(x, bits); }, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_shr(const V& a, unsigned bits) noexcept {
+	return detail::int_apply(a, [bits](meta::euc_elem_t<V> x) { return detail::int_shr(x, bits); }, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+}
+
+/*
+	@brief
+		euc_int_add: out[i] = a[i] + b[i]
+		euc_int_sub: out[i] = a[i] - b[i]
+		for count vectors. out may be a or b.
+*/
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_int_add(const V* a, const V* b, V* out, size_t count, EucIntOverflow mode = EucIntOverflow::Wrap, unsigned threads = 0) {
+	detail::int_add_sub<true>(a, b, out, count, mode, threads);
+}
+
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_int_sub(const V* a, const V* b, V* out, size_t count, EucIntOverflow mode = EucIntOverflow::Wrap, unsigned threads = 0) {
+	detail::int_add_sub<false>(a, b, out, count, mode, threads);
+}
+
+/*
+	@brief
+		euc_int_shift_left: out[i] = src[i] << bits
+		euc_int_shift_right: out[i] = src[i] >> bits
+		for count vectors. out may be src.
+*/
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_int_shift_left(const V* src, V* out, size_t count, unsigned bits, unsigned threads = 0) {
+	detail::int_shift<true>(src, out, count, bits, threads);
+}
+
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V> && !meta::is_euc_packer_v<V>> = 0>
+EUCVECTORINLINE void euc_int_shift_right(const V* src, V* out, size_t count, unsigned bits, unsigned threads = 0) {
+	detail::int_shift<false>(src, out, count, bits, threads);
+}
+
+/*
+	@brief
+		Linear tile index of 2D / 3D int32 points. The tile coordinate on axis k is p[k] >> shift, and
+		index = t0 + tiles[0] * (t1 + tiles[1] * t2). Points whose tile is outside [0, tiles[k]) get euc_tile_npos.
+*/
+template<class V, meta::if_t<meta::is_euc_int_vector_v<V> && _STD is_same_v<meta::euc_elem_t<V>, int32_t>
+	&& (meta::euc_dimension_v<V> == 2 || meta::euc_dimension_v<V> == 3)> = 0>
+EUCVECTORINLINE void euc_int_tile_index(const V* points, size_t count, unsigned shift, const uint32_t* tiles, uint32_t* out, unsigned threads = 0) {
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	shift = shift > 31 ? 31 : shift;
+	int32_t limit[D];
+	for (size_t k = 0; k < D; ++k) limit[k] = tiles[k] > 0x7fffffffu ? 0x7fffffff : static_cast<int32_t>(tiles[k]);
+	const auto scalar = [&](size_t i) {
+		int32_t t[D];
+		size_t k = 0;
+		detail::euc_for_each(points[i], [&](const int32_t& e) { t[k++] = e >> shift; });
+		uint32_t index = 0;
+		for (size_t a = D; a-- > 0;) {
+			if (t[a] < 0 || t[a] >= limit[a]) return euc_tile_npos;
+			index = index * tiles[a] + static_cast<uint32_t>(t[a]);
+		}
+		return index;
+	};
+	detail::parallel_for(count, detail::int_grain, threads, [&](size_t s, size_t e) {
+		size_t i = s;
+#if defined(THL_EUC_AVX2)
+		if constexpr (meta::is_euc_flat_v<V>) {
+			const int* base = reinterpret_cast<const int*>(points);
+			const __m256i gather = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(D)));
+			const __m128i cnt = _mm_cvtsi32_si128(static_cast<int>(shift));
+			const __m256i npos = _mm256_set1_epi32(-1);
+			for (; i + 8 <= e; i += 8) {
+				__m256i index = _mm256_setzero_si256();
+				__m256i outside = _mm256_setzero_si256();
+				for (size_t a = D; a-- > 0;) {
+					const __m256i t = _mm256_sra_epi32(_mm256_i32gather_epi32(base + i * D + a, gather, 4), cnt);
+					outside = _mm256_or_si256(outside, _mm256_cmpgt_epi32(_mm256_setzero_si256(), t));
+					outside = _mm256_or_si256(outside, _mm256_cmpgt_epi32(t, _mm256_set1_epi32(limit[a] - 1)));
+					index = _mm256_add_epi32(_mm256_mullo_epi32(index, _mm256_set1_epi32(static_cast<int>(tiles[a]))), t);
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blendv_epi8(index, npos, outside));
+			}
+		}
+#endif
+		for (; i < e; ++i) out[i] = scalar(i);
+	});
+}
+
+//name space end.
+}
+
+#endif
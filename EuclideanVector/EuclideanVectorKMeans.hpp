@@ -0,0 +1,399 @@
+//
+//	EuclideanVector KMeans
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Parallel k-means over arrays of EuclideanCmplVector2/3/4 (float or double).
+//
+//	Seeding is k-means++. Lloyd iterations use Hamerly's bounds: each point keeps an upper bound to its own
+//	center and a lower bound to every other center. A point is rescanned only when the bounds can no longer
+//	prove its assignment. Full rescans test 8 centers per step with AVX on float data.
+//	Centroid sums are accumulated in double per thread and merged after each iteration.
+//
+//	Every iteration records its time, reassignments, distance evaluations and pruned points in
+//	EucKMeansStats, so convergence and pruning efficiency can be monitored.
+//.
+
+#ifndef THL_EUCLID_VECTOR_KMEANS_HPP
+#define THL_EUCLID_VECTOR_KMEANS_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	K-means settings.
+*/
+struct EucKMeansOptions {
+	// Upper limit of Lloyd iterations.
+	size_t max_iterations = 100;
+	// Stop when no center moves farther than this (in distance units).
+	double tolerance = 0.0;
+	// Seed for k-means++.
+	uint64_t seed = 0x9e3779b97f4a7c15ull;
+	// Worker threads (0 = hardware).
+	unsigned threads = 0;
+	// Use Hamerly bounds. When false, every point is rescanned every iteration (plain Lloyd).
+	bool prune = true;
+};
+
+/*
+	Counters for one iteration.
+*/
+struct EucKMeansIterationStats {
+	double seconds;
+	size_t reassigned;
+	size_t distance_evaluations;
+	size_t pruned;
+	double max_shift;
+};
+
+/*
+	Counters for a whole run.
+*/
+struct EucKMeansStats {
+	_STD vector<EucKMeansIterationStats> iterations;
+	double seeding_seconds = 0.0;
+	double total_seconds = 0.0;
+	// Sum of squared distances from every point to its center, after the last iteration.
+	double inertia = 0.0;
+	bool converged = false;
+};
+
+template<class V>
+struct EucKMeansResult {
+	_STD vector<V> centroids;
+	_STD vector<uint32_t> labels;
+	EucKMeansStats stats;
+};
+
+//details.
+namespace detail {
+
+	using km_clock = _STD chrono::steady_clock;
+
+	EUCNODISCARD EUCVECTORINLINE double km_seconds(km_clock::time_point from) noexcept {
+		return _STD chrono::duration<double>(km_clock::now() - from).count();
+	}
+
+	template<class E, size_t D>
+	EUCNODISCARD EUCVECTORINLINE E km_dist2(const E* a, const E* b) noexcept {
+		E sum = E(0);
+		for (size_t k = 0; k < D; ++k) {
+			const E d = a[k] - b[k];
+			sum += d * d;
+		}
+		return sum;
+	}
+
+	/*
+		Centers in SoA form for the full scan, padded with far away dummies.
+	*/
+	template<class E, size_t D>
+	struct KmCenters {
+		_STD vector<E> comp[D];
+		size_t count;
+		size_t padded;
+
+		void load(const _STD vector<E>& aos, size_t k) {
+			count = k;
+			padded = (k + 7) / 8 * 8;
+			for (size_t d = 0; d < D; ++d) {
+				comp[d].assign(padded, _STD numeric_limits<E>::max() / E(16));
+				for (size_t c = 0; c < k; ++c) comp[d][c] = aos[c * D + d];
+			}
+		}
+	};
+
+	/*
+		@brief
+			Find the nearest and second nearest centers (squared distances).
+	*/
+	template<class E, size_t D>
+	EUCVECTORINLINE void km_nearest2(const E* p, const KmCenters<E, D>& centers, uint32_t& best, E& d1, E& d2) noexcept {
+		E b1 = _STD numeric_limits<E>::max(), b2 = _STD numeric_limits<E>::max();
+		uint32_t bi = 0;
+		size_t c = 0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			__m256 pv[D];
+			for (size_t d = 0; d < D; ++d) pv[d] = _mm256_set1_ps(p[d]);
+			alignas(32) float lane[8];
+			for (; c + 8 <= centers.padded; c += 8) {
+				__m256 acc = _mm256_setzero_ps();
+				for (size_t d = 0; d < D; ++d) {
+					const __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(centers.comp[d].data() + c), pv[d]);
+#if defined(THL_EUC_FMA)
+					acc = _mm256_fmadd_ps(diff, diff, acc);
+#else
+					acc = _mm256_add_ps(acc, _mm256_mul_ps(diff, diff));
+#endif
+				}
+				// Skip the whole group when no lane beats the current second best.
+				if (_mm256_movemask_ps(_mm256_cmp_ps(acc, _mm256_set1_ps(b2), _CMP_LT_OQ)) == 0) continue;
+				_mm256_store_ps(lane, acc);
+				for (size_t l = 0; l < 8; ++l) {
+					const float v = lane[l];
+					if (v < b1) {
+						b2 = b1;
+						b1 = v;
+						bi = static_cast<uint32_t>(c + l);
+					}
+					else if (v < b2) {
+						b2 = v;
+					}
+				}
+			}
+		}
+#endif
+		for (; c < centers.count; ++c) {
+			E v = E(0);
+			for (size_t d = 0; d < D; ++d) {
+				const E diff = centers.comp[d][c] - p[d];
+				v += diff * diff;
+			}
+			if (v < b1) {
+				b2 = b1;
+				b1 = v;
+				bi = static_cast<uint32_t>(c);
+			}
+			else if (v < b2) {
+				b2 = v;
+			}
+		}
+		best = bi;
+		d1 = b1;
+		d2 = b2;
+	}
+
+	/*
+		@brief
+			k-means++ seeding. Returns k centers as k * D elements.
+	*/
+	template<class E, size_t D>
+	EUCNODISCARD EUCVECTORINLINE _STD vector<E> km_seed(const E* x, size_t n, size_t k, uint64_t seed, unsigned threads) {
+		_STD vector<E> centers(k * D);
+		_STD vector<E> nearest(n, _STD numeric_limits<E>::max());
+		_STD mt19937_64 rng(seed);
+
+		size_t pick = _STD uniform_int_distribution<size_t>(0, n - 1)(rng);
+		for (size_t c = 0; c < k; ++c) {
+			for (size_t d = 0; d < D; ++d) centers[c * D + d] = x[pick * D + d];
+			if (c + 1 == k) break;
+
+			const E* center = centers.data() + c * D;
+			const size_t chunks = chunk_count(n, 8192, threads);
+			_STD vector<double> partial(chunks, 0.0);
+			parallel_invoke(chunks, [&](size_t ch) {
+				const size_t i0 = n * ch / chunks, i1 = n * (ch + 1) / chunks;
+				double sum = 0.0;
+				for (size_t i = i0; i < i1; ++i) {
+					const E dd = km_dist2<E, D>(x + i * D, center);
+					if (dd < nearest[i]) nearest[i] = dd;
+					sum += static_cast<double>(nearest[i]);
+				}
+				partial[ch] = sum;
+			});
+
+			double total = 0.0;
+			for (double s : partial) total += s;
+			if (!(total > 0.0)) {
+				// Fewer distinct points than k: repeat the last center.
+				continue;
+			}
+			double target = _STD uniform_real_distribution<double>(0.0, total)(rng);
+			size_t ch = 0;
+			while (ch + 1 < chunks && target >= partial[ch]) target -= partial[ch++];
+			size_t i = n * ch / chunks;
+			const size_t i1 = n * (ch + 1) / chunks;
+			for (; i + 1 < i1; ++i) {
+				target -= static_cast<double>(nearest[i]);
+				if (target < 0.0) break;
+			}
+			pick = i;
+		}
+		return centers;
+	}
+
+}
+
+/*
+	@brief
+		Cluster count points into k groups.
+		Returns the centroids, the label of every point and the per-iteration statistics.
+*/
+template<class V, meta::if_t<meta::is_euc_flat_v<V> && _STD is_floating_point_v<meta::euc_elem_t<V>>> = 0>
+EUCNODISCARD_MSG("The clustering result was ignored. This may be an unintended call.")
+	EUCVECTORINLINE EucKMeansResult<V> kmeans(const V* points, size_t count, size_t k, const EucKMeansOptions& options = {}) {
+	EUCINSTRUMENT_SCOPE("kmeans");
+	using E = meta::euc_elem_t<V>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+
+	EucKMeansResult<V> result;
+	const auto start = detail::km_clock::now();
+	if (count == 0 || k == 0) return result;
+	if (k > count) k = count;
+
+	const E* x = reinterpret_cast<const E*>(points);
+	const unsigned threads = options.threads;
+
+	auto t = detail::km_clock::now();
+	_STD vector<E> centers = detail::km_seed<E, D>(x, count, k, options.seed, threads);
+	result.stats.seeding_seconds = detail::km_seconds(t);
+
+	_STD vector<uint32_t>& labels = result.labels;
+	labels.assign(count, 0);
+	_STD vector<E> upper(count), lower(count);	// true distances, not squared.
+	_STD vector<E> half_gap(k), shift(k);
+	detail::KmCenters<E, D> soa;
+
+	const size_t chunks = detail::chunk_count(count, 4096, threads);
+	_STD vector<_STD vector<double>> sums(chunks, _STD vector<double>(k * D));
+	_STD vector<_STD vector<size_t>> sizes(chunks, _STD vector<size_t>(k));
+	_STD vector<size_t> counter_reassigned(chunks), counter_evals(chunks), counter_pruned(chunks);
+
+	for (size_t iter = 0; iter < options.max_iterations; ++iter) {
+		t = detail::km_clock::now();
+		soa.load(centers, k);
+
+		// Half distance from every center to its nearest other center.
+		for (size_t a = 0; a < k; ++a) {
+			E m = _STD numeric_limits<E>::max();
+			for (size_t b = 0; b < k; ++b) {
+				if (a == b) continue;
+				const E dd = detail::km_dist2<E, D>(centers.data() + a * D, centers.data() + b * D);
+				m = dd < m ? dd : m;
+			}
+			half_gap[a] = k > 1 ? _STD sqrt(m) / E(2) : _STD numeric_limits<E>::max();
+		}
+
+		// Assignment step.
+		const bool full = iter == 0 || !options.prune;
+		detail::parallel_invoke(chunks, [&](size_t ch) {
+			const size_t i0 = count * ch / chunks, i1 = count * (ch + 1) / chunks;
+			size_t reassigned = 0, evals = 0, pruned = 0;
+			auto& sum = sums[ch];
+			auto& size = sizes[ch];
+			_STD fill(sum.begin(), sum.end(), 0.0);
+			_STD fill(size.begin(), size.end(), size_t(0));
+
+			for (size_t i = i0; i < i1; ++i) {
+				const E* p = x + i * D;
+				uint32_t a = labels[i];
+				bool scan = full;
+				if (!scan) {
+					const E bound = half_gap[a] > lower[i] ? half_gap[a] : lower[i];
+					if (upper[i] > bound) {
+						// Tighten the upper bound before paying for a full scan.
+						upper[i] = _STD sqrt(detail::km_dist2<E, D>(p, centers.data() + a * D));
+						++evals;
+						scan = upper[i] > bound;
+					}
+					pruned += !scan;
+				}
+				if (scan) {
+					uint32_t best;
+					E d1, d2;
+					detail::km_nearest2<E, D>(p, soa, best, d1, d2);
+					evals += k;
+					reassigned += best != a;
+					a = best;
+					labels[i] = best;
+					upper[i] = _STD sqrt(d1);
+					lower[i] = k > 1 ? _STD sqrt(d2) : _STD numeric_limits<E>::max();
+				}
+				for (size_t d = 0; d < D; ++d) sum[a * D + d] += static_cast<double>(p[d]);
+				++size[a];
+			}
+			counter_reassigned[ch] = reassigned;
+			counter_evals[ch] = evals;
+			counter_pruned[ch] = pruned;
+		});
+
+		// Update step.
+		E max_shift = E(0), second_shift = E(0);
+		uint32_t max_shift_center = 0;
+		for (size_t c = 0; c < k; ++c) {
+			double acc[D] = {};
+			size_t members = 0;
+			for (size_t ch = 0; ch < chunks; ++ch) {
+				for (size_t d = 0; d < D; ++d) acc[d] += sums[ch][c * D + d];
+				members += sizes[ch][c];
+			}
+			E moved = E(0);
+			if (members != 0) {
+				E next[D];
+				for (size_t d = 0; d < D; ++d) next[d] = static_cast<E>(acc[d] / static_cast<double>(members));
+				moved = _STD sqrt(detail::km_dist2<E, D>(next, centers.data() + c * D));
+				for (size_t d = 0; d < D; ++d) centers[c * D + d] = next[d];
+			}
+			shift[c] = moved;
+			if (moved > max_shift) {
+				second_shift = max_shift;
+				max_shift = moved;
+				max_shift_center = static_cast<uint32_t>(c);
+			}
+			else if (moved > second_shift) {
+				second_shift = moved;
+			}
+		}
+
+		// Bound maintenance.
+		detail::parallel_for(count, 8192, threads, [&](size_t i0, size_t i1) {
+			for (size_t i = i0; i < i1; ++i) {
+				const uint32_t a = labels[i];
+				upper[i] += shift[a];
+				lower[i] -= (a == max_shift_center) ? second_shift : max_shift;
+			}
+		});
+
+		EucKMeansIterationStats it{};
+		for (size_t ch = 0; ch < chunks; ++ch) {
+			it.reassigned += counter_reassigned[ch];
+			it.distance_evaluations += counter_evals[ch];
+			it.pruned += counter_pruned[ch];
+		}
+		it.max_shift = static_cast<double>(max_shift);
+		it.seconds = detail::km_seconds(t);
+		result.stats.iterations.push_back(it);
+
+		if ((iter != 0 && it.reassigned == 0) || static_cast<double>(max_shift) <= options.tolerance) {
+			result.stats.converged = true;
+			break;
+		}
+	}
+
+	// Exact inertia for the final assignment.
+	_STD vector<double> partial(chunks, 0.0);
+	detail::parallel_invoke(chunks, [&](size_t ch) {
+		const size_t i0 = count * ch / chunks, i1 = count * (ch + 1) / chunks;
+		double sum = 0.0;
+		for (size_t i = i0; i < i1; ++i) sum += static_cast<double>(detail::km_dist2<E, D>(x + i * D, centers.data() + labels[i] * D));
+		partial[ch] = sum;
+	});
+	for (double s : partial) result.stats.inertia += s;
+
+	result.centroids.reserve(k);
+	for (size_t c = 0; c < k; ++c) result.centroids.push_back(detail::euc_make<V>(centers.data() + c * D));
+	result.stats.total_seconds = detail::km_seconds(start);
+	return result;
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,241 @@
+//
+//	EuclideanVector KdTree
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Static KD-tree over 3D points for nearest neighbour queries.
+//
+//	The tree is built by median splits on the axis of widest extent. Points are reordered into leaf order and
+//	stored as SoA columns padded with +inf. Each leaf therefore covers a contiguous range. With AVX (float),
+//	a leaf is scanned 8 points per step with a masked tail.
+//	A query descends to the nearest leaf first, then visits the far sides whose splitting plane is closer than the
+//	best distance so far. It uses an explicit stack and never allocates.
+//
+//	Ties go to the point visited first, with the same result with or without SIMD.
+//.
+
+#ifndef THL_EUCLID_VECTOR_KDTREE_HPP
+#define THL_EUCLID_VECTOR_KDTREE_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Result of a nearest neighbour query. index is EucKdTree3<E>::npos when nothing is within range.
+*/
+template<class E = float>
+struct EucKdNeighbor {
+	uint32_t index;
+	E distance_squared;
+};
+
+/*
+	KD-tree over 3D points. E is the coordinate type used for storage and distances.
+*/
+template<class E = float>
+class EucKdTree3 {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucKdTree3 needs a floating point coordinate type");
+
+	static constexpr uint32_t npos = 0xffffffffu;
+
+protected:
+
+	static constexpr uint32_t Leaf = 3;
+	static constexpr size_t Pad = 8;
+	static constexpr size_t MaxDepth = 64;
+
+	struct Node {
+		E split;
+		uint32_t axis;		// 0..2, or Leaf.
+		uint32_t a, b;		// children, or the point range of a leaf.
+	};
+
+	_STD vector<Node> nodes_;
+	_STD vector<E> px_, py_, pz_;		// leaf order, padded.
+	_STD vector<uint32_t> index_;		// leaf order -> input index.
+	size_t leaf_size_;
+
+	// Builds over index_, reading the columns in input order; build() gathers them into leaf order afterwards.
+	EUCVECTORINLINE uint32_t build_node(uint32_t b, uint32_t e, size_t depth) {
+		const uint32_t id = static_cast<uint32_t>(nodes_.size());
+		nodes_.push_back(Node{ E(0), Leaf, b, e });
+		if (e - b <= leaf_size_ || depth + 1 >= MaxDepth) return id;
+
+		const E* cols[3] = { px_.data(), py_.data(), pz_.data() };
+		E lo[3], hi[3];
+		for (size_t k = 0; k < 3; ++k) lo[k] = hi[k] = cols[k][index_[b]];
+		for (uint32_t i = b + 1; i < e; ++i) {
+			for (size_t k = 0; k < 3; ++k) {
+				const E v = cols[k][index_[i]];
+				lo[k] = _STD min(lo[k], v);
+				hi[k] = _STD max(hi[k], v);
+			}
+		}
+		uint32_t axis = 0;
+		for (uint32_t k = 1; k < 3; ++k) {
+			if (hi[k] - lo[k] > hi[axis] - lo[axis]) axis = k;
+		}
+		if (!(hi[axis] > lo[axis])) return id;	// all points coincide.
+
+		const E* col = cols[axis];
+		const uint32_t m = b + (e - b) / 2;
+		_STD nth_element(index_.begin() + b, index_.begin() + m, index_.begin() + e, [col](uint32_t l, uint32_t r) { return col[l] < col[r]; });
+
+		nodes_[id].axis = axis;
+		nodes_[id].split = col[index_[m]];
+		const uint32_t left = build_node(b, m, depth + 1);
+		const uint32_t right = build_node(m, e, depth + 1);
+		nodes_[id].a = left;
+		nodes_[id].b = right;
+		return id;
+	}
+
+	EUCVECTORINLINE void scan_leaf(const Node& node, E x, E y, E z, E& best, uint32_t& best_at) const noexcept {
+		uint32_t i = node.a;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			const __m256 qx = _mm256_set1_ps(x), qy = _mm256_set1_ps(y), qz = _mm256_set1_ps(z);
+			const __m256 lane = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+			const __m256 inf = _mm256_set1_ps(_STD numeric_limits<float>::infinity());
+			for (; i < node.b; i += 8) {
+				const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(px_.data() + i), qx);
+				const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(py_.data() + i), qy);
+				const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(pz_.data() + i), qz);
+				__m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+				const __m256 live = _mm256_cmp_ps(lane, _mm256_set1_ps(static_cast<float>(node.b - i)), _CMP_LT_OQ);
+				d = _mm256_blendv_ps(inf, d, live);
+				const int hit = _mm256_movemask_ps(_mm256_cmp_ps(d, _mm256_set1_ps(best), _CMP_LT_OQ));
+				if (hit == 0) continue;
+				__m256 m = _mm256_min_ps(d, _mm256_permute_ps(d, 0xb1));
+				m = _mm256_min_ps(m, _mm256_permute_ps(m, 0x4e));
+				m = _mm256_min_ps(m, _mm256_permute2f128_ps(m, m, 0x01));
+				const int at = _mm256_movemask_ps(_mm256_cmp_ps(d, m, _CMP_EQ_OQ));
+				int k = 0;
+				while (!((at >> k) & 1)) ++k;
+				best = _mm256_cvtss_f32(m);
+				best_at = i + static_cast<uint32_t>(k);
+			}
+			return;
+		}
+#endif
+		for (; i < node.b; ++i) {
+			const E dx = px_[i] - x, dy = py_[i] - y, dz = pz_[i] - z;
+			const E d = dx * dx + dy * dy + dz * dz;
+			if (d < best) {
+				best = d;
+				best_at = i;
+			}
+		}
+	}
+
+public:
+
+	EucKdTree3() noexcept
+		: leaf_size_(8)
+	{}
+
+	/*
+		@brief
+			Build the tree over count points. Queries return indices into this array.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void build(const V* points, size_t count, size_t leaf_size = 8) {
+		leaf_size_ = leaf_size < 1 ? 1 : leaf_size;
+		const E inf = _STD numeric_limits<E>::infinity();
+		px_.assign(count + Pad, inf);
+		py_.assign(count + Pad, inf);
+		pz_.assign(count + Pad, inf);
+		index_.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			px_[i] = static_cast<E>(detail::euc_get<0>(points[i]));
+			py_[i] = static_cast<E>(detail::euc_get<1>(points[i]));
+			pz_[i] = static_cast<E>(detail::euc_get<2>(points[i]));
+			index_[i] = static_cast<uint32_t>(i);
+		}
+		nodes_.clear();
+		nodes_.reserve(2 * (count / leaf_size_ + 1));
+		if (count > 0) build_node(0, static_cast<uint32_t>(count), 0);
+		_STD vector<E> sorted(count + Pad, inf);
+		for (auto* col : { &px_, &py_, &pz_ }) {
+			for (size_t i = 0; i < count; ++i) sorted[i] = (*col)[index_[i]];
+			col->swap(sorted);
+		}
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept { return index_.size(); }
+	EUCNODISCARD EUCVECTORINLINE bool empty() const noexcept { return index_.empty(); }
+
+	/*
+		@brief
+			Nearest point to (x, y, z) with squared distance below max_distance_squared.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucKdNeighbor<E> nearest(E x, E y, E z,
+		E max_distance_squared = _STD numeric_limits<E>::infinity()) const noexcept {
+		E best = max_distance_squared;
+		uint32_t best_at = npos;
+		if (nodes_.empty()) return EucKdNeighbor<E>{ npos, best };
+
+		struct Entry {
+			uint32_t node;
+			E bound;
+		};
+		Entry stack[MaxDepth * 2];
+		size_t top = 0;
+		stack[top++] = Entry{ 0, E(0) };
+		while (top > 0) {
+			const Entry en = stack[--top];
+			if (!(en.bound < best)) continue;
+			const Node* node = &nodes_[en.node];
+			// Descend to the leaf, pushing far sides.
+			while (node->axis != Leaf) {
+				const E q = node->axis == 0 ? x : node->axis == 1 ? y : z;
+				const E diff = q - node->split;
+				const uint32_t near_side = diff < E(0) ? node->a : node->b;
+				const uint32_t far_side = diff < E(0) ? node->b : node->a;
+				const E bound = diff * diff;
+				if (bound < best) stack[top++] = Entry{ far_side, bound };
+				node = &nodes_[near_side];
+			}
+			scan_leaf(*node, x, y, z, best, best_at);
+		}
+		return best_at == npos ? EucKdNeighbor<E>{ npos, max_distance_squared } : EucKdNeighbor<E>{ index_[best_at], best };
+	}
+
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCNODISCARD EUCVECTORINLINE EucKdNeighbor<E> nearest(const V& query,
+		E max_distance_squared = _STD numeric_limits<E>::infinity()) const noexcept {
+		return nearest(static_cast<E>(detail::euc_get<0>(query)), static_cast<E>(detail::euc_get<1>(query)),
+			static_cast<E>(detail::euc_get<2>(query)), max_distance_squared);
+	}
+
+	/*
+		@brief
+			Nearest neighbour of every query, spread over threads.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE void nearest(const V* queries, size_t count, EucKdNeighbor<E>* out,
+		E max_distance_squared = _STD numeric_limits<E>::infinity(), unsigned threads = 0) const {
+		detail::parallel_for(count, 4096, threads, [&](size_t b, size_t e) {
+			for (size_t i = b; i < e; ++i) out[i] = nearest(queries[i], max_distance_squared);
+		});
+	}
+};
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,371 @@
+//
+//	EuclideanVector Mixed
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Mixed-precision arithmetic: float data, double accumulation.
+//
+//	The element types' own operators decide the precision of EuclideanCmplVector3<float> + ResultPacker_3<double>.
+//	The functions here make the promotion explicit instead. Arrays stay in float, so memory traffic is that of
+//	float, and only the running sums are double.
+//
+//	euc_convert<A>(v) turns one vector or packer into a packer of A. EucAccumulator<D, A> keeps a sum and a count
+//	in A. The batch kernels work on flat float vectors as one float stream. With AVX, 4 floats are widened to
+//	4 doubles per instruction and added into several accumulator registers. The accumulator count is chosen so
+//	that every register lane always holds the same component.
+//
+//	Sums are taken over fixed blocks of vectors, and the block results are added in order. The result therefore
+//	does not depend on the number of threads.
+//.
+
+#ifndef THL_EUCLID_VECTOR_MIXED_HPP
+#define THL_EUCLID_VECTOR_MIXED_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+//meta functions.
+namespace meta {
+
+	// float vectors read as a float stream.
+	template<class V>
+	constexpr bool is_euc_mixed_float_v = [] {
+		if constexpr (is_euc_flat_v<V>) {
+			return _STD is_same_v<euc_elem_t<V>, float>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+	// double vectors written as a double stream.
+	template<class V>
+	constexpr bool is_euc_mixed_double_v = [] {
+		if constexpr (is_euc_flat_v<V>) {
+			return _STD is_same_v<euc_elem_t<V>, double>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	constexpr size_t mixed_block = 16384;
+
+	/*
+		@brief
+			out[k] += sum of p[i] over i = k (mod D), for count vectors of a float stream.
+	*/
+	template<size_t D>
+	EUCVECTORINLINE void mixed_sum_stream(const float* p, size_t count, double* out) noexcept {
+		const size_t total = count * D;
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		// Regs * 4 is a multiple of D, so lane l of the register file always holds component l % D.
+		constexpr size_t Regs = D == 3 ? 6 : 4;
+		constexpr size_t Step = Regs * 4;
+		__m256d acc[Regs];
+		for (size_t r = 0; r < Regs; ++r) acc[r] = _mm256_setzero_pd();
+		for (; i + Step <= total; i += Step) {
+			for (size_t r = 0; r < Regs; ++r) acc[r] = _mm256_add_pd(acc[r], _mm256_cvtps_pd(_mm_loadu_ps(p + i + r * 4)));
+		}
+		alignas(32) double lanes[Step];
+		for (size_t r = 0; r < Regs; ++r) _mm256_store_pd(lanes + r * 4, acc[r]);
+		for (size_t l = 0; l < Step; ++l) out[l % D] += lanes[l];
+#endif
+		for (; i < total; ++i) out[i % D] += static_cast<double>(p[i]);
+	}
+
+	/*
+		@brief
+			Sum of a[i] * b[i] over a float stream of n elements, in double.
+	*/
+	EUCNODISCARD EUCVECTORINLINE double mixed_dot_stream(const float* a, const float* b, size_t n) noexcept {
+		double sum = 0;
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		__m256d acc[4] = { _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd() };
+		for (; i + 16 <= n; i += 16) {
+			for (size_t r = 0; r < 4; ++r) {
+				const __m256d x = _mm256_cvtps_pd(_mm_loadu_ps(a + i + r * 4));
+				const __m256d y = _mm256_cvtps_pd(_mm_loadu_ps(b + i + r * 4));
+#	if defined(THL_EUC_FMA)
+				acc[r] = _mm256_fmadd_pd(x, y, acc[r]);
+#	else
+				acc[r] = _mm256_add_pd(acc[r], _mm256_mul_pd(x, y));
+#	endif
+			}
+		}
+		alignas(32) double lanes[4];
+		_mm256_store_pd(lanes, _mm256_add_pd(_mm256_add_pd(acc[0], acc[1]), _mm256_add_pd(acc[2], acc[3])));
+		sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+		for (; i < n; ++i) sum += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+		return sum;
+	}
+
+	/*
+		@brief
+			acc[i] += weight * src[i] over n elements.
+	*/
+	EUCVECTORINLINE void mixed_axpy_stream(double* acc, const float* src, size_t n, double weight) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		const __m256d w = _mm256_set1_pd(weight);
+		for (; i + 8 <= n; i += 8) {
+			const __m256d s0 = _mm256_cvtps_pd(_mm_loadu_ps(src + i));
+			const __m256d s1 = _mm256_cvtps_pd(_mm_loadu_ps(src + i + 4));
+#	if defined(THL_EUC_FMA)
+			_mm256_storeu_pd(acc + i, _mm256_fmadd_pd(s0, w, _mm256_loadu_pd(acc + i)));
+			_mm256_storeu_pd(acc + i + 4, _mm256_fmadd_pd(s1, w, _mm256_loadu_pd(acc + i + 4)));
+#	else
+			_mm256_storeu_pd(acc + i, _mm256_add_pd(_mm256_loadu_pd(acc + i), _mm256_mul_pd(s0, w)));
+			_mm256_storeu_pd(acc + i + 4, _mm256_add_pd(_mm256_loadu_pd(acc + i + 4), _mm256_mul_pd(s1, w)));
+#	endif
+		}
+#endif
+		for (; i < n; ++i) acc[i] += weight * static_cast<double>(src[i]);
+	}
+
+	EUCVECTORINLINE void mixed_convert_stream(const float* src, double* dst, size_t n) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		for (; i + 4 <= n; i += 4) _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+#endif
+		for (; i < n; ++i) dst[i] = static_cast<double>(src[i]);
+	}
+
+	EUCVECTORINLINE void mixed_convert_stream(const double* src, float* dst, size_t n) noexcept {
+		size_t i = 0;
+#if defined(THL_EUC_AVX)
+		for (; i + 4 <= n; i += 4) _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+#endif
+		for (; i < n; ++i) dst[i] = static_cast<float>(src[i]);
+	}
+
+	/*
+		@brief
+			out[k] += component k of v[0..count), in A.
+	*/
+	template<class A, class V>
+	EUCVECTORINLINE void mixed_sum_range(const V* v, size_t count, A* out) noexcept {
+		constexpr size_t D = meta::euc_dimension_v<V>;
+		if constexpr (_STD is_same_v<A, double> && meta::is_euc_mixed_float_v<V>) {
+			mixed_sum_stream<D>(reinterpret_cast<const float*>(v), count, out);
+		}
+		else {
+			for (size_t i = 0; i < count; ++i) {
+				size_t k = 0;
+				euc_for_each(v[i], [&](const auto& e) { out[k++] += static_cast<A>(e); });
+			}
+		}
+	}
+
+	/*
+		@brief
+			Sum over fixed blocks, spread over threads, with the block sums added in order.
+			range(begin, end) returns the sum of [begin, end).
+	*/
+	template<class A, size_t N, class F>
+	EUCVECTORINLINE void mixed_blocked(size_t count, unsigned threads, A* out, F&& range) {
+		const size_t blocks = (count + mixed_block - 1) / mixed_block;
+		if (blocks <= 1) {
+			if (count > 0) range(size_t(0), count, out);
+			return;
+		}
+		_STD vector<A> partial(blocks * N, A(0));
+		parallel_for(blocks, 1, threads, [&](size_t b, size_t e) {
+			for (size_t k = b; k < e; ++k) {
+				const size_t end = (k + 1) * mixed_block < count ? (k + 1) * mixed_block : count;
+				range(k * mixed_block, end, partial.data() + k * N);
+			}
+		});
+		for (size_t k = 0; k < blocks; ++k) {
+			for (size_t c = 0; c < N; ++c) out[c] += partial[k * N + c];
+		}
+	}
+
+}
+
+/*
+	@brief
+		v converted element-wise to A, as a packer that the vector operators accept.
+*/
+template<class A, class V, meta::if_t<meta::is_euc_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_packer_t<A, meta::euc_dimension_v<V>> euc_convert(const V& v) {
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	A elems[D] = {};
+	size_t k = 0;
+	detail::euc_for_each(v, [&](const auto& e) { elems[k++] = static_cast<A>(e); });
+	return detail::euc_make<meta::euc_packer_t<A, D>>(elems);
+}
+
+/*
+	Running sum of D-dimensional vectors, kept in A whatever the element type of the added vectors.
+*/
+template<size_t D, class A = double>
+class EucAccumulator {
+protected:
+
+	A sum_[D];
+	size_t count_;
+
+public:
+
+	static_assert(D >= 1 && D <= 4, "EucAccumulator supports 1 to 4 dimensions");
+
+	EucAccumulator() noexcept
+		: sum_()
+		, count_(0)
+	{}
+
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == D> = 0>
+	EUCVECTORINLINE void add(const V& v) noexcept {
+		size_t k = 0;
+		detail::euc_for_each(v, [&](const auto& e) { sum_[k++] += static_cast<A>(e); });
+		++count_;
+	}
+
+	/*
+		@brief
+			Add count vectors. Flat float vectors into a double accumulator take the SIMD kernel.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == D> = 0>
+	EUCVECTORINLINE void add(const V* v, size_t count, unsigned threads = 0) {
+		A block[D] = {};
+		detail::mixed_blocked<A, D>(count, threads, block, [v](size_t b, size_t e, A* out) {
+			detail::mixed_sum_range<A>(v + b, e - b, out);
+		});
+		for (size_t k = 0; k < D; ++k) sum_[k] += block[k];
+		count_ += count;
+	}
+
+	EUCVECTORINLINE void merge(const EucAccumulator& other) noexcept {
+		for (size_t k = 0; k < D; ++k) sum_[k] += other.sum_[k];
+		count_ += other.count_;
+	}
+
+	EUCVECTORINLINE void reset() noexcept {
+		for (size_t k = 0; k < D; ++k) sum_[k] = A(0);
+		count_ = 0;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t count() const noexcept { return count_; }
+
+	EUCNODISCARD EUCVECTORINLINE meta::euc_cmpl_vector_t<A, D> sum() const {
+		return detail::euc_make<meta::euc_cmpl_vector_t<A, D>>(sum_);
+	}
+
+	/*
+		@brief
+			Mean of the added vectors. Zero when nothing was added.
+	*/
+	EUCNODISCARD EUCVECTORINLINE meta::euc_cmpl_vector_t<A, D> mean() const {
+		A m[D] = {};
+		if (count_ > 0) {
+			for (size_t k = 0; k < D; ++k) m[k] = sum_[k] / static_cast<A>(count_);
+		}
+		return detail::euc_make<meta::euc_cmpl_vector_t<A, D>>(m);
+	}
+};
+
+/*
+	@brief
+		Sum of count vectors, accumulated in A.
+*/
+template<class A = double, class V, meta::if_t<meta::is_euc_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_cmpl_vector_t<A, meta::euc_dimension_v<V>> euc_mixed_sum(const V* v, size_t count, unsigned threads = 0) {
+	EucAccumulator<meta::euc_dimension_v<V>, A> acc;
+	acc.add(v, count, threads);
+	return acc.sum();
+}
+
+/*
+	@brief
+		Sum of a[i].dot(b[i]) over count pairs, accumulated in A.
+*/
+template<class A = double, class V, meta::if_t<meta::is_euc_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE A euc_mixed_dot_sum(const V* a, const V* b, size_t count, unsigned threads = 0) {
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	A sum = A(0);
+	detail::mixed_blocked<A, 1>(count, threads, &sum, [a, b](size_t s, size_t e, A* out) {
+		if constexpr (_STD is_same_v<A, double> && meta::is_euc_mixed_float_v<V>) {
+			*out += detail::mixed_dot_stream(reinterpret_cast<const float*>(a + s), reinterpret_cast<const float*>(b + s), (e - s) * D);
+		}
+		else {
+			for (size_t i = s; i < e; ++i) {
+				A l[D] = {}, r[D] = {};
+				size_t k = 0;
+				detail::euc_for_each(a[i], [&](const auto& x) { l[k++] = static_cast<A>(x); });
+				k = 0;
+				detail::euc_for_each(b[i], [&](const auto& x) { r[k++] = static_cast<A>(x); });
+				for (k = 0; k < D; ++k) *out += l[k] * r[k];
+			}
+		}
+	});
+	return sum;
+}
+
+/*
+	@brief
+		acc[i] += weight * src[i] for count vectors. acc keeps the wide type while src stays narrow.
+*/
+template<class W, class V, meta::if_t<meta::is_euc_vector_v<W> && meta::is_euc_vector_v<V> && !meta::is_euc_packer_v<W>
+	&& meta::euc_dimension_v<W> == meta::euc_dimension_v<V>> = 0>
+EUCVECTORINLINE void euc_mixed_accumulate(W* acc, const V* src, size_t count, meta::euc_elem_t<W> weight = meta::euc_elem_t<W>(1), unsigned threads = 0) {
+	using A = meta::euc_elem_t<W>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	detail::parallel_for(count, detail::mixed_block, threads, [&](size_t b, size_t e) {
+		if constexpr (meta::is_euc_mixed_double_v<W> && meta::is_euc_mixed_float_v<V>) {
+			detail::mixed_axpy_stream(reinterpret_cast<double*>(acc + b), reinterpret_cast<const float*>(src + b), (e - b) * D, weight);
+		}
+		else {
+			for (size_t i = b; i < e; ++i) {
+				A s[D] = {};
+				size_t k = 0;
+				detail::euc_for_each(src[i], [&](const auto& x) { s[k++] = static_cast<A>(x); });
+				k = 0;
+				detail::euc_for_each(acc[i], [&](auto& x) { x += weight * s[k++]; });
+			}
+		}
+	});
+}
+
+/*
+	@brief
+		dst[i] = src[i] converted element-wise, e.g. to widen float data once or to store double results back as float.
+*/
+template<class V, class W, meta::if_t<meta::is_euc_vector_v<V> && meta::is_euc_vector_v<W> && !meta::is_euc_packer_v<W>
+	&& meta::euc_dimension_v<W> == meta::euc_dimension_v<V>> = 0>
+EUCVECTORINLINE void euc_convert_range(const V* src, W* dst, size_t count, unsigned threads = 0) {
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	detail::parallel_for(count, detail::mixed_block, threads, [&](size_t b, size_t e) {
+		if constexpr (meta::is_euc_mixed_float_v<V> && meta::is_euc_mixed_double_v<W>) {
+			detail::mixed_convert_stream(reinterpret_cast<const float*>(src + b), reinterpret_cast<double*>(dst + b), (e - b) * D);
+		}
+		else if constexpr (meta::is_euc_mixed_double_v<V> && meta::is_euc_mixed_float_v<W>) {
+			detail::mixed_convert_stream(reinterpret_cast<const double*>(src + b), reinterpret_cast<float*>(dst + b), (e - b) * D);
+		}
+		else {
+			for (size_t i = b; i < e; ++i) dst[i] = euc_convert<meta::euc_elem_t<W>>(src[i]);
+		}
+	});
+}
+
+//name space end.
+}
+
+#endif
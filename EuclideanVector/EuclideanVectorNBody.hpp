@@ -0,0 +1,652 @@
+//
+//	EuclideanVector NBody
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Barnes-Hut n-body accelerations for arrays of EuclideanCmplVector3 (float or double).
+//
+//	Bodies are sorted along a Morton curve inside their bounding cube. The octree is built over the sorted order,
+//	so every node covers a contiguous range of bodies. The eight top-level subtrees are built concurrently.
+//	Mass and center of mass are aggregated bottom-up during the build.
+//	The force pass walks the tree once per body, in parallel. A node is used as a point mass when
+//	size < theta * distance; otherwise its children are opened. Leaves of at most leaf_size bodies
+//	are summed directly over the sorted SoA arrays, 8 floats or 4 doubles at a time with AVX.
+//
+//	The same leaf kernel gives euc_nbody_direct(), the O(N^2) reference, and euc_nbody_rms_error() measures the
+//	approximation. euc_bench_nbody() registers both methods on an EucBenchmark.
+//
+//	a_i = G * sum_j m_j (r_j - r_i) / (|r_j - r_i|^2 + eps^2)^(3/2)
+//.
+
+#ifndef THL_EUCLID_VECTOR_NBODY_HPP
+#define THL_EUCLID_VECTOR_NBODY_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Solver settings.
+*/
+template<class E>
+struct EucNBodyOptions {
+	// Opening angle; 0 opens every node (exact), 0.5 - 0.7 is typical.
+	E theta = E(0.5);
+	// Plummer softening length.
+	E softening = E(0);
+	// Gravitational constant (or Coulomb constant with charges as masses and a negative sign).
+	E g = E(1);
+	// Maximum bodies per leaf.
+	size_t leaf_size = 16;
+	unsigned threads = 0;
+};
+
+//details.
+namespace detail {
+
+	constexpr unsigned nbody_max_level = 21;
+
+	EUCNODISCARD EUCVECTORINLINE uint64_t nbody_spread(uint64_t v) noexcept {
+		v &= 0x1fffff;
+		v = (v | v << 32) & 0x1f00000000ffffull;
+		v = (v | v << 16) & 0x1f0000ff0000ffull;
+		v = (v | v << 8) & 0x100f00f00f00f00full;
+		v = (v | v << 4) & 0x10c30c30c30c30c3ull;
+		v = (v | v << 2) & 0x1249249249249249ull;
+		return v;
+	}
+
+	// Loads may run this many elements past the last body; the SoA arrays are padded by it.
+	constexpr size_t nbody_pad = 8;
+
+	/*
+		Acceleration accumulator for one target point.
+		Sums stay in registers across every leaf and node of a traversal and are reduced once in result().
+		Coincident points (the body itself) contribute nothing.
+	*/
+	template<class E>
+	struct NBodyAccumulator {
+		E px, py, pz, eps2;
+		E ax = E(0), ay = E(0), az = E(0);
+
+		EUCVECTORINLINE NBodyAccumulator(E x, E y, E z, E eps2_) noexcept
+			: px(x), py(y), pz(z), eps2(eps2_)
+		{}
+
+		EUCVECTORINLINE void point(E x, E y, E z, E m) noexcept {
+			const E dx = x - px, dy = y - py, dz = z - pz;
+			const E r2 = dx * dx + dy * dy + dz * dz + eps2;
+			if (!(r2 > E(0))) return;
+			const E inv = m / (r2 * _STD sqrt(r2));
+			ax += dx * inv;
+			ay += dy * inv;
+			az += dz * inv;
+		}
+
+		EUCVECTORINLINE void range(const E* x, const E* y, const E* z, const E* m, size_t b, size_t e) noexcept {
+			for (size_t j = b; j < e; ++j) point(x[j], y[j], z[j], m[j]);
+		}
+
+		EUCVECTORINLINE void result(E& x, E& y, E& z) const noexcept {
+			x = ax;
+			y = ay;
+			z = az;
+		}
+	};
+
+#if defined(THL_EUC_AVX)
+	alignas(32) constexpr int32_t nbody_tail_mask32[16] = { -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 };
+	alignas(32) constexpr int64_t nbody_tail_mask64[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+
+	template<>
+	struct NBodyAccumulator<float> {
+		__m256 px, py, pz, eps2;
+		__m256 ax, ay, az;
+		float sx = 0.0f, sy = 0.0f, sz = 0.0f;	// monopole terms.
+		float qx, qy, qz, qe;
+
+		EUCVECTORINLINE NBodyAccumulator(float x, float y, float z, float e2) noexcept
+			: px(_mm256_set1_ps(x)), py(_mm256_set1_ps(y)), pz(_mm256_set1_ps(z)), eps2(_mm256_set1_ps(e2))
+			, ax(_mm256_setzero_ps()), ay(_mm256_setzero_ps()), az(_mm256_setzero_ps())
+			, qx(x), qy(y), qz(z), qe(e2)
+		{}
+
+		EUCVECTORINLINE void point(float x, float y, float z, float m) noexcept {
+			const float dx = x - qx, dy = y - qy, dz = z - qz;
+			const float r2 = dx * dx + dy * dy + dz * dz + qe;
+			if (!(r2 > 0.0f)) return;
+			const float inv = m / (r2 * _STD sqrt(r2));
+			sx += dx * inv;
+			sy += dy * inv;
+			sz += dz * inv;
+		}
+
+		EUCVECTORINLINE void lanes(const float* x, const float* y, const float* z, __m256 m) noexcept {
+			const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x), px);
+			const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y), py);
+			const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(z), pz);
+			__m256 r2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_add_ps(_mm256_mul_ps(dz, dz), eps2));
+			const __m256 live = _mm256_cmp_ps(r2, _mm256_setzero_ps(), _CMP_GT_OQ);
+			r2 = _mm256_blendv_ps(_mm256_set1_ps(1.0f), r2, live);
+			const __m256 inv = _mm256_div_ps(_mm256_and_ps(m, live), _mm256_mul_ps(r2, _mm256_sqrt_ps(r2)));
+#if defined(THL_EUC_FMA)
+			ax = _mm256_fmadd_ps(dx, inv, ax);
+			ay = _mm256_fmadd_ps(dy, inv, ay);
+			az = _mm256_fmadd_ps(dz, inv, az);
+#else
+			ax = _mm256_add_ps(ax, _mm256_mul_ps(dx, inv));
+			ay = _mm256_add_ps(ay, _mm256_mul_ps(dy, inv));
+			az = _mm256_add_ps(az, _mm256_mul_ps(dz, inv));
+#endif
+		}
+
+		EUCVECTORINLINE void range(const float* x, const float* y, const float* z, const float* m, size_t b, size_t e) noexcept {
+			size_t j = b;
+			for (; j + 8 <= e; j += 8) lanes(x + j, y + j, z + j, _mm256_loadu_ps(m + j));
+			if (j < e) {
+				const __m256 mask = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(nbody_tail_mask32 + 8 - (e - j))));
+				lanes(x + j, y + j, z + j, _mm256_and_ps(_mm256_loadu_ps(m + j), mask));
+			}
+		}
+
+		EUCVECTORINLINE void result(float& x, float& y, float& z) const noexcept {
+			alignas(32) float l[3][8];
+			_mm256_store_ps(l[0], ax);
+			_mm256_store_ps(l[1], ay);
+			_mm256_store_ps(l[2], az);
+			x = sx;
+			y = sy;
+			z = sz;
+			for (size_t k = 0; k < 8; ++k) {
+				x += l[0][k];
+				y += l[1][k];
+				z += l[2][k];
+			}
+		}
+	};
+
+	template<>
+	struct NBodyAccumulator<double> {
+		__m256d px, py, pz, eps2;
+		__m256d ax, ay, az;
+		double sx = 0.0, sy = 0.0, sz = 0.0;	// monopole terms.
+		double qx, qy, qz, qe;
+
+		EUCVECTORINLINE NBodyAccumulator(double x, double y, double z, double e2) noexcept
+			: px(_mm256_set1_pd(x)), py(_mm256_set1_pd(y)), pz(_mm256_set1_pd(z)), eps2(_mm256_set1_pd(e2))
+			, ax(_mm256_setzero_pd()), ay(_mm256_setzero_pd()), az(_mm256_setzero_pd())
+			, qx(x), qy(y), qz(z), qe(e2)
+		{}
+
+		EUCVECTORINLINE void point(double x, double y, double z, double m) noexcept {
+			const double dx = x - qx, dy = y - qy, dz = z - qz;
+			const double r2 = dx * dx + dy * dy + dz * dz + qe;
+			if (!(r2 > 0.0)) return;
+			const double inv = m / (r2 * _STD sqrt(r2));
+			sx += dx * inv;
+			sy += dy * inv;
+			sz += dz * inv;
+		}
+
+		EUCVECTORINLINE void lanes(const double* x, const double* y, const double* z, __m256d m) noexcept {
+			const __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x), px);
+			const __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(y), py);
+			const __m256d dz = _mm256_sub_pd(_mm256_loadu_pd(z), pz);
+			__m256d r2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_add_pd(_mm256_mul_pd(dz, dz), eps2));
+			const __m256d live = _mm256_cmp_pd(r2, _mm256_setzero_pd(), _CMP_GT_OQ);
+			r2 = _mm256_blendv_pd(_mm256_set1_pd(1.0), r2, live);
+			const __m256d inv = _mm256_div_pd(_mm256_and_pd(m, live), _mm256_mul_pd(r2, _mm256_sqrt_pd(r2)));
+#if defined(THL_EUC_FMA)
+			ax = _mm256_fmadd_pd(dx, inv, ax);
+			ay = _mm256_fmadd_pd(dy, inv, ay);
+			az = _mm256_fmadd_pd(dz, inv, az);
+#else
+			ax = _mm256_add_pd(ax, _mm256_mul_pd(dx, inv));
+			ay = _mm256_add_pd(ay, _mm256_mul_pd(dy, inv));
+			az = _mm256_add_pd(az, _mm256_mul_pd(dz, inv));
+#endif
+		}
+
+		EUCVECTORINLINE void range(const double* x, const double* y, const double* z, const double* m, size_t b, size_t e) noexcept {
+			size_t j = b;
+			for (; j + 4 <= e; j += 4) lanes(x + j, y + j, z + j, _mm256_loadu_pd(m + j));
+			if (j < e) {
+				const __m256d mask = _mm256_castsi256_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(nbody_tail_mask64 + 4 - (e - j))));
+				lanes(x + j, y + j, z + j, _mm256_and_pd(_mm256_loadu_pd(m + j), mask));
+			}
+		}
+
+		EUCVECTORINLINE void result(double& x, double& y, double& z) const noexcept {
+			alignas(32) double l[3][4];
+			_mm256_store_pd(l[0], ax);
+			_mm256_store_pd(l[1], ay);
+			_mm256_store_pd(l[2], az);
+			x = sx;
+			y = sy;
+			z = sz;
+			for (size_t k = 0; k < 4; ++k) {
+				x += l[0][k];
+				y += l[1][k];
+				z += l[2][k];
+			}
+		}
+	};
+#endif
+
+}
+
+/*
+	Barnes-Hut octree over EuclideanCmplVector3<E>.
+*/
+template<class E = double>
+class EucBarnesHut {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucBarnesHut needs a floating point element type");
+
+	using VectorType = EuclideanCmplVector3<E>;
+
+	struct Node {
+		E cx, cy, cz;		// center of mass.
+		E mass;
+		E size;				// edge length of the cell.
+		uint32_t first_child;
+		uint32_t child_count;	// 0 for leaves.
+		uint32_t begin, end;	// bodies in sorted order.
+	};
+
+	/*
+		Counters of the last accelerations() call.
+	*/
+	struct Stats {
+		size_t nodes;
+		size_t leaves;
+		size_t body_interactions;
+		size_t node_interactions;
+	};
+
+protected:
+
+	EucNBodyOptions<E> options_;
+	_STD vector<Node> nodes_;
+	_STD vector<uint32_t> order_;	// sorted position -> input index.
+	_STD vector<E> x_, y_, z_, m_;	// bodies in sorted order.
+	_STD vector<uint64_t> code_;
+	Stats stats_{};
+
+	EUCVECTORINLINE void finish_leaf(Node& node) const noexcept {
+		E mx = E(0), my = E(0), mz = E(0), mass = E(0);
+		for (uint32_t i = node.begin; i < node.end; ++i) {
+			mass += m_[i];
+			mx += m_[i] * x_[i];
+			my += m_[i] * y_[i];
+			mz += m_[i] * z_[i];
+		}
+		node.mass = mass;
+		if (mass != E(0)) {
+			node.cx = mx / mass;
+			node.cy = my / mass;
+			node.cz = mz / mass;
+		}
+		else {
+			node.cx = x_[node.begin];
+			node.cy = y_[node.begin];
+			node.cz = z_[node.begin];
+		}
+	}
+
+	/*
+		@brief
+			Build the subtree of bodies [b, e) at level into nodes[index]; children are appended to nodes.
+	*/
+	EUCVECTORINLINE void build_node(_STD vector<Node>& nodes, size_t index, uint32_t b, uint32_t e, unsigned level, E size) const {
+		nodes[index].size = size;
+		nodes[index].begin = b;
+		nodes[index].end = e;
+		nodes[index].child_count = 0;
+		nodes[index].first_child = 0;
+		if (e - b <= options_.leaf_size || level == detail::nbody_max_level) {
+			finish_leaf(nodes[index]);
+			return;
+		}
+
+		uint32_t bounds[9];
+		const unsigned shift = 3 * (detail::nbody_max_level - 1 - level);
+		bounds[0] = b;
+		for (unsigned c = 0; c < 8; ++c) {
+			bounds[c + 1] = static_cast<uint32_t>(_STD partition_point(code_.begin() + bounds[c], code_.begin() + e,
+				[&](uint64_t code) { return ((code >> shift) & 7) <= c; }) - code_.begin());
+		}
+		uint32_t count = 0;
+		for (unsigned c = 0; c < 8; ++c) count += bounds[c + 1] != bounds[c];
+
+		const size_t first = nodes.size();
+		nodes.resize(first + count);
+		nodes[index].first_child = static_cast<uint32_t>(first);
+		nodes[index].child_count = count;
+		size_t slot = first;
+		for (unsigned c = 0; c < 8; ++c) {
+			if (bounds[c + 1] == bounds[c]) continue;
+			build_node(nodes, slot++, bounds[c], bounds[c + 1], level + 1, size / E(2));
+		}
+		aggregate(nodes, index);
+	}
+
+	EUCVECTORINLINE static void aggregate(_STD vector<Node>& nodes, size_t index) noexcept {
+		Node& node = nodes[index];
+		E mx = E(0), my = E(0), mz = E(0), mass = E(0);
+		for (uint32_t c = 0; c < node.child_count; ++c) {
+			const Node& child = nodes[node.first_child + c];
+			mass += child.mass;
+			mx += child.mass * child.cx;
+			my += child.mass * child.cy;
+			mz += child.mass * child.cz;
+		}
+		node.mass = mass;
+		if (mass != E(0)) {
+			node.cx = mx / mass;
+			node.cy = my / mass;
+			node.cz = mz / mass;
+		}
+		else {
+			node.cx = nodes[node.first_child].cx;
+			node.cy = nodes[node.first_child].cy;
+			node.cz = nodes[node.first_child].cz;
+		}
+	}
+
+public:
+
+	explicit EucBarnesHut(const EucNBodyOptions<E>& options = {})
+		: options_(options)
+	{
+		if (options_.leaf_size == 0) options_.leaf_size = 1;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE const EucNBodyOptions<E>& options() const noexcept { return options_; }
+	EUCVECTORINLINE void set_options(const EucNBodyOptions<E>& options) noexcept {
+		options_ = options;
+		if (options_.leaf_size == 0) options_.leaf_size = 1;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE const _STD vector<Node>& nodes() const noexcept { return nodes_; }
+	EUCNODISCARD EUCVECTORINLINE const Stats& stats() const noexcept { return stats_; }
+
+	/*
+		@brief
+			Build the tree for count bodies. mass may be null for unit masses.
+	*/
+	EUCVECTORINLINE void build(const VectorType* positions, const E* mass, size_t count) {
+		nodes_.clear();
+		if (count == 0) return;
+		const unsigned threads = options_.threads;
+		const E* p = reinterpret_cast<const E*>(positions);
+
+		// Bounding cube.
+		const size_t chunks = detail::chunk_count(count, 16384, threads);
+		_STD vector<E> box(chunks * 6);
+		detail::parallel_invoke(chunks, [&](size_t ch) {
+			const size_t i0 = count * ch / chunks, i1 = count * (ch + 1) / chunks;
+			E lo[3] = { p[i0 * 3], p[i0 * 3 + 1], p[i0 * 3 + 2] }, hi[3] = { lo[0], lo[1], lo[2] };
+			for (size_t i = i0; i < i1; ++i) {
+				for (size_t k = 0; k < 3; ++k) {
+					lo[k] = p[i * 3 + k] < lo[k] ? p[i * 3 + k] : lo[k];
+					hi[k] = p[i * 3 + k] > hi[k] ? p[i * 3 + k] : hi[k];
+				}
+			}
+			for (size_t k = 0; k < 3; ++k) {
+				box[ch * 6 + k] = lo[k];
+				box[ch * 6 + 3 + k] = hi[k];
+			}
+		});
+		E lo[3] = { box[0], box[1], box[2] }, hi[3] = { box[3], box[4], box[5] };
+		for (size_t ch = 1; ch < chunks; ++ch) {
+			for (size_t k = 0; k < 3; ++k) {
+				lo[k] = box[ch * 6 + k] < lo[k] ? box[ch * 6 + k] : lo[k];
+				hi[k] = box[ch * 6 + 3 + k] > hi[k] ? box[ch * 6 + 3 + k] : hi[k];
+			}
+		}
+		E size = E(0);
+		for (size_t k = 0; k < 3; ++k) size = (hi[k] - lo[k]) > size ? (hi[k] - lo[k]) : size;
+		size = size > E(0) ? size * E(1.0001) : E(1);
+		const double scale = static_cast<double>(1u << detail::nbody_max_level) / static_cast<double>(size);
+
+		// Morton order.
+		_STD vector<_STD pair<uint64_t, uint32_t>> keyed(count);
+		detail::parallel_for(count, 16384, threads, [&](size_t i0, size_t i1) {
+			for (size_t i = i0; i < i1; ++i) {
+				uint64_t code = 0;
+				for (size_t k = 0; k < 3; ++k) {
+					double q = (static_cast<double>(p[i * 3 + k]) - static_cast<double>(lo[k])) * scale;
+					q = q < 0.0 ? 0.0 : (q > 2097151.0 ? 2097151.0 : q);
+					code |= detail::nbody_spread(static_cast<uint64_t>(q)) << k;
+				}
+				keyed[i] = { code, static_cast<uint32_t>(i) };
+			}
+		});
+		_STD sort(keyed.begin(), keyed.end());
+
+		order_.resize(count);
+		code_.resize(count);
+		x_.assign(count + detail::nbody_pad, E(0));
+		y_.assign(count + detail::nbody_pad, E(0));
+		z_.assign(count + detail::nbody_pad, E(0));
+		m_.assign(count + detail::nbody_pad, E(0));
+		detail::parallel_for(count, 16384, threads, [&](size_t i0, size_t i1) {
+			for (size_t i = i0; i < i1; ++i) {
+				const uint32_t src = keyed[i].second;
+				order_[i] = src;
+				code_[i] = keyed[i].first;
+				x_[i] = p[src * 3];
+				y_[i] = p[src * 3 + 1];
+				z_[i] = p[src * 3 + 2];
+				m_[i] = mass ? mass[src] : E(1);
+			}
+		});
+
+		// Root and its octants; the octant subtrees are built concurrently and spliced after the root.
+		const uint32_t n = static_cast<uint32_t>(count);
+		nodes_.resize(1);
+		nodes_[0] = Node{ E(0), E(0), E(0), E(0), size, 0, 0, 0, n };
+		if (count <= options_.leaf_size) {
+			finish_leaf(nodes_[0]);
+			return;
+		}
+
+		const unsigned shift = 3 * (detail::nbody_max_level - 1);
+		uint32_t bounds[9];
+		bounds[0] = 0;
+		for (unsigned c = 0; c < 8; ++c) {
+			bounds[c + 1] = static_cast<uint32_t>(_STD partition_point(code_.begin() + bounds[c], code_.end(),
+				[&](uint64_t code) { return ((code >> shift) & 7) <= c; }) - code_.begin());
+		}
+		_STD vector<unsigned> octants;
+		for (unsigned c = 0; c < 8; ++c) if (bounds[c + 1] != bounds[c]) octants.push_back(c);
+
+		_STD vector<_STD vector<Node>> sub(octants.size());
+		detail::parallel_invoke(octants.size() < detail::resolve_threads(threads) ? octants.size() : detail::resolve_threads(threads), [&](size_t worker) {
+			const size_t workers = octants.size() < detail::resolve_threads(threads) ? octants.size() : detail::resolve_threads(threads);
+			for (size_t s = worker; s < octants.size(); s += workers) {
+				const unsigned c = octants[s];
+				sub[s].resize(1);
+				build_node(sub[s], 0, bounds[c], bounds[c + 1], 1, size / E(2));
+			}
+		});
+
+		// Local index 0 goes to slot 1 + s; local index l > 0 goes to base + l - 1.
+		const size_t roots = octants.size();
+		size_t total = 1 + roots;
+		for (const auto& s : sub) total += s.size() - 1;
+		nodes_.resize(total);
+		nodes_[0].first_child = 1;
+		nodes_[0].child_count = static_cast<uint32_t>(roots);
+		size_t base = 1 + roots;
+		for (size_t s = 0; s < roots; ++s) {
+			const auto& local = sub[s];
+			const auto remap = [&](uint32_t l) { return static_cast<uint32_t>(l == 0 ? 1 + s : base + l - 1); };
+			for (size_t l = 0; l < local.size(); ++l) {
+				Node node = local[l];
+				if (node.child_count) node.first_child = remap(node.first_child);
+				nodes_[remap(static_cast<uint32_t>(l))] = node;
+			}
+			base += local.size() - 1;
+		}
+		aggregate(nodes_, 0);
+	}
+
+	/*
+		@brief
+			Acceleration of every body of the last build(), written to out[input index].
+	*/
+	EUCVECTORINLINE void accelerations(VectorType* out) {
+		const size_t count = order_.size();
+		stats_ = Stats{ nodes_.size(), 0, 0, 0 };
+		if (count == 0 || nodes_.empty()) return;
+		for (const auto& node : nodes_) stats_.leaves += node.child_count == 0;
+
+		E* o = reinterpret_cast<E*>(out);
+		const E theta2 = options_.theta * options_.theta;
+		const E eps2 = options_.softening * options_.softening;
+		const E g = options_.g;
+		const size_t chunks = detail::chunk_count(count, 1024, options_.threads);
+		_STD vector<size_t> body_counts(chunks), node_counts(chunks);
+
+		detail::parallel_invoke(chunks, [&](size_t ch) {
+			const size_t i0 = count * ch / chunks, i1 = count * (ch + 1) / chunks;
+			uint32_t stack[8 * (detail::nbody_max_level + 2)];
+			size_t bodies = 0, cells = 0;
+			for (size_t i = i0; i < i1; ++i) {
+				const E px = x_[i], py = y_[i], pz = z_[i];
+				detail::NBodyAccumulator<E> acc(px, py, pz, eps2);
+				size_t top = 0;
+				stack[top++] = 0;
+				while (top) {
+					const Node& node = nodes_[stack[--top]];
+					if (node.child_count == 0) {
+						acc.range(x_.data(), y_.data(), z_.data(), m_.data(), node.begin, node.end);
+						bodies += node.end - node.begin;
+						continue;
+					}
+					const E dx = node.cx - px, dy = node.cy - py, dz = node.cz - pz;
+					if (node.size * node.size < theta2 * (dx * dx + dy * dy + dz * dz)) {
+						acc.point(node.cx, node.cy, node.cz, node.mass);
+						++cells;
+						continue;
+					}
+					for (uint32_t c = 0; c < node.child_count; ++c) stack[top++] = node.first_child + c;
+				}
+				E ax, ay, az;
+				acc.result(ax, ay, az);
+				const size_t dst = order_[i];
+				o[dst * 3] = g * ax;
+				o[dst * 3 + 1] = g * ay;
+				o[dst * 3 + 2] = g * az;
+			}
+			body_counts[ch] = bodies;
+			node_counts[ch] = cells;
+		});
+		for (size_t ch = 0; ch < chunks; ++ch) {
+			stats_.body_interactions += body_counts[ch];
+			stats_.node_interactions += node_counts[ch];
+		}
+	}
+
+	/*
+		@brief
+			build() then accelerations().
+	*/
+	EUCVECTORINLINE void solve(const VectorType* positions, const E* mass, size_t count, VectorType* out) {
+		build(positions, mass, count);
+		accelerations(out);
+	}
+};
+
+/*
+	@brief
+		Direct O(N^2) accelerations, the reference for EucBarnesHut.
+*/
+template<class E, meta::if_t<_STD is_floating_point_v<E>> = 0>
+EUCVECTORINLINE void euc_nbody_direct(const EuclideanCmplVector3<E>* positions, const E* mass, size_t count,
+	EuclideanCmplVector3<E>* out, E g = E(1), E softening = E(0), unsigned threads = 0) {
+	const E* p = reinterpret_cast<const E*>(positions);
+	const size_t padded = count + detail::nbody_pad;
+	_STD vector<E> x(padded, E(0)), y(padded, E(0)), z(padded, E(0)), m(padded, E(0));
+	for (size_t i = 0; i < count; ++i) {
+		x[i] = p[i * 3];
+		y[i] = p[i * 3 + 1];
+		z[i] = p[i * 3 + 2];
+		m[i] = mass ? mass[i] : E(1);
+	}
+	E* o = reinterpret_cast<E*>(out);
+	const E eps2 = softening * softening;
+	detail::parallel_for(count, 64, threads, [&](size_t i0, size_t i1) {
+		for (size_t i = i0; i < i1; ++i) {
+			detail::NBodyAccumulator<E> acc(x[i], y[i], z[i], eps2);
+			acc.range(x.data(), y.data(), z.data(), m.data(), 0, count);
+			E ax, ay, az;
+			acc.result(ax, ay, az);
+			o[i * 3] = g * ax;
+			o[i * 3 + 1] = g * ay;
+			o[i * 3 + 2] = g * az;
+		}
+	});
+}
+
+/*
+	@brief
+		RMS of |approx - exact| / |exact| over the bodies where exact is non-zero.
+*/
+template<class E>
+EUCNODISCARD_MSG("The error measurement was ignored. This may be an unintended call.")
+	EUCVECTORINLINE double euc_nbody_rms_error(const EuclideanCmplVector3<E>* approx, const EuclideanCmplVector3<E>* exact, size_t count) {
+	double sum = 0.0;
+	size_t n = 0;
+	for (size_t i = 0; i < count; ++i) {
+		const double ex = exact[i].x_, ey = exact[i].y_, ez = exact[i].z_;
+		const double dx = approx[i].x_ - ex, dy = approx[i].y_ - ey, dz = approx[i].z_ - ez;
+		const double norm2 = ex * ex + ey * ey + ez * ez;
+		if (norm2 == 0.0) continue;
+		sum += (dx * dx + dy * dy + dz * dz) / norm2;
+		++n;
+	}
+	return n ? _STD sqrt(sum / static_cast<double>(n)) : 0.0;
+}
+
+/*
+	@brief
+		Register Barnes-Hut (build + force pass) and the direct sum on count bodies with an EucBenchmark.
+		The direct sum is skipped above direct_limit bodies.
+*/
+template<class Bench, class E>
+EUCVECTORINLINE void euc_bench_nbody(Bench& bench, const EuclideanCmplVector3<E>* positions, const E* mass, size_t count,
+	const EucNBodyOptions<E>& options = {}, size_t direct_limit = 65536) {
+	auto out = _STD make_shared<_STD vector<EuclideanCmplVector3<E>>>(count, EuclideanCmplVector3<E>(E(0), E(0), E(0)));
+	auto tree = _STD make_shared<EucBarnesHut<E>>(options);
+	const _STD string suffix = "(" + _STD to_string(count) + ")";
+	bench.run("nbody.barnes_hut" + suffix, count, static_cast<double>(sizeof(E) * 7), [=] {
+		tree->solve(positions, mass, count, out->data());
+	});
+	if (count <= direct_limit) {
+		bench.run("nbody.direct" + suffix, count, static_cast<double>(sizeof(E) * 7), [=] {
+			euc_nbody_direct(positions, mass, count, out->data(), options.g, options.softening, options.threads);
+		});
+	}
+}
+
+//name space end.
+}
+
+#endif
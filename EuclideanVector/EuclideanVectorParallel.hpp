@@ -0,0 +1,103 @@
+//
+//	EuclideanVector Parallel
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Minimal fork/join helper used by the batch modules.
+//	Work is split into contiguous chunks; the calling thread runs the first chunk itself
+//	and the remaining chunks run on std::thread workers that are joined before returning.
+//	A thread count of 0 means "use std::thread::hardware_concurrency()".
+//.
+
+#ifndef THL_EUCLID_VECTOR_PARALLEL_HPP
+#define THL_EUCLID_VECTOR_PARALLEL_HPP
+
+#include "EuclideanVector.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+//details.
+namespace detail {
+
+	/*
+		@brief
+			Number of workers to use for a request of threads (0 = hardware).
+	*/
+	EUCNODISCARD EUCVECTORINLINE unsigned resolve_threads(unsigned threads) noexcept {
+		if (threads != 0) return threads;
+		const unsigned hw = _STD thread::hardware_concurrency();
+		return hw == 0 ? 1u : hw;
+	}
+
+	/*
+		@brief
+			Number of chunks that count items split into when each chunk holds at least grain items.
+	*/
+	EUCNODISCARD EUCVECTORINLINE size_t chunk_count(size_t count, size_t grain, unsigned threads) noexcept {
+		if (count == 0) return 0;
+		if (grain == 0) grain = 1;
+		const size_t by_grain = (count + grain - 1) / grain;
+		const size_t by_thread = resolve_threads(threads);
+		return by_grain < by_thread ? by_grain : by_thread;
+	}
+
+	/*
+		@brief
+			Run fn(chunk_index) for chunk_index in [0, chunks) concurrently.
+			The first exception thrown by any chunk is rethrown after every worker has joined.
+	*/
+	template<class F>
+	EUCVECTORINLINE void parallel_invoke(size_t chunks, F&& fn) {
+		if (chunks == 0) return;
+		if (chunks == 1) {
+			fn(size_t(0));
+			return;
+		}
+
+		_STD vector<_STD exception_ptr> errors(chunks);
+		_STD vector<_STD thread> workers;
+		workers.reserve(chunks - 1);
+
+		for (size_t c = 1; c < chunks; ++c) {
+			workers.emplace_back([&fn, &errors, c]() {
+				try { fn(c); }
+				catch (...) { errors[c] = _STD current_exception(); }
+			});
+		}
+		try { fn(size_t(0)); }
+		catch (...) { errors[0] = _STD current_exception(); }
+
+		for (auto& worker : workers) worker.join();
+		for (auto& error : errors) {
+			if (error) _STD rethrow_exception(error);
+		}
+	}
+
+	/*
+		@brief
+			Split [0, count) into contiguous ranges and run fn(begin, end) on each concurrently.
+	*/
+	template<class F>
+	EUCVECTORINLINE void parallel_for(size_t count, size_t grain, unsigned threads, F&& fn) {
+		const size_t chunks = chunk_count(count, grain, threads);
+		parallel_invoke(chunks, [&](size_t c) {
+			const size_t begin = count * c / chunks;
+			const size_t end = count * (c + 1) / chunks;
+			if (begin != end) fn(begin, end);
+		});
+	}
+
+}
+
+//name space end.
+}
+
+#endif
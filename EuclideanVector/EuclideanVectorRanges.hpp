@@ -0,0 +1,712 @@
+//
+//	EuclideanVector Ranges
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	C++20 lazy views over ranges of vectors, and a terminal collect.
+//
+//		auto view = points
+//			| views::transformed(model)			// R x C row-major matrix, out = M * v (column vectors).
+//			| views::normalized
+//			| views::filtered([](const auto& n) { return n.z_ > 0; })
+//			| views::projected_xy;
+//
+//		for (auto v : view) ...						// computed on dereference, nothing is stored.
+//		auto out = euc_collect(view);				// std::vector of the result vectors. euc_collect_into writes to a pointer.
+//
+//	The stages of one pipe are kept in one view (EucPipeView), so a pipeline is one view over the source,
+//	whatever its length. It is a forward view and composes with std::views. Each element runs through every
+//	stage once, when the iterator reaches it. Elements are values of EuclideanCmplVectorN (euc_cmpl_vector_t).
+//
+//	euc_collect on a pipe whose source is a contiguous range of flat float or double vectors takes the fused
+//	path: blocks of 256 vectors are split into one array per component, each stage runs over the whole block
+//	(AVX when available) and the kept results are written out. The source is read and the result is written
+//	once, whatever the number of stages. Other ranges are collected by iterating.
+//
+//	Both paths evaluate the same operations in the same order, so they return the same bits.
+//
+//	Requires concepts and <ranges> (THL_EUC_RANGES is defined when they are available).
+//.
+
+#ifndef THL_EUCLID_VECTOR_RANGES_HPP
+#define THL_EUCLID_VECTOR_RANGES_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#if defined(THL_EUC_CONCEPTS) && __has_include(<ranges>)
+#	include <ranges>
+#	if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
+#		define THL_EUC_RANGES
+#	endif
+#endif
+
+#if defined(THL_EUC_RANGES)
+
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+template<class R, class... S>
+class EucPipeView;
+
+//meta functions.
+namespace meta {
+
+	template<class T>
+	constexpr bool is_euc_pipe_view_v = false;
+
+	template<class R, class... S>
+	constexpr bool is_euc_pipe_view_v<EucPipeView<R, S...>> = true;
+
+	// ranges whose elements a pipe can read.
+	template<class R>
+	constexpr bool is_euc_vector_range_v = [] {
+		if constexpr (_STD ranges::forward_range<R>) {
+			return is_euc_vector_v<_STD remove_cvref_t<_STD ranges::range_reference_t<R>>>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	constexpr size_t view_block = 256;
+	constexpr size_t view_grain = 16384;
+
+	/*
+		One block of vectors, one array per component.
+	*/
+	template<class E>
+	struct ViewLanes {
+		alignas(32) E c[4][view_block];
+	};
+
+	/*
+		AVX registers for the block stages of float and double.
+	*/
+	template<class E>
+	struct ViewReg {
+		static constexpr size_t W = 0;
+	};
+
+#if defined(THL_EUC_AVX)
+	template<>
+	struct ViewReg<float> {
+		using type = __m256;
+		static constexpr size_t W = 8;
+		static EUCVECTORINLINE type load(const float* p) noexcept { return _mm256_load_ps(p); }
+		static EUCVECTORINLINE void store(float* p, type v) noexcept { _mm256_store_ps(p, v); }
+		static EUCVECTORINLINE type set1(float v) noexcept { return _mm256_set1_ps(v); }
+		static EUCVECTORINLINE type add(type a, type b) noexcept { return _mm256_add_ps(a, b); }
+		static EUCVECTORINLINE type mul(type a, type b) noexcept { return _mm256_mul_ps(a, b); }
+		static EUCVECTORINLINE type div(type a, type b) noexcept { return _mm256_div_ps(a, b); }
+		static EUCVECTORINLINE type sqrt(type a) noexcept { return _mm256_sqrt_ps(a); }
+	};
+
+	template<>
+	struct ViewReg<double> {
+		using type = __m256d;
+		static constexpr size_t W = 4;
+		static EUCVECTORINLINE type load(const double* p) noexcept { return _mm256_load_pd(p); }
+		static EUCVECTORINLINE void store(double* p, type v) noexcept { _mm256_store_pd(p, v); }
+		static EUCVECTORINLINE type set1(double v) noexcept { return _mm256_set1_pd(v); }
+		static EUCVECTORINLINE type add(type a, type b) noexcept { return _mm256_add_pd(a, b); }
+		static EUCVECTORINLINE type mul(type a, type b) noexcept { return _mm256_mul_pd(a, b); }
+		static EUCVECTORINLINE type div(type a, type b) noexcept { return _mm256_div_pd(a, b); }
+		static EUCVECTORINLINE type sqrt(type a) noexcept { return _mm256_sqrt_pd(a); }
+	};
+#endif
+
+	/*
+		@brief
+			Run stage s on lanes [0, n) of in: vop(i, ViewReg<E>{}) for whole registers,
+			then the scalar stage on the remaining lanes.
+	*/
+	template<size_t D, class S, class E, class F>
+	EUCVECTORINLINE void view_lanes(const S& s, const ViewLanes<E>& in, ViewLanes<E>& out, size_t n, F&& vop) noexcept {
+		size_t i = 0;
+		if constexpr (ViewReg<E>::W != 0) {
+			for (; i + ViewReg<E>::W <= n; i += ViewReg<E>::W) vop(i, ViewReg<E>{});
+		}
+		for (; i < n; ++i) {
+			E v[D];
+			E r[S::template dim<D>];
+			for (size_t k = 0; k < D; ++k) v[k] = in.c[k][i];
+			s.template apply<D>(v, r);
+			for (size_t k = 0; k < S::template dim<D>; ++k) out.c[k][i] = r[k];
+		}
+	}
+
+	/*
+		Stages. dim<D> is the output dimension for D input components.
+		apply works on one vector and apply_lanes on a block; both round the same way.
+	*/
+	struct ViewNormalize {
+		static constexpr bool filter = false;
+
+		template<size_t D>
+		static constexpr size_t dim = D;
+
+		template<size_t D, class E>
+		EUCVECTORINLINE void apply(const E* in, E* out) const noexcept {
+			E sq = in[0] * in[0];
+			for (size_t k = 1; k < D; ++k) sq = sq + in[k] * in[k];
+			const E norm = _STD sqrt(sq);
+			for (size_t k = 0; k < D; ++k) out[k] = in[k] / norm;
+		}
+
+		template<size_t D, class E>
+		EUCVECTORINLINE void apply_lanes(const ViewLanes<E>& in, ViewLanes<E>& out, size_t n) const noexcept {
+			view_lanes<D>(*this, in, out, n, [&](size_t i, auto reg) {
+				using Reg = decltype(reg);
+				auto sq = Reg::mul(Reg::load(in.c[0] + i), Reg::load(in.c[0] + i));
+				for (size_t k = 1; k < D; ++k) sq = Reg::add(sq, Reg::mul(Reg::load(in.c[k] + i), Reg::load(in.c[k] + i)));
+				const auto norm = Reg::sqrt(sq);
+				for (size_t k = 0; k < D; ++k) Reg::store(out.c[k] + i, Reg::div(Reg::load(in.c[k] + i), norm));
+			});
+		}
+	};
+
+	template<class M, size_t R, size_t C>
+	struct ViewMatrix {
+		static constexpr bool filter = false;
+
+		template<size_t D>
+		static constexpr size_t dim = R;
+
+		M m[R][C];
+
+		template<size_t D, class E>
+		EUCVECTORINLINE void apply(const E* in, E* out) const noexcept {
+			static_assert(C == D || C == D + 1, "The matrix needs one column per component, plus an optional translation column.");
+			for (size_t r = 0; r < R; ++r) {
+				E acc = static_cast<E>(m[r][0]) * in[0];
+				for (size_t c = 1; c < D; ++c) acc = acc + static_cast<E>(m[r][c]) * in[c];
+				if constexpr (C == D + 1) acc = acc + static_cast<E>(m[r][D]);
+				out[r] = acc;
+			}
+		}
+
+		template<size_t D, class E>
+		EUCVECTORINLINE void apply_lanes(const ViewLanes<E>& in, ViewLanes<E>& out, size_t n) const noexcept {
+			view_lanes<D>(*this, in, out, n, [&](size_t i, auto reg) {
+				using Reg = decltype(reg);
+				for (size_t r = 0; r < R; ++r) {
+					auto acc = Reg::mul(Reg::set1(static_cast<E>(m[r][0])), Reg::load(in.c[0] + i));
+					for (size_t c = 1; c < D; ++c) acc = Reg::add(acc, Reg::mul(Reg::set1(static_cast<E>(m[r][c])), Reg::load(in.c[c] + i)));
+					if constexpr (C == D + 1) acc = Reg::add(acc, Reg::set1(static_cast<E>(m[r][D])));
+					Reg::store(out.c[r] + i, acc);
+				}
+			});
+		}
+	};
+
+	struct ViewProjectXY {
+		static constexpr bool filter = false;
+
+		template<size_t D>
+		static constexpr size_t dim = 2;
+
+		template<size_t D, class E>
+		EUCVECTORINLINE void apply(const E* in, E* out) const noexcept {
+			static_assert(D >= 2, "projected_xy needs at least two components.");
+			out[0] = in[0];
+			out[1] = in[1];
+		}
+
+		template<size_t D, class E>
+		EUCVECTORINLINE void apply_lanes(const ViewLanes<E>& in, ViewLanes<E>& out, size_t n) const noexcept {
+			static_assert(D >= 2, "projected_xy needs at least two components.");
+			for (size_t i = 0; i < n; ++i) out.c[0][i] = in.c[0][i];
+			for (size_t i = 0; i < n; ++i) out.c[1][i] = in.c[1][i];
+		}
+	};
+
+	/*
+		The predicate is held in an optional so that the stage (and the view) stays assignable
+		when the predicate is a capturing lambda.
+	*/
+	template<class P>
+	struct ViewFilter {
+		static constexpr bool filter = true;
+
+		template<size_t D>
+		static constexpr size_t dim = D;
+
+		_STD optional<P> pred;
+
+		explicit ViewFilter(P p) : pred(_STD in_place, _STD move(p)) {}
+		ViewFilter(const ViewFilter&) = default;
+		ViewFilter(ViewFilter&&) = default;
+
+		ViewFilter& operator=(const ViewFilter& other) {
+			if (this != &other) {
+				if (other.pred) pred.emplace(*other.pred);
+				else pred.reset();
+			}
+			return *this;
+		}
+
+		ViewFilter& operator=(ViewFilter&& other) noexcept(_STD is_nothrow_move_constructible_v<P>) {
+			if (this != &other) {
+				if (other.pred) pred.emplace(_STD move(*other.pred));
+				else pred.reset();
+			}
+			return *this;
+		}
+
+		template<size_t D, class E>
+		EUCNODISCARD EUCVECTORINLINE bool test(const E* in) const {
+			const auto v = euc_make<meta::euc_cmpl_vector_t<E, D>>(in);
+			return static_cast<bool>(_STD invoke(*pred, v));
+		}
+	};
+
+	template<size_t D, class... S>
+	constexpr size_t view_dim = D;
+
+	template<size_t D, class S, class... Rest>
+	constexpr size_t view_dim<D, S, Rest...> = view_dim<S::template dim<D>, Rest...>;
+
+	/*
+		@brief
+			Run stages [I, end) on one vector. Returns false when a filter drops it.
+	*/
+	template<size_t I, size_t D, class E, class Stages>
+	EUCVECTORINLINE bool view_run(const Stages& stages, const E* in, E* out) {
+		if constexpr (I == _STD tuple_size_v<Stages>) {
+			for (size_t k = 0; k < D; ++k) out[k] = in[k];
+			return true;
+		}
+		else {
+			const auto& s = _STD get<I>(stages);
+			using S = _STD remove_cvref_t<decltype(s)>;
+			if constexpr (S::filter) {
+				return s.template test<D>(in) && view_run<I + 1, D>(stages, in, out);
+			}
+			else {
+				E next[S::template dim<D>];
+				s.template apply<D>(in, next);
+				return view_run<I + 1, S::template dim<D>>(stages, next, out);
+			}
+		}
+	}
+
+	/*
+		@brief
+			Run stages [I, end) on a block, alternating between the two lane buffers.
+			Returns the buffer that holds the result.
+	*/
+	template<size_t I, size_t D, class E, class Stages>
+	EUCVECTORINLINE ViewLanes<E>* view_run_lanes(const Stages& stages, ViewLanes<E>* in, ViewLanes<E>* out, bool* keep, size_t n) {
+		if constexpr (I == _STD tuple_size_v<Stages>) {
+			return in;
+		}
+		else {
+			const auto& s = _STD get<I>(stages);
+			using S = _STD remove_cvref_t<decltype(s)>;
+			if constexpr (S::filter) {
+				for (size_t i = 0; i < n; ++i) {
+					if (!keep[i]) continue;
+					E v[D];
+					for (size_t k = 0; k < D; ++k) v[k] = in->c[k][i];
+					keep[i] = s.template test<D>(v);
+				}
+				return view_run_lanes<I + 1, D>(stages, in, out, keep, n);
+			}
+			else {
+				s.template apply_lanes<D>(*in, *out, n);
+				return view_run_lanes<I + 1, S::template dim<D>>(stages, out, in, keep, n);
+			}
+		}
+	}
+
+	/*
+		@brief
+			Run every stage on n <= view_block vectors of D components from src, and write the kept results
+			to dst. Returns the number written.
+	*/
+	template<size_t D, class E, class... S>
+	EUCVECTORINLINE size_t view_block_run(const _STD tuple<S...>& stages, const E* src, size_t n, E* dst) {
+		constexpr size_t out_dim = view_dim<D, S...>;
+		constexpr bool has_filter = (S::filter || ...);
+
+		ViewLanes<E> a;
+		ViewLanes<E> b;
+		bool keep[view_block];
+		for (size_t i = 0; i < n; ++i) {
+			for (size_t k = 0; k < D; ++k) a.c[k][i] = src[i * D + k];
+		}
+		if constexpr (has_filter) {
+			for (size_t i = 0; i < n; ++i) keep[i] = true;
+		}
+
+		const ViewLanes<E>* result = view_run_lanes<0, D>(stages, &a, &b, keep, n);
+
+		if constexpr (has_filter) {
+			size_t written = 0;
+			for (size_t i = 0; i < n; ++i) {
+				if (!keep[i]) continue;
+				for (size_t k = 0; k < out_dim; ++k) dst[written * out_dim + k] = result->c[k][i];
+				++written;
+			}
+			return written;
+		}
+		else {
+			for (size_t i = 0; i < n; ++i) {
+				for (size_t k = 0; k < out_dim; ++k) dst[i * out_dim + k] = result->c[k][i];
+			}
+			return n;
+		}
+	}
+
+	/*
+		Closure of one or more stages, applied with operator|.
+	*/
+	template<class... S>
+	struct ViewClosure {
+		_STD tuple<S...> stages;
+
+		template<class R>
+			requires _STD ranges::viewable_range<R> && meta::is_euc_vector_range_v<_STD views::all_t<R>>
+		EUCNODISCARD friend constexpr auto operator|(R&& r, const ViewClosure& closure) {
+			using Range = _STD remove_cvref_t<R>;
+			if constexpr (meta::is_euc_pipe_view_v<Range>) {
+				return _STD forward<R>(r).template append<S...>(closure.stages);
+			}
+			else {
+				return EucPipeView<_STD views::all_t<R>, S...>(_STD views::all(_STD forward<R>(r)), closure.stages);
+			}
+		}
+
+		template<class... T>
+		EUCNODISCARD friend constexpr ViewClosure<S..., T...> operator|(const ViewClosure& lhs, const ViewClosure<T...>& rhs) {
+			return { _STD tuple_cat(lhs.stages, rhs.stages) };
+		}
+	};
+
+}
+
+/*
+	Lazy view that runs a chain of stages over a forward range of vectors.
+	Built by the adaptors in thl::vector::views.
+*/
+template<class R, class... S>
+class EucPipeView final : public _STD ranges::view_interface<EucPipeView<R, S...>> {
+public:
+
+	using source_type = _STD remove_cvref_t<_STD ranges::range_reference_t<R>>;
+	using elem_type = meta::euc_elem_t<source_type>;
+	static constexpr size_t source_dim = meta::euc_dimension_v<source_type>;
+	static constexpr size_t dim = detail::view_dim<source_dim, S...>;
+	static constexpr bool has_filter = (S::filter || ...);
+	using value_type = meta::euc_cmpl_vector_t<elem_type, dim>;
+
+	struct sentinel {
+		_STD ranges::sentinel_t<const R> end_;
+	};
+
+	class iterator {
+	protected:
+
+		const EucPipeView* view_ = nullptr;
+		_STD ranges::iterator_t<const R> it_{};
+		elem_type value_[dim] = {};
+
+		/*
+			@brief
+				Move forward to the first element that passes every filter, and compute it.
+		*/
+		EUCVECTORINLINE void settle() {
+			const auto end = _STD ranges::end(view_->base_);
+			for (; it_ != end; ++it_) {
+				const auto& src = *it_;
+				elem_type in[source_dim];
+				size_t k = 0;
+				detail::euc_for_each(src, [&](const auto& e) { in[k++] = static_cast<elem_type>(e); });
+				if (detail::view_run<0, source_dim>(view_->stages_, in, value_)) return;
+			}
+		}
+
+	public:
+
+		using iterator_concept = _STD forward_iterator_tag;
+		using iterator_category = _STD input_iterator_tag;
+		using value_type = EucPipeView::value_type;
+		using difference_type = _STD ranges::range_difference_t<const R>;
+
+		iterator() = default;
+
+		EUCVECTORINLINE iterator(const EucPipeView* view, _STD ranges::iterator_t<const R> it)
+			: view_(view)
+			, it_(_STD move(it))
+		{
+			settle();
+		}
+
+		EUCNODISCARD EUCVECTORINLINE value_type operator*() const {
+			return detail::euc_make<value_type>(value_);
+		}
+
+		EUCVECTORINLINE iterator& operator++() {
+			++it_;
+			settle();
+			return *this;
+		}
+
+		EUCVECTORINLINE iterator operator++(int) {
+			iterator prev = *this;
+			++*this;
+			return prev;
+		}
+
+		EUCNODISCARD friend EUCVECTORINLINE bool operator==(const iterator& lhs, const iterator& rhs) { return lhs.it_ == rhs.it_; }
+		EUCNODISCARD friend EUCVECTORINLINE bool operator==(const iterator& lhs, const sentinel& rhs) { return lhs.it_ == rhs.end_; }
+	};
+
+protected:
+
+	R base_;
+	_STD tuple<S...> stages_;
+
+public:
+
+	/*
+		Constructors.
+	*/
+	EucPipeView() = default;
+
+	constexpr EucPipeView(R base, _STD tuple<S...> stages)
+		: base_(_STD move(base))
+		, stages_(_STD move(stages))
+	{}
+
+	EUCNODISCARD EUCVECTORINLINE const R& base() const& noexcept { return base_; }
+	EUCNODISCARD EUCVECTORINLINE const _STD tuple<S...>& stages() const& noexcept { return stages_; }
+
+	/*
+		@brief
+			This pipe with more stages at the end.
+	*/
+	template<class... T>
+	EUCNODISCARD EUCVECTORINLINE EucPipeView<R, S..., T...> append(const _STD tuple<T...>& stages) const& {
+		return EucPipeView<R, S..., T...>(base_, _STD tuple_cat(stages_, stages));
+	}
+
+	template<class... T>
+	EUCNODISCARD EUCVECTORINLINE EucPipeView<R, S..., T...> append(const _STD tuple<T...>& stages) && {
+		return EucPipeView<R, S..., T...>(_STD move(base_), _STD tuple_cat(_STD move(stages_), stages));
+	}
+
+	EUCNODISCARD EUCVECTORINLINE iterator begin() const { return iterator(this, _STD ranges::begin(base_)); }
+	EUCNODISCARD EUCVECTORINLINE sentinel end() const { return sentinel{ _STD ranges::end(base_) }; }
+
+	EUCNODISCARD EUCVECTORINLINE auto size() const
+		requires (!has_filter && _STD ranges::sized_range<const R>)
+	{
+		return _STD ranges::size(base_);
+	}
+
+};
+
+//meta functions.
+namespace meta {
+
+	// pipes that euc_collect runs block by block.
+	template<class P>
+	constexpr bool is_euc_fusable_pipe_v = [] {
+		if constexpr (is_euc_pipe_view_v<P>) {
+			using R = _STD remove_cvref_t<decltype(_STD declval<const P&>().base())>;
+			if constexpr (_STD ranges::contiguous_range<const R> && _STD ranges::sized_range<const R>) {
+				using E = typename P::elem_type;
+				return is_euc_flat_v<typename P::source_type> && is_euc_flat_v<typename P::value_type>
+					&& (_STD is_same_v<E, float> || _STD is_same_v<E, double>);
+			}
+			else {
+				return false;
+			}
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	/*
+		@brief
+			Fused collect: every block goes through all stages before the next block is read.
+	*/
+	template<class P>
+	EUCVECTORINLINE size_t view_collect_fused(const P& pipe, typename P::value_type* out, unsigned threads) {
+		using E = typename P::elem_type;
+		const auto& base = pipe.base();
+		const size_t count = static_cast<size_t>(_STD ranges::size(base));
+		const E* src = reinterpret_cast<const E*>(_STD ranges::data(base));
+		E* dst = reinterpret_cast<E*>(out);
+
+		const auto run = [&](size_t begin, size_t end) {
+			size_t written = 0;
+			for (size_t i = begin; i < end; i += view_block) {
+				const size_t n = end - i < view_block ? end - i : view_block;
+				written += view_block_run<P::source_dim>(pipe.stages(), src + i * P::source_dim, n, dst + (begin + written) * P::dim);
+			}
+			return written;
+		};
+
+		if constexpr (P::has_filter) {
+			return run(0, count);
+		}
+		else {
+			parallel_for(count, view_grain, threads, run);
+			return count;
+		}
+	}
+
+	/*
+		@brief
+			Fused collect into a vector. On one thread each block is appended from a stack buffer,
+			so the result is not zero-filled first.
+	*/
+	template<class P>
+	EUCVECTORINLINE auto view_collect_fused(const P& pipe, unsigned threads) {
+		using E = typename P::elem_type;
+		using V = typename P::value_type;
+		const auto& base = pipe.base();
+		const size_t count = static_cast<size_t>(_STD ranges::size(base));
+
+		_STD vector<V> out;
+		if (P::has_filter || chunk_count(count, view_grain, threads) <= 1) {
+			const E* src = reinterpret_cast<const E*>(_STD ranges::data(base));
+			alignas(V) E buffer[view_block * P::dim];
+			out.reserve(count);
+			for (size_t i = 0; i < count; i += view_block) {
+				const size_t n = count - i < view_block ? count - i : view_block;
+				const size_t written = view_block_run<P::source_dim>(pipe.stages(), src + i * P::source_dim, n, buffer);
+				const V* first = reinterpret_cast<const V*>(buffer);
+				out.insert(out.end(), first, first + written);
+			}
+		}
+		else {
+			out.resize(count);
+			view_collect_fused(pipe, out.data(), threads);
+		}
+		return out;
+	}
+
+}
+
+//adaptors.
+namespace views {
+
+	/*
+		@brief
+			Each vector divided by its norm.
+	*/
+	inline constexpr detail::ViewClosure<detail::ViewNormalize> normalized{};
+
+	/*
+		@brief
+			The first two components.
+	*/
+	inline constexpr detail::ViewClosure<detail::ViewProjectXY> projected_xy{};
+
+	/*
+		@brief
+			M * v for a row-major R x C matrix. C is the source dimension, or the source dimension + 1
+			with the last column added as a translation. The result has R components.
+	*/
+	template<class M, size_t R, size_t C>
+	EUCNODISCARD constexpr auto transformed(const M (&m)[R][C]) noexcept {
+		detail::ViewMatrix<M, R, C> stage{};
+		for (size_t r = 0; r < R; ++r) {
+			for (size_t c = 0; c < C; ++c) stage.m[r][c] = m[r][c];
+		}
+		return detail::ViewClosure<detail::ViewMatrix<M, R, C>>{ { stage } };
+	}
+
+	/*
+		@brief
+			transformed for a row-major matrix of R * C consecutive elements.
+	*/
+	template<size_t R, size_t C, class M>
+	EUCNODISCARD constexpr auto transformed(const M* m) noexcept {
+		detail::ViewMatrix<M, R, C> stage{};
+		for (size_t r = 0; r < R; ++r) {
+			for (size_t c = 0; c < C; ++c) stage.m[r][c] = m[r * C + c];
+		}
+		return detail::ViewClosure<detail::ViewMatrix<M, R, C>>{ { stage } };
+	}
+
+	/*
+		@brief
+			The vectors for which pred(v) is true. pred receives the vector at this point of the pipe.
+	*/
+	template<class P>
+	EUCNODISCARD constexpr auto filtered(P pred) {
+		return detail::ViewClosure<detail::ViewFilter<P>>{ { detail::ViewFilter<P>(_STD move(pred)) } };
+	}
+
+}
+
+/*
+	@brief
+		Write the elements of r to out, which must have room for all of them. Returns the number written.
+		A fusable pipe (see meta::is_euc_fusable_pipe_v) runs block by block, on several threads when it has no filter.
+*/
+template<class R>
+	requires _STD ranges::input_range<R>
+EUCVECTORINLINE size_t euc_collect_into(R&& r, _STD ranges::range_value_t<R>* out, unsigned threads = 0) {
+	if constexpr (meta::is_euc_fusable_pipe_v<_STD remove_cvref_t<R>>) {
+		return detail::view_collect_fused(r, out, threads);
+	}
+	else {
+		size_t written = 0;
+		for (auto&& v : r) out[written++] = v;
+		return written;
+	}
+}
+
+/*
+	@brief
+		The elements of r in a std::vector.
+*/
+template<class R>
+	requires _STD ranges::input_range<R>
+EUCNODISCARD EUCVECTORINLINE auto euc_collect(R&& r, unsigned threads = 0) {
+	if constexpr (meta::is_euc_fusable_pipe_v<_STD remove_cvref_t<R>>) {
+		return detail::view_collect_fused(r, threads);
+	}
+	else {
+		_STD vector<_STD ranges::range_value_t<R>> out;
+		if constexpr (_STD ranges::sized_range<R>) out.reserve(static_cast<size_t>(_STD ranges::size(r)));
+		for (auto&& v : r) out.push_back(v);
+		return out;
+	}
+}
+
+//name space end.
+}
+
+#endif
+
+#endif
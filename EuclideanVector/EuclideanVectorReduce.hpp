@@ -0,0 +1,332 @@
+//
+//	EuclideanVector Reduce
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Sum and mean of large vector arrays in the element type, with a selectable summation method.
+//
+//	Naive		one running sum per component. The error grows with the count.
+//	Pairwise	leaves of 256 vectors summed directly, then combined as a balanced tree. O(log n) error growth.
+//	Kahan		compensated sum. The error does not grow with the count while the terms keep one sign.
+//	Neumaier	compensated sum that takes the exact error of each addition (TwoSum). It stays accurate when
+//				terms cancel or are larger than the running sum. This is the default.
+//
+//	Flat float and double vectors are read as one element stream. With AVX, several registers of
+//	running sums (and compensations) are kept. Their lane count is a multiple of the dimension, so every lane
+//	always sees the same component. The lanes are folded per component at the end with the same method.
+//	Threads take fixed blocks of 16384 vectors, and the block results are combined in order (as a tree for
+//	Pairwise). The result therefore does not depend on the number of threads.
+//
+//	The compensated methods rely on IEEE evaluation order. Do not build them with -ffast-math or /fp:fast,
+//	which may reassociate the compensation away.
+//.
+
+#ifndef THL_EUCLID_VECTOR_REDUCE_HPP
+#define THL_EUCLID_VECTOR_REDUCE_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+enum class EucSumMethod {
+	Naive,
+	Pairwise,
+	Kahan,
+	Neumaier,
+};
+
+//meta functions.
+namespace meta {
+
+	// float and double vectors read as one element stream.
+	template<class V>
+	constexpr bool is_euc_reduce_stream_v = [] {
+		if constexpr (is_euc_flat_v<V>) {
+			return _STD is_same_v<euc_elem_t<V>, float> || _STD is_same_v<euc_elem_t<V>, double>;
+		}
+		else {
+			return false;
+		}
+	}();
+
+}
+
+//details.
+namespace detail {
+
+	constexpr size_t reduce_block = 16384;
+	constexpr size_t reduce_leaf = 256;
+
+	template<class E, size_t D>
+	struct ReducePartial {
+		E s[D];
+		E c[D];		// compensation, added to s at the end.
+	};
+
+	/*
+		@brief
+			s + x with the exact rounding error accumulated into c (Knuth TwoSum).
+	*/
+	template<class E>
+	EUCVECTORINLINE void reduce_two_sum(E& s, E& c, E x) noexcept {
+		const E t = s + x;
+		const E z = t - s;
+		c += (s - (t - z)) + (x - z);
+		s = t;
+	}
+
+	template<EucSumMethod M, class E, size_t D>
+	EUCVECTORINLINE void reduce_add(ReducePartial<E, D>& p, size_t k, E x) noexcept {
+		if constexpr (M == EucSumMethod::Kahan) {
+			const E y = x + p.c[k];
+			const E t = p.s[k] + y;
+			p.c[k] = y - (t - p.s[k]);
+			p.s[k] = t;
+		}
+		else if constexpr (M == EucSumMethod::Neumaier) {
+			reduce_two_sum(p.s[k], p.c[k], x);
+		}
+		else {
+			p.s[k] += x;
+		}
+	}
+
+	template<EucSumMethod M, class E, size_t D>
+	EUCVECTORINLINE void reduce_merge(ReducePartial<E, D>& p, const ReducePartial<E, D>& q) noexcept {
+		for (size_t k = 0; k < D; ++k) {
+			if constexpr (M == EucSumMethod::Kahan || M == EucSumMethod::Neumaier) {
+				reduce_two_sum(p.s[k], p.c[k], q.s[k]);
+				p.c[k] += q.c[k];
+			}
+			else {
+				p.s[k] += q.s[k];
+			}
+		}
+	}
+
+	/*
+		AVX registers of running sums for float and double.
+	*/
+	template<class E>
+	struct ReduceReg {
+		static constexpr size_t W = 0;
+	};
+
+#if defined(THL_EUC_AVX)
+	template<>
+	struct ReduceReg<float> {
+		using type = __m256;
+		static constexpr size_t W = 8;
+		static EUCVECTORINLINE type zero() noexcept { return _mm256_setzero_ps(); }
+		static EUCVECTORINLINE type load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+		static EUCVECTORINLINE void store(float* p, type v) noexcept { _mm256_storeu_ps(p, v); }
+		static EUCVECTORINLINE type add(type a, type b) noexcept { return _mm256_add_ps(a, b); }
+		static EUCVECTORINLINE type sub(type a, type b) noexcept { return _mm256_sub_ps(a, b); }
+	};
+
+	template<>
+	struct ReduceReg<double> {
+		using type = __m256d;
+		static constexpr size_t W = 4;
+		static EUCVECTORINLINE type zero() noexcept { return _mm256_setzero_pd(); }
+		static EUCVECTORINLINE type load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+		static EUCVECTORINLINE void store(double* p, type v) noexcept { _mm256_storeu_pd(p, v); }
+		static EUCVECTORINLINE type add(type a, type b) noexcept { return _mm256_add_pd(a, b); }
+		static EUCVECTORINLINE type sub(type a, type b) noexcept { return _mm256_sub_pd(a, b); }
+	};
+#endif
+
+	/*
+		@brief
+			Add count vectors of an element stream into p with method M (Pairwise adds directly).
+	*/
+	template<EucSumMethod M, size_t D, class E>
+	EUCVECTORINLINE void reduce_stream(const E* src, size_t count, ReducePartial<E, D>& p) noexcept {
+		const size_t n = count * D;
+		size_t i = 0;
+		if constexpr (ReduceReg<E>::W != 0) {
+			using Reg = ReduceReg<E>;
+			using R = typename Reg::type;
+			// Regs * W is a multiple of D, so lane l always holds component l % D.
+			constexpr size_t Regs = D == 3 ? 3 : 2;
+			constexpr size_t Step = Regs * Reg::W;
+			if (n >= Step) {
+				R s[Regs], c[Regs];
+				for (size_t r = 0; r < Regs; ++r) s[r] = c[r] = Reg::zero();
+				for (; i + Step <= n; i += Step) {
+					for (size_t r = 0; r < Regs; ++r) {
+						const R x = Reg::load(src + i + r * Reg::W);
+						if constexpr (M == EucSumMethod::Kahan) {
+							const R y = Reg::add(x, c[r]);
+							const R t = Reg::add(s[r], y);
+							c[r] = Reg::sub(y, Reg::sub(t, s[r]));
+							s[r] = t;
+						}
+						else if constexpr (M == EucSumMethod::Neumaier) {
+							const R t = Reg::add(s[r], x);
+							const R z = Reg::sub(t, s[r]);
+							c[r] = Reg::add(c[r], Reg::add(Reg::sub(s[r], Reg::sub(t, z)), Reg::sub(x, z)));
+							s[r] = t;
+						}
+						else {
+							s[r] = Reg::add(s[r], x);
+						}
+					}
+				}
+				E ls[Step], lc[Step];
+				for (size_t r = 0; r < Regs; ++r) {
+					Reg::store(ls + r * Reg::W, s[r]);
+					Reg::store(lc + r * Reg::W, c[r]);
+				}
+				ReducePartial<E, D> lanes = {};
+				for (size_t l = 0; l < Step; ++l) {
+					if constexpr (M == EucSumMethod::Kahan || M == EucSumMethod::Neumaier) {
+						reduce_two_sum(lanes.s[l % D], lanes.c[l % D], ls[l]);
+						lanes.c[l % D] += lc[l];
+					}
+					else {
+						lanes.s[l % D] += ls[l];
+					}
+				}
+				reduce_merge<M>(p, lanes);
+			}
+		}
+		for (; i < n; ++i) reduce_add<M>(p, i % D, src[i]);
+	}
+
+	/*
+		@brief
+			Pairwise sum of count vectors of an element stream.
+	*/
+	template<size_t D, class E>
+	EUCVECTORINLINE void reduce_pairwise_stream(const E* src, size_t count, ReducePartial<E, D>& p) noexcept {
+		if (count <= reduce_leaf) {
+			reduce_stream<EucSumMethod::Naive, D>(src, count, p);
+			return;
+		}
+		const size_t half = count / 2;
+		ReducePartial<E, D> l = {}, r = {};
+		reduce_pairwise_stream<D>(src, half, l);
+		reduce_pairwise_stream<D>(src + half * D, count - half, r);
+		for (size_t k = 0; k < D; ++k) p.s[k] += l.s[k] + r.s[k];
+	}
+
+	template<EucSumMethod M, class E, size_t D, class V>
+	EUCVECTORINLINE void reduce_vectors(const V* v, size_t count, ReducePartial<E, D>& p) {
+		if constexpr (M == EucSumMethod::Pairwise) {
+			if (count > reduce_leaf) {
+				const size_t half = count / 2;
+				ReducePartial<E, D> l = {}, r = {};
+				reduce_vectors<M>(v, half, l);
+				reduce_vectors<M>(v + half, count - half, r);
+				for (size_t k = 0; k < D; ++k) p.s[k] += l.s[k] + r.s[k];
+				return;
+			}
+		}
+		for (size_t i = 0; i < count; ++i) {
+			size_t k = 0;
+			euc_for_each(v[i], [&](const auto& e) { reduce_add<M == EucSumMethod::Pairwise ? EucSumMethod::Naive : M>(p, k++, static_cast<E>(e)); });
+		}
+	}
+
+	template<EucSumMethod M, class E, size_t D, class V>
+	EUCVECTORINLINE void reduce_range(const V* v, size_t count, ReducePartial<E, D>& p) {
+		if constexpr (meta::is_euc_reduce_stream_v<V> && _STD is_same_v<meta::euc_elem_t<V>, E>) {
+			const E* src = reinterpret_cast<const E*>(v);
+			if constexpr (M == EucSumMethod::Pairwise) reduce_pairwise_stream<D>(src, count, p);
+			else reduce_stream<M, D>(src, count, p);
+		}
+		else {
+			reduce_vectors<M>(v, count, p);
+		}
+	}
+
+	template<class E, size_t D>
+	EUCVECTORINLINE void reduce_pairwise_partials(ReducePartial<E, D>* parts, size_t n, ReducePartial<E, D>& p) noexcept {
+		if (n == 1) {
+			for (size_t k = 0; k < D; ++k) p.s[k] += parts[0].s[k];
+			return;
+		}
+		ReducePartial<E, D> l = {}, r = {};
+		reduce_pairwise_partials(parts, n / 2, l);
+		reduce_pairwise_partials(parts + n / 2, n - n / 2, r);
+		for (size_t k = 0; k < D; ++k) p.s[k] += l.s[k] + r.s[k];
+	}
+
+	template<EucSumMethod M, class E, size_t D, class V>
+	EUCVECTORINLINE ReducePartial<E, D> reduce_blocks(const V* v, size_t count, unsigned threads) {
+		ReducePartial<E, D> p = {};
+		const size_t blocks = (count + reduce_block - 1) / reduce_block;
+		if (blocks <= 1) {
+			reduce_range<M>(v, count, p);
+			return p;
+		}
+		_STD vector<ReducePartial<E, D>> parts(blocks, ReducePartial<E, D>{});
+		parallel_for(blocks, 1, threads, [&](size_t b, size_t e) {
+			for (size_t k = b; k < e; ++k) {
+				const size_t end = (k + 1) * reduce_block < count ? (k + 1) * reduce_block : count;
+				reduce_range<M>(v + k * reduce_block, end - k * reduce_block, parts[k]);
+			}
+		});
+		if constexpr (M == EucSumMethod::Pairwise) {
+			reduce_pairwise_partials(parts.data(), blocks, p);
+		}
+		else {
+			for (const auto& q : parts) reduce_merge<M>(p, q);
+		}
+		return p;
+	}
+
+}
+
+/*
+	@brief
+		Sum of count vectors in the element type, using method.
+*/
+template<class V, meta::if_t<meta::is_euc_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_cmpl_vector_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_sum(const V* v, size_t count,
+	EucSumMethod method = EucSumMethod::Neumaier, unsigned threads = 0) {
+	using E = meta::euc_elem_t<V>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	detail::ReducePartial<E, D> p;
+	switch (method) {
+	case EucSumMethod::Naive:		p = detail::reduce_blocks<EucSumMethod::Naive, E, D>(v, count, threads); break;
+	case EucSumMethod::Pairwise:	p = detail::reduce_blocks<EucSumMethod::Pairwise, E, D>(v, count, threads); break;
+	case EucSumMethod::Kahan:		p = detail::reduce_blocks<EucSumMethod::Kahan, E, D>(v, count, threads); break;
+	default:						p = detail::reduce_blocks<EucSumMethod::Neumaier, E, D>(v, count, threads); break;
+	}
+	E out[D];
+	for (size_t k = 0; k < D; ++k) out[k] = p.s[k] + p.c[k];
+	return detail::euc_make<meta::euc_cmpl_vector_t<E, D>>(out);
+}
+
+/*
+	@brief
+		Mean of count vectors in the element type, using method for the sum. Zero when count is 0.
+*/
+template<class V, meta::if_t<meta::is_euc_vector_v<V>> = 0>
+EUCNODISCARD EUCVECTORINLINE meta::euc_cmpl_vector_t<meta::euc_elem_t<V>, meta::euc_dimension_v<V>> euc_mean(const V* v, size_t count,
+	EucSumMethod method = EucSumMethod::Neumaier, unsigned threads = 0) {
+	using E = meta::euc_elem_t<V>;
+	constexpr size_t D = meta::euc_dimension_v<V>;
+	auto sum = euc_sum(v, count, method, threads);
+	E out[D] = {};
+	if (count > 0) {
+		size_t k = 0;
+		detail::euc_for_each(sum, [&](const E& e) { out[k++] = static_cast<E>(e / static_cast<E>(count)); });
+	}
+	return detail::euc_make<meta::euc_cmpl_vector_t<E, D>>(out);
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,325 @@
+//
+//	EuclideanVector Ring
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Lock-free bounded rings for streaming vector batches between threads.
+//
+//	A ring holds a power-of-two number of slots, and each slot stores up to BatchSize vectors in place.
+//	Producers fill slots and consumers read or transform them where they are, so a batch is never copied
+//	between threads:
+//
+//		auto* slot = ring.try_acquire();			// producer. nullptr when full.
+//		fill(slot->data);
+//		ring.commit(slot, n);
+//
+//		auto* slot = ring.try_consume();			// consumer. nullptr when empty.
+//		transform(slot->data, slot->count);
+//		ring.release(slot);
+//
+//	push / pop are bulk versions that copy through the same slots.
+//
+//	EucSpscRing		one producer thread and one consumer thread. Each side writes one index and keeps a cached
+//					copy of the other, so the shared line is read only when the cached index says full / empty.
+//	EucMpmcRing		any number of producers and consumers. Each slot carries a sequence number, and a position
+//					is claimed with one compare-exchange (bounded MPMC queue, D. Vyukov).
+//
+//	The indices written by different threads live on separate cache lines. Neither ring ever blocks: when
+//	try_acquire / try_consume returns nullptr, the caller decides whether to spin, yield or do other work.
+//.
+
+#ifndef THL_EUCLID_VECTOR_RING_HPP
+#define THL_EUCLID_VECTOR_RING_HPP
+
+#include "EuclideanVector.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+//name space begin.
+namespace thl::vector {
+
+//details.
+namespace detail {
+
+	constexpr size_t ring_cache_line = 64;
+
+	EUCNODISCARD EUCVECTORINLINE size_t ring_capacity(size_t slots) noexcept {
+		size_t capacity = 2;
+		while (capacity < slots) capacity *= 2;
+		return capacity;
+	}
+
+}
+
+/*
+	Batch storage of a ring. data and count belong to whoever acquired the slot, until commit / release.
+*/
+template<class V, size_t BatchSize>
+struct EucRingSlot {
+	alignas(detail::ring_cache_line) V data[BatchSize];
+	size_t count;
+
+	size_t pos_;					// ring position of the current owner.
+	_STD atomic<size_t> seq_;		// EucMpmcRing only.
+};
+
+/*
+	@brief
+		Copy src into slots, BatchSize vectors per slot, until the vectors or the free slots run out.
+		Returns the number of vectors pushed.
+*/
+template<class Ring, class V>
+EUCVECTORINLINE size_t euc_ring_push(Ring& ring, const V* src, size_t count) {
+	size_t pushed = 0;
+	while (pushed < count) {
+		auto* slot = ring.try_acquire();
+		if (!slot) break;
+		const size_t n = count - pushed < Ring::batch_size ? count - pushed : Ring::batch_size;
+		for (size_t i = 0; i < n; ++i) slot->data[i] = src[pushed + i];
+		ring.commit(slot, n);
+		pushed += n;
+	}
+	return pushed;
+}
+
+/*
+	@brief
+		Copy whole batches into dst while at least BatchSize vectors of room remain and the ring is not empty.
+		Returns the number of vectors popped.
+*/
+template<class Ring, class V>
+EUCVECTORINLINE size_t euc_ring_pop(Ring& ring, V* dst, size_t max) {
+	size_t popped = 0;
+	while (max - popped >= Ring::batch_size) {
+		auto* slot = ring.try_consume();
+		if (!slot) break;
+		for (size_t i = 0; i < slot->count; ++i) dst[popped + i] = slot->data[i];
+		popped += slot->count;
+		ring.release(slot);
+	}
+	return popped;
+}
+
+/*
+	Single-producer single-consumer ring.
+*/
+template<class V, size_t BatchSize = 256>
+class EucSpscRing final {
+public:
+
+	using Slot = EucRingSlot<V, BatchSize>;
+	static constexpr size_t batch_size = BatchSize;
+
+protected:
+
+	alignas(detail::ring_cache_line) _STD atomic<size_t> head_;	// next slot to consume. Written by the consumer.
+	size_t tail_cache_;												// consumer's copy of tail_.
+
+	alignas(detail::ring_cache_line) _STD atomic<size_t> tail_;	// next slot to fill. Written by the producer.
+	size_t head_cache_;												// producer's copy of head_.
+
+	alignas(detail::ring_cache_line) size_t mask_;
+	_STD unique_ptr<Slot[]> slots_;
+
+public:
+
+	/*
+		Constructors.
+		slots is rounded up to a power of two, at least 2.
+	*/
+	explicit EucSpscRing(size_t slots)
+		: head_(0)
+		, tail_cache_(0)
+		, tail_(0)
+		, head_cache_(0)
+		, mask_(detail::ring_capacity(slots) - 1)
+		, slots_(new Slot[mask_ + 1])
+	{}
+
+	EucSpscRing(const EucSpscRing&) = delete;
+	EucSpscRing& operator=(const EucSpscRing&) = delete;
+
+	/*
+		@brief
+			Producer: the next free slot, or nullptr when the ring is full.
+	*/
+	EUCNODISCARD EUCVECTORINLINE Slot* try_acquire() noexcept {
+		const size_t tail = tail_.load(_STD memory_order_relaxed);
+		if (tail - head_cache_ > mask_) {
+			head_cache_ = head_.load(_STD memory_order_acquire);
+			if (tail - head_cache_ > mask_) return nullptr;
+		}
+		return &slots_[tail & mask_];
+	}
+
+	/*
+		@brief
+			Producer: publish the slot from try_acquire with count vectors.
+	*/
+	EUCVECTORINLINE void commit(Slot* slot, size_t count) noexcept {
+		slot->count = count;
+		tail_.store(tail_.load(_STD memory_order_relaxed) + 1, _STD memory_order_release);
+	}
+
+	/*
+		@brief
+			Consumer: the oldest published slot, or nullptr when the ring is empty.
+	*/
+	EUCNODISCARD EUCVECTORINLINE Slot* try_consume() noexcept {
+		const size_t head = head_.load(_STD memory_order_relaxed);
+		if (head == tail_cache_) {
+			tail_cache_ = tail_.load(_STD memory_order_acquire);
+			if (head == tail_cache_) return nullptr;
+		}
+		return &slots_[head & mask_];
+	}
+
+	/*
+		@brief
+			Consumer: hand the slot from try_consume back to the producer.
+	*/
+	EUCVECTORINLINE void release(Slot*) noexcept {
+		head_.store(head_.load(_STD memory_order_relaxed) + 1, _STD memory_order_release);
+	}
+
+	EUCVECTORINLINE size_t push(const V* src, size_t count) { return euc_ring_push(*this, src, count); }
+	EUCVECTORINLINE size_t pop(V* dst, size_t max) { return euc_ring_pop(*this, dst, max); }
+
+	/*
+		@brief
+			Number of published slots. Exact only when called from the producer or consumer thread with the other idle.
+	*/
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept {
+		return tail_.load(_STD memory_order_acquire) - head_.load(_STD memory_order_acquire);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t capacity() const noexcept { return mask_ + 1; }
+
+};
+
+/*
+	Multi-producer multi-consumer ring.
+*/
+template<class V, size_t BatchSize = 256>
+class EucMpmcRing final {
+public:
+
+	using Slot = EucRingSlot<V, BatchSize>;
+	static constexpr size_t batch_size = BatchSize;
+
+protected:
+
+	alignas(detail::ring_cache_line) _STD atomic<size_t> enqueue_;
+	alignas(detail::ring_cache_line) _STD atomic<size_t> dequeue_;
+	alignas(detail::ring_cache_line) size_t mask_;
+	_STD unique_ptr<Slot[]> slots_;
+
+public:
+
+	/*
+		Constructors.
+		slots is rounded up to a power of two, at least 2.
+	*/
+	explicit EucMpmcRing(size_t slots)
+		: enqueue_(0)
+		, dequeue_(0)
+		, mask_(detail::ring_capacity(slots) - 1)
+		, slots_(new Slot[mask_ + 1])
+	{
+		for (size_t i = 0; i <= mask_; ++i) slots_[i].seq_.store(i, _STD memory_order_relaxed);
+	}
+
+	EucMpmcRing(const EucMpmcRing&) = delete;
+	EucMpmcRing& operator=(const EucMpmcRing&) = delete;
+
+	/*
+		@brief
+			Producer: claim a free slot, or nullptr when the ring is full.
+	*/
+	EUCNODISCARD EUCVECTORINLINE Slot* try_acquire() noexcept {
+		size_t pos = enqueue_.load(_STD memory_order_relaxed);
+		for (;;) {
+			Slot& slot = slots_[pos & mask_];
+			const intptr_t diff = static_cast<intptr_t>(slot.seq_.load(_STD memory_order_acquire) - pos);
+			if (diff == 0) {
+				if (enqueue_.compare_exchange_weak(pos, pos + 1, _STD memory_order_relaxed)) {
+					slot.pos_ = pos;
+					return &slot;
+				}
+			}
+			else if (diff < 0) {
+				return nullptr;
+			}
+			else {
+				pos = enqueue_.load(_STD memory_order_relaxed);
+			}
+		}
+	}
+
+	/*
+		@brief
+			Producer: publish the slot from try_acquire with count vectors.
+	*/
+	EUCVECTORINLINE void commit(Slot* slot, size_t count) noexcept {
+		slot->count = count;
+		slot->seq_.store(slot->pos_ + 1, _STD memory_order_release);
+	}
+
+	/*
+		@brief
+			Consumer: claim the oldest published slot, or nullptr when the ring is empty.
+	*/
+	EUCNODISCARD EUCVECTORINLINE Slot* try_consume() noexcept {
+		size_t pos = dequeue_.load(_STD memory_order_relaxed);
+		for (;;) {
+			Slot& slot = slots_[pos & mask_];
+			const intptr_t diff = static_cast<intptr_t>(slot.seq_.load(_STD memory_order_acquire) - (pos + 1));
+			if (diff == 0) {
+				if (dequeue_.compare_exchange_weak(pos, pos + 1, _STD memory_order_relaxed)) {
+					slot.pos_ = pos;
+					return &slot;
+				}
+			}
+			else if (diff < 0) {
+				return nullptr;
+			}
+			else {
+				pos = dequeue_.load(_STD memory_order_relaxed);
+			}
+		}
+	}
+
+	/*
+		@brief
+			Consumer: hand the slot from try_consume back to the producers.
+	*/
+	EUCVECTORINLINE void release(Slot* slot) noexcept {
+		slot->seq_.store(slot->pos_ + mask_ + 1, _STD memory_order_release);
+	}
+
+	EUCVECTORINLINE size_t push(const V* src, size_t count) { return euc_ring_push(*this, src, count); }
+	EUCVECTORINLINE size_t pop(V* dst, size_t max) { return euc_ring_pop(*this, dst, max); }
+
+	/*
+		@brief
+			Number of claimed-for-write minus claimed-for-read slots. Approximate while other threads are active.
+	*/
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept {
+		const size_t enqueue = enqueue_.load(_STD memory_order_acquire);
+		const size_t dequeue = dequeue_.load(_STD memory_order_acquire);
+		return enqueue > dequeue ? enqueue - dequeue : 0;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t capacity() const noexcept { return mask_ + 1; }
+
+};
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,444 @@
+//
+//	EuclideanVector Shm
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Shared-memory ring for streaming vector batches between processes (POSIX shm_open + mmap).
+//
+//	One process creates the ring and the other opens it by name:
+//
+//		_STD errc ec;
+//		auto ring = EucShmRing<EuclideanCmplVector4<float>>::create("/sensor", 64, ec);	// producer.
+//		auto ring = EucShmRing<EuclideanCmplVector4<float>>::open("/sensor", ec);		// consumer.
+//
+//	The protocol is the same as EucSpscRing: one producer and one consumer. Each slot holds up to BatchSize
+//	vectors, and both sides work on the shared pages directly, so no vector is serialised or copied:
+//
+//		auto out = ring.try_acquire();			// producer. Empty when the consumer is behind.
+//		fill(out.data, out.count);
+//		ring.commit(n);
+//
+//		auto in = ring.try_consume();			// consumer. Empty when nothing was published.
+//		solve(in.data, in.count);
+//		ring.release();
+//
+//	acquire / consume wait up to a timeout instead. A producer that cannot get a slot is held back until the
+//	consumer releases one; nothing is dropped. close() marks the end of the stream.
+//
+//	The segment starts with a header: magic, layout version, the vector signature (element size, floating point or
+//	integer, dimension, batch size) and the slot geometry. open() fails with invalid_argument if any of them
+//	differs from the caller's instantiation, so the two sides cannot disagree about the layout. The producer
+//	and consumer indices are lock-free 64-bit atomics on separate cache lines.
+//
+//	THL_EUC_SHM is defined when the platform provides shm_open. The creator unlinks the name when it is destroyed.
+//.
+
+#ifndef THL_EUCLID_VECTOR_SHM_HPP
+#define THL_EUCLID_VECTOR_SHM_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define THL_EUC_SHM
+#endif
+
+#if defined(THL_EUC_SHM)
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//name space begin.
+namespace thl::vector {
+
+/*
+	Vectors of one slot, in shared memory.
+*/
+template<class T>
+struct EucShmSpan {
+	T* data;
+	size_t count;
+
+	EUCNODISCARD EUCVECTORINLINE T* begin() const noexcept { return data; }
+	EUCNODISCARD EUCVECTORINLINE T* end() const noexcept { return data + count; }
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept { return count; }
+	EUCNODISCARD EUCVECTORINLINE explicit operator bool() const noexcept { return data != nullptr; }
+};
+
+//details.
+namespace detail {
+
+	constexpr uint32_t shm_magic = 0x52435545u;	// "EUCR"
+	constexpr uint32_t shm_version = 1;
+	constexpr size_t shm_line = 64;
+
+	static_assert(_STD atomic<uint64_t>::is_always_lock_free, "The shared ring needs lock-free 64-bit atomics");
+
+	/*
+		Layout version 1. Fixed-width fields only, so both processes agree regardless of how they were built.
+	*/
+	struct ShmHeader {
+		uint32_t magic;
+		uint32_t version;
+		_STD atomic<uint32_t> ready;	// set last by the creator.
+		uint32_t elem_size;
+		uint32_t elem_floating;
+		uint32_t dimension;
+		uint32_t batch_size;
+		uint32_t reserved;
+		uint64_t slots;
+		uint64_t slot_stride;
+		uint64_t data_offset;
+		uint64_t total_size;
+
+		alignas(shm_line) _STD atomic<uint64_t> tail;	// next slot to fill. Written by the producer.
+		alignas(shm_line) _STD atomic<uint64_t> head;	// next slot to consume. Written by the consumer.
+		alignas(shm_line) _STD atomic<uint32_t> closed;
+	};
+
+	EUCNODISCARD EUCVECTORINLINE constexpr size_t shm_round(size_t bytes) noexcept {
+		return (bytes + shm_line - 1) / shm_line * shm_line;
+	}
+
+}
+
+/*
+	Single-producer single-consumer ring in a named shared-memory segment.
+*/
+template<class V, size_t BatchSize = 1024>
+class EucShmRing final {
+
+	static_assert(meta::is_euc_flat_v<V> && _STD is_trivially_copyable_v<V>, "Shared memory holds flat, trivially copyable vectors");
+
+public:
+
+	static constexpr size_t batch_size = BatchSize;
+
+protected:
+
+	// Each slot is a cache line with the vector count, followed by the vectors.
+	static constexpr size_t SlotStride = detail::shm_line + detail::shm_round(sizeof(V) * BatchSize);
+
+	detail::ShmHeader* header_;
+	unsigned char* slots_;
+	size_t bytes_;
+	uint64_t mask_;
+	uint64_t head_cache_;	// producer's copy of head.
+	uint64_t tail_cache_;	// consumer's copy of tail.
+	_STD string unlink_;	// name to unlink on destruction, creator only.
+
+	EUCNODISCARD EUCVECTORINLINE uint64_t& slot_count(uint64_t pos) const noexcept {
+		return *reinterpret_cast<uint64_t*>(slots_ + (pos & mask_) * SlotStride);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE V* slot_data(uint64_t pos) const noexcept {
+		return reinterpret_cast<V*>(slots_ + (pos & mask_) * SlotStride + detail::shm_line);
+	}
+
+	EUCVECTORINLINE void attach(void* base, size_t bytes) noexcept {
+		header_ = static_cast<detail::ShmHeader*>(base);
+		slots_ = static_cast<unsigned char*>(base) + header_->data_offset;
+		bytes_ = bytes;
+		mask_ = header_->slots - 1;
+		head_cache_ = header_->head.load(_STD memory_order_acquire);
+		tail_cache_ = header_->tail.load(_STD memory_order_acquire);
+	}
+
+	EUCVECTORINLINE void unmap() noexcept {
+		if (header_) ::munmap(header_, bytes_);
+		if (!unlink_.empty()) ::shm_unlink(unlink_.c_str());
+		header_ = nullptr;
+		slots_ = nullptr;
+		bytes_ = 0;
+		unlink_.clear();
+	}
+
+	EUCNODISCARD static EUCVECTORINLINE _STD errc last_error() noexcept {
+		return static_cast<_STD errc>(errno);
+	}
+
+	EUCNODISCARD static EUCVECTORINLINE bool matches(const detail::ShmHeader& h) noexcept {
+		return h.magic == detail::shm_magic && h.version == detail::shm_version
+			&& h.elem_size == sizeof(meta::euc_elem_t<V>) && h.elem_floating == (_STD is_floating_point_v<meta::euc_elem_t<V>> ? 1u : 0u)
+			&& h.dimension == meta::euc_dimension_v<V> && h.batch_size == BatchSize
+			&& h.slots != 0 && (h.slots & (h.slots - 1)) == 0 && h.slot_stride == SlotStride
+			&& h.data_offset == detail::shm_round(sizeof(detail::ShmHeader)) && h.total_size == h.data_offset + h.slots * h.slot_stride;
+	}
+
+	template<class Rep, class Period, class F>
+	EUCVECTORINLINE auto wait(_STD chrono::duration<Rep, Period> timeout, F&& attempt) {
+		const auto deadline = _STD chrono::steady_clock::now() + timeout;
+		for (unsigned spin = 0;; ++spin) {
+			auto span = attempt();
+			if (span) return span;
+			if (spin >= 64) {
+				if (_STD chrono::steady_clock::now() >= deadline) return span;
+				_STD this_thread::yield();
+			}
+		}
+	}
+
+public:
+
+	/*
+		Constructors.
+		A default-constructed ring is not attached to any segment.
+	*/
+	EucShmRing() noexcept
+		: header_(nullptr)
+		, slots_(nullptr)
+		, bytes_(0)
+		, mask_(0)
+		, head_cache_(0)
+		, tail_cache_(0)
+		, unlink_()
+	{}
+
+	EucShmRing(EucShmRing&& other) noexcept
+		: header_(_STD exchange(other.header_, nullptr))
+		, slots_(_STD exchange(other.slots_, nullptr))
+		, bytes_(_STD exchange(other.bytes_, 0))
+		, mask_(other.mask_)
+		, head_cache_(other.head_cache_)
+		, tail_cache_(other.tail_cache_)
+		, unlink_(_STD move(other.unlink_))
+	{
+		other.unlink_.clear();
+	}
+
+	EucShmRing& operator=(EucShmRing&& other) noexcept {
+		if (this != &other) {
+			unmap();
+			header_ = _STD exchange(other.header_, nullptr);
+			slots_ = _STD exchange(other.slots_, nullptr);
+			bytes_ = _STD exchange(other.bytes_, 0);
+			mask_ = other.mask_;
+			head_cache_ = other.head_cache_;
+			tail_cache_ = other.tail_cache_;
+			unlink_ = _STD move(other.unlink_);
+			other.unlink_.clear();
+		}
+		return *this;
+	}
+
+	EucShmRing(const EucShmRing&) = delete;
+	EucShmRing& operator=(const EucShmRing&) = delete;
+
+	~EucShmRing() {
+		unmap();
+	}
+
+	/*
+		@brief
+			Create the segment name ("/name") with slots rounded up to a power of two, at least 2.
+			file_exists if the name is already in use; remove() it first to replace a stale segment.
+	*/
+	EUCNODISCARD static EucShmRing create(const char* name, size_t slots, _STD errc& ec) {
+		EucShmRing ring;
+		size_t capacity = 2;
+		while (capacity < slots) capacity *= 2;
+		const size_t offset = detail::shm_round(sizeof(detail::ShmHeader));
+		const size_t bytes = offset + capacity * SlotStride;
+
+		const int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (fd < 0) {
+			ec = last_error();
+			return ring;
+		}
+		if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+			ec = last_error();
+			::close(fd);
+			::shm_unlink(name);
+			return ring;
+		}
+		void* base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED) {
+			ec = last_error();
+			::shm_unlink(name);
+			return ring;
+		}
+
+		auto* header = ::new (base) detail::ShmHeader{};
+		header->magic = detail::shm_magic;
+		header->version = detail::shm_version;
+		header->elem_size = sizeof(meta::euc_elem_t<V>);
+		header->elem_floating = _STD is_floating_point_v<meta::euc_elem_t<V>> ? 1u : 0u;
+		header->dimension = meta::euc_dimension_v<V>;
+		header->batch_size = BatchSize;
+		header->slots = capacity;
+		header->slot_stride = SlotStride;
+		header->data_offset = offset;
+		header->total_size = bytes;
+		header->ready.store(1, _STD memory_order_release);
+
+		ring.attach(base, bytes);
+		ring.unlink_ = name;
+		ec = _STD errc();
+		return ring;
+	}
+
+	/*
+		@brief
+			Open a segment made by create().
+			resource_unavailable_try_again while the creator is still initialising it, invalid_argument if its
+			layout version or vector signature differs from this instantiation.
+	*/
+	EUCNODISCARD static EucShmRing open(const char* name, _STD errc& ec) {
+		EucShmRing ring;
+		const int fd = ::shm_open(name, O_RDWR, 0600);
+		if (fd < 0) {
+			ec = last_error();
+			return ring;
+		}
+		struct stat st;
+		if (::fstat(fd, &st) != 0) {
+			ec = last_error();
+			::close(fd);
+			return ring;
+		}
+		const size_t bytes = static_cast<size_t>(st.st_size);
+		if (bytes < sizeof(detail::ShmHeader)) {
+			ec = _STD errc::resource_unavailable_try_again;
+			::close(fd);
+			return ring;
+		}
+		void* base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (base == MAP_FAILED) {
+			ec = last_error();
+			return ring;
+		}
+
+		const auto* header = static_cast<const detail::ShmHeader*>(base);
+		if (header->ready.load(_STD memory_order_acquire) != 1) {
+			ec = _STD errc::resource_unavailable_try_again;
+			::munmap(base, bytes);
+			return ring;
+		}
+		if (!matches(*header) || header->total_size > bytes) {
+			ec = _STD errc::invalid_argument;
+			::munmap(base, bytes);
+			return ring;
+		}
+
+		ring.attach(base, bytes);
+		ec = _STD errc();
+		return ring;
+	}
+
+	/*
+		@brief
+			Unlink a segment name, for example one left behind by a crashed creator.
+	*/
+	static EUCVECTORINLINE bool remove(const char* name) noexcept {
+		return ::shm_unlink(name) == 0;
+	}
+
+	EUCNODISCARD EUCVECTORINLINE explicit operator bool() const noexcept { return header_ != nullptr; }
+
+	/*
+		@brief
+			Producer: the next free slot with count = BatchSize, or an empty span when the ring is full.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucShmSpan<V> try_acquire() noexcept {
+		const uint64_t tail = header_->tail.load(_STD memory_order_relaxed);
+		if (tail - head_cache_ > mask_) {
+			head_cache_ = header_->head.load(_STD memory_order_acquire);
+			if (tail - head_cache_ > mask_) return { nullptr, 0 };
+		}
+		return { slot_data(tail), BatchSize };
+	}
+
+	/*
+		@brief
+			Producer: publish the slot from try_acquire with count vectors. count must not exceed BatchSize.
+	*/
+	EUCVECTORINLINE void commit(size_t count) noexcept {
+		assert(count <= BatchSize);
+		const uint64_t tail = header_->tail.load(_STD memory_order_relaxed);
+		slot_count(tail) = count;
+		header_->tail.store(tail + 1, _STD memory_order_release);
+	}
+
+	/*
+		@brief
+			Consumer: the oldest published slot, or an empty span when nothing is published.
+			The count comes from shared memory and is clamped to BatchSize, so a faulty producer cannot
+			make the span run past the slot.
+	*/
+	EUCNODISCARD EUCVECTORINLINE EucShmSpan<const V> try_consume() noexcept {
+		const uint64_t head = header_->head.load(_STD memory_order_relaxed);
+		if (head == tail_cache_) {
+			tail_cache_ = header_->tail.load(_STD memory_order_acquire);
+			if (head == tail_cache_) return { nullptr, 0 };
+		}
+		const uint64_t count = slot_count(head);
+		return { slot_data(head), count < BatchSize ? static_cast<size_t>(count) : BatchSize };
+	}
+
+	/*
+		@brief
+			Consumer: hand the slot from try_consume back to the producer.
+	*/
+	EUCVECTORINLINE void release() noexcept {
+		header_->head.store(header_->head.load(_STD memory_order_relaxed) + 1, _STD memory_order_release);
+	}
+
+	/*
+		@brief
+			try_acquire / try_consume, retried until timeout. Spins briefly, then yields.
+	*/
+	template<class Rep, class Period>
+	EUCNODISCARD EUCVECTORINLINE EucShmSpan<V> acquire(_STD chrono::duration<Rep, Period> timeout) {
+		return wait(timeout, [this] { return try_acquire(); });
+	}
+
+	template<class Rep, class Period>
+	EUCNODISCARD EUCVECTORINLINE EucShmSpan<const V> consume(_STD chrono::duration<Rep, Period> timeout) {
+		return wait(timeout, [this] { return try_consume(); });
+	}
+
+	/*
+		@brief
+			Producer: mark the end of the stream. The consumer sees closed() once it has drained the ring.
+	*/
+	EUCVECTORINLINE void close() noexcept {
+		header_->closed.store(1, _STD memory_order_release);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE bool closed() const noexcept {
+		return header_->closed.load(_STD memory_order_acquire) != 0
+			&& header_->head.load(_STD memory_order_relaxed) == header_->tail.load(_STD memory_order_acquire);
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept {
+		return static_cast<size_t>(header_->tail.load(_STD memory_order_acquire) - header_->head.load(_STD memory_order_acquire));
+	}
+
+	EUCNODISCARD EUCVECTORINLINE size_t capacity() const noexcept { return static_cast<size_t>(mask_ + 1); }
+
+};
+
+//name space end.
+}
+
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+//
+//	EuclideanVector Simd
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Instruction set detection for the batch kernels.
+//	Each kernel keeps a scalar path and adds wider paths under the macros below,
+//	which follow the compiler's target flags (/arch:AVX2, -mavx2, -mf16c, ...).
+//
+//	THL_EUC_SSE2	128-bit float / int.
+//	THL_EUC_SSE41	blend, round, packus_epi32, mullo_epi32.
+//	THL_EUC_AVX		256-bit float.
+//	THL_EUC_AVX2	256-bit int.
+//	THL_EUC_FMA		fused multiply add.
+//	THL_EUC_F16C	float <-> half conversion.
+//
+//	Define THL_EUC_NO_SIMD to force the scalar paths.
+//.
+
+#ifndef THL_EUCLID_VECTOR_SIMD_HPP
+#define THL_EUCLID_VECTOR_SIMD_HPP
+
+#if !defined(THL_EUC_NO_SIMD)
+#	if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define THL_EUC_SSE2 1
+#	endif
+#	if defined(__SSE4_1__) || defined(__AVX__)
+#	define THL_EUC_SSE41 1
+#	endif
+#	if defined(__AVX__)
+#	define THL_EUC_AVX 1
+#	endif
+#	if defined(__AVX2__)
+#	define THL_EUC_AVX2 1
+#	endif
+#	if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#	define THL_EUC_FMA 1
+#	endif
+#	if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#	define THL_EUC_F16C 1
+#	endif
+#endif
+
+#if defined(THL_EUC_SSE2)
+#include <immintrin.h>
+#endif
+
+#endif
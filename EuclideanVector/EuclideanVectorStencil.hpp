@@ -0,0 +1,374 @@
+//
+//	EuclideanVector Stencil
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Finite-difference gradient, divergence, curl and Laplacian on regular grids.
+//
+//	EucGrid3<T> is a dense x-fastest grid of scalars or EuclideanCmplVector3. A row of packed vectors is
+//	therefore a flat stream x y z x y z ..., and the neighbours along x are +-3 elements away.
+//	Central differences are taken along the stream directly, 8 (float) or 4 (double) elements per AVX step, with
+//	no deinterleaving. The derivative rows are then combined per cell into the divergence, curl or gradient.
+//	The Laplacian is computed on the stream in one step.
+//
+//	The sweep walks tiles of rows along y. Within a tile it moves through z, so the rows of the planes k - 1, k and
+//	k + 1 stay in cache while they are reused. Slabs of z run on separate threads.
+//
+//	Interior cells use second-order central differences. Border cells use one-sided first-order differences.
+//	The Laplacian treats the border as zero-flux (the missing neighbour equals the cell).
+//.
+
+#ifndef THL_EUCLID_VECTOR_STENCIL_HPP
+#define THL_EUCLID_VECTOR_STENCIL_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+//meta functions.
+namespace meta {
+
+	template<class T, class = void>
+	struct euc_grid_elem {
+		using type = T;
+		static constexpr size_t components = 1;
+	};
+
+	template<class T>
+	struct euc_grid_elem<T, _STD enable_if_t<is_euc_vector_v<T>>> {
+		using type = euc_elem_t<T>;
+		static constexpr size_t components = euc_dimension_v<T>;
+	};
+
+	template<class T>
+	using euc_grid_elem_t = typename euc_grid_elem<T>::type;
+
+	template<class T>
+	constexpr bool is_euc_grid_cell_v = [] {
+		if constexpr (is_euc_vector_v<T>) {
+			return is_euc_flat_v<T> && euc_dimension_v<T> == 3 && _STD is_floating_point_v<euc_elem_t<T>>;
+		}
+		else {
+			return _STD is_floating_point_v<T>;
+		}
+	}();
+
+}
+
+/*
+	Dense nx x ny x nz grid, x fastest, with uniform spacing.
+	T is a floating point type or a packed EuclideanCmplVector3 of one.
+*/
+template<class T>
+class EucGrid3 {
+public:
+
+	static_assert(meta::is_euc_grid_cell_v<T>, "EucGrid3 holds floating point scalars or packed EuclideanCmplVector3");
+
+	using ElemType = meta::euc_grid_elem_t<T>;
+	static constexpr size_t Components = meta::euc_grid_elem<T>::components;
+
+protected:
+
+	size_t nx_, ny_, nz_;
+	ElemType spacing_;
+	_STD vector<T> data_;
+
+public:
+
+	EucGrid3() noexcept
+		: nx_(0), ny_(0), nz_(0), spacing_(ElemType(1))
+	{}
+
+	EucGrid3(size_t nx, size_t ny, size_t nz, ElemType spacing = ElemType(1))
+		: nx_(nx), ny_(ny), nz_(nz), spacing_(spacing), data_(nx * ny * nz)
+	{}
+
+	/*
+		@brief
+			Change the size; the contents are unspecified afterwards unless the size is unchanged.
+	*/
+	EUCVECTORINLINE void resize(size_t nx, size_t ny, size_t nz) {
+		nx_ = nx;
+		ny_ = ny;
+		nz_ = nz;
+		data_.resize(nx * ny * nz);
+	}
+
+	EUCVECTORINLINE void set_spacing(ElemType spacing) noexcept { spacing_ = spacing; }
+
+	EUCNODISCARD EUCVECTORINLINE size_t size_x() const noexcept { return nx_; }
+	EUCNODISCARD EUCVECTORINLINE size_t size_y() const noexcept { return ny_; }
+	EUCNODISCARD EUCVECTORINLINE size_t size_z() const noexcept { return nz_; }
+	EUCNODISCARD EUCVECTORINLINE size_t size() const noexcept { return data_.size(); }
+	EUCNODISCARD EUCVECTORINLINE ElemType spacing() const noexcept { return spacing_; }
+
+	EUCNODISCARD EUCVECTORINLINE T* data() noexcept { return data_.data(); }
+	EUCNODISCARD EUCVECTORINLINE const T* data() const noexcept { return data_.data(); }
+
+	EUCNODISCARD EUCVECTORINLINE T& operator()(size_t i, size_t j, size_t k) noexcept { return data_[(k * ny_ + j) * nx_ + i]; }
+	EUCNODISCARD EUCVECTORINLINE const T& operator()(size_t i, size_t j, size_t k) const noexcept { return data_[(k * ny_ + j) * nx_ + i]; }
+
+	/*
+		@brief
+			The grid as a flat stream of Components elements per cell.
+	*/
+	EUCNODISCARD EUCVECTORINLINE ElemType* elements() noexcept { return reinterpret_cast<ElemType*>(data_.data()); }
+	EUCNODISCARD EUCVECTORINLINE const ElemType* elements() const noexcept { return reinterpret_cast<const ElemType*>(data_.data()); }
+};
+
+//details.
+namespace detail {
+
+	constexpr size_t stencil_cache_bytes = 192 * 1024;
+	constexpr size_t stencil_grain_cells = 65536;
+
+	/*
+		@brief
+			out[t] = (p[t] - m[t]) * s for t in [0, n).
+	*/
+	template<class E>
+	EUCVECTORINLINE void stencil_diff(const E* p, const E* m, size_t n, E s, E* out) noexcept {
+		size_t t = 0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			const __m256 vs = _mm256_set1_ps(s);
+			for (; t + 8 <= n; t += 8) _mm256_storeu_ps(out + t, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(p + t), _mm256_loadu_ps(m + t)), vs));
+		}
+		else if constexpr (_STD is_same_v<E, double>) {
+			const __m256d vs = _mm256_set1_pd(s);
+			for (; t + 4 <= n; t += 4) _mm256_storeu_pd(out + t, _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(p + t), _mm256_loadu_pd(m + t)), vs));
+		}
+#endif
+		for (; t < n; ++t) out[t] = (p[t] - m[t]) * s;
+	}
+
+	/*
+		@brief
+			out[t] = (xm + xp + ym + yp + zm + zp - 6 c)[t] * s for t in [0, n).
+	*/
+	template<class E>
+	EUCVECTORINLINE void stencil_laplace(const E* c, const E* xm, const E* xp, const E* ym, const E* yp, const E* zm, const E* zp,
+		size_t n, E s, E* out) noexcept {
+		size_t t = 0;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<E, float>) {
+			const __m256 vs = _mm256_set1_ps(s), six = _mm256_set1_ps(6.0f);
+			for (; t + 8 <= n; t += 8) {
+				__m256 sum = _mm256_add_ps(_mm256_loadu_ps(xm + t), _mm256_loadu_ps(xp + t));
+				sum = _mm256_add_ps(sum, _mm256_add_ps(_mm256_loadu_ps(ym + t), _mm256_loadu_ps(yp + t)));
+				sum = _mm256_add_ps(sum, _mm256_add_ps(_mm256_loadu_ps(zm + t), _mm256_loadu_ps(zp + t)));
+				sum = _mm256_sub_ps(sum, _mm256_mul_ps(six, _mm256_loadu_ps(c + t)));
+				_mm256_storeu_ps(out + t, _mm256_mul_ps(sum, vs));
+			}
+		}
+		else if constexpr (_STD is_same_v<E, double>) {
+			const __m256d vs = _mm256_set1_pd(s), six = _mm256_set1_pd(6.0);
+			for (; t + 4 <= n; t += 4) {
+				__m256d sum = _mm256_add_pd(_mm256_loadu_pd(xm + t), _mm256_loadu_pd(xp + t));
+				sum = _mm256_add_pd(sum, _mm256_add_pd(_mm256_loadu_pd(ym + t), _mm256_loadu_pd(yp + t)));
+				sum = _mm256_add_pd(sum, _mm256_add_pd(_mm256_loadu_pd(zm + t), _mm256_loadu_pd(zp + t)));
+				sum = _mm256_sub_pd(sum, _mm256_mul_pd(six, _mm256_loadu_pd(c + t)));
+				_mm256_storeu_pd(out + t, _mm256_mul_pd(sum, vs));
+			}
+		}
+#endif
+		for (; t < n; ++t) out[t] = (xm[t] + xp[t] + ym[t] + yp[t] + zm[t] + zp[t] - E(6) * c[t]) * s;
+	}
+
+	/*
+		Rows around cell row (j, k) of a stream with C elements per cell, and the difference scales along y and z.
+	*/
+	template<class E>
+	struct StencilRows {
+		const E* c;
+		const E* ym;
+		const E* yp;
+		const E* zm;
+		const E* zp;
+		E sy, sz;
+	};
+
+	template<class E>
+	EUCNODISCARD EUCVECTORINLINE StencilRows<E> stencil_rows(const E* base, size_t C, size_t nx, size_t ny, size_t nz, size_t j, size_t k, E inv_h) noexcept {
+		const size_t row = C * nx, plane = row * ny;
+		const E* c = base + k * plane + j * row;
+		const size_t jm = j > 0 ? j - 1 : j, jp = j + 1 < ny ? j + 1 : j;
+		const size_t km = k > 0 ? k - 1 : k, kp = k + 1 < nz ? k + 1 : k;
+		StencilRows<E> r;
+		r.c = c;
+		r.ym = base + k * plane + jm * row;
+		r.yp = base + k * plane + jp * row;
+		r.zm = base + km * plane + j * row;
+		r.zp = base + kp * plane + j * row;
+		r.sy = jp > jm ? inv_h / static_cast<E>(jp - jm) : E(0);
+		r.sz = kp > km ? inv_h / static_cast<E>(kp - km) : E(0);
+		return r;
+	}
+
+	/*
+		@brief
+			Derivative of a row along x: central inside, one-sided at both ends.
+	*/
+	template<class E>
+	EUCVECTORINLINE void stencil_dx(const E* c, size_t C, size_t nx, E inv_h, E* out) noexcept {
+		if (nx < 2) {
+			_STD fill(out, out + C * nx, E(0));
+			return;
+		}
+		stencil_diff(c + C, c, C, inv_h, out);
+		if (nx > 2) stencil_diff(c + 2 * C, c, C * (nx - 2), inv_h / E(2), out + C);
+		stencil_diff(c + C * (nx - 1), c + C * (nx - 2), C, inv_h, out + C * (nx - 1));
+	}
+
+	/*
+		@brief
+			Visit every row (j, k) of an nx x ny x nz grid, tiled along y for reuse of the neighbouring planes,
+			with z slabs spread over threads. fn(j, k, scratch) gets scratch_elems elements of per-thread storage.
+	*/
+	template<class E, class F>
+	EUCVECTORINLINE void stencil_sweep(size_t nx, size_t ny, size_t nz, size_t row_bytes, size_t scratch_elems, unsigned threads, F&& fn) {
+		if (nx == 0 || ny == 0 || nz == 0) return;
+		// Planes k - 1, k, k + 1 of the input and the output row of a tile stay in cache.
+		const size_t tile = _STD clamp<size_t>(stencil_cache_bytes / (4 * _STD max<size_t>(row_bytes, 1)), 1, ny);
+		const size_t grain = _STD max<size_t>(1, stencil_grain_cells / (nx * ny));
+		parallel_for(nz, grain, threads, [&](size_t kb, size_t ke) {
+			_STD vector<E> scratch(scratch_elems);
+			for (size_t jb = 0; jb < ny; jb += tile) {
+				const size_t je = _STD min(ny, jb + tile);
+				for (size_t k = kb; k < ke; ++k) {
+					for (size_t j = jb; j < je; ++j) fn(j, k, scratch.data());
+				}
+			}
+		});
+	}
+
+}
+
+/*
+	@brief
+		Gradient of a scalar grid.
+*/
+template<class E>
+EUCVECTORINLINE void euc_gradient(const EucGrid3<E>& f, EucGrid3<EuclideanCmplVector3<E>>& out, unsigned threads = 0) {
+	const size_t nx = f.size_x(), ny = f.size_y(), nz = f.size_z();
+	out.resize(nx, ny, nz);
+	out.set_spacing(f.spacing());
+	const E inv_h = E(1) / f.spacing();
+	const E* in = f.elements();
+	E* dst = out.elements();
+	detail::stencil_sweep<E>(nx, ny, nz, nx * sizeof(E), 3 * nx, threads, [&](size_t j, size_t k, E* s) {
+		const auto r = detail::stencil_rows(in, 1, nx, ny, nz, j, k, inv_h);
+		E* dx = s;
+		E* dy = s + nx;
+		E* dz = s + 2 * nx;
+		detail::stencil_dx(r.c, 1, nx, inv_h, dx);
+		detail::stencil_diff(r.yp, r.ym, nx, r.sy, dy);
+		detail::stencil_diff(r.zp, r.zm, nx, r.sz, dz);
+		E* o = dst + ((k * ny + j) * nx) * 3;
+		for (size_t i = 0; i < nx; ++i) {
+			o[i * 3] = dx[i];
+			o[i * 3 + 1] = dy[i];
+			o[i * 3 + 2] = dz[i];
+		}
+	});
+}
+
+/*
+	@brief
+		Divergence of a vector grid.
+*/
+template<class E>
+EUCVECTORINLINE void euc_divergence(const EucGrid3<EuclideanCmplVector3<E>>& f, EucGrid3<E>& out, unsigned threads = 0) {
+	const size_t nx = f.size_x(), ny = f.size_y(), nz = f.size_z();
+	out.resize(nx, ny, nz);
+	out.set_spacing(f.spacing());
+	const E inv_h = E(1) / f.spacing();
+	const E* in = f.elements();
+	E* dst = out.elements();
+	detail::stencil_sweep<E>(nx, ny, nz, 3 * nx * sizeof(E), 9 * nx, threads, [&](size_t j, size_t k, E* s) {
+		const auto r = detail::stencil_rows(in, 3, nx, ny, nz, j, k, inv_h);
+		E* dx = s;
+		E* dy = s + 3 * nx;
+		E* dz = s + 6 * nx;
+		detail::stencil_dx(r.c, 3, nx, inv_h, dx);
+		detail::stencil_diff(r.yp, r.ym, 3 * nx, r.sy, dy);
+		detail::stencil_diff(r.zp, r.zm, 3 * nx, r.sz, dz);
+		E* o = dst + (k * ny + j) * nx;
+		for (size_t i = 0; i < nx; ++i) o[i] = dx[i * 3] + dy[i * 3 + 1] + dz[i * 3 + 2];
+	});
+}
+
+/*
+	@brief
+		Curl of a vector grid.
+*/
+template<class E>
+EUCVECTORINLINE void euc_curl(const EucGrid3<EuclideanCmplVector3<E>>& f, EucGrid3<EuclideanCmplVector3<E>>& out, unsigned threads = 0) {
+	const size_t nx = f.size_x(), ny = f.size_y(), nz = f.size_z();
+	out.resize(nx, ny, nz);
+	out.set_spacing(f.spacing());
+	const E inv_h = E(1) / f.spacing();
+	const E* in = f.elements();
+	E* dst = out.elements();
+	detail::stencil_sweep<E>(nx, ny, nz, 3 * nx * sizeof(E), 9 * nx, threads, [&](size_t j, size_t k, E* s) {
+		const auto r = detail::stencil_rows(in, 3, nx, ny, nz, j, k, inv_h);
+		E* dx = s;
+		E* dy = s + 3 * nx;
+		E* dz = s + 6 * nx;
+		detail::stencil_dx(r.c, 3, nx, inv_h, dx);
+		detail::stencil_diff(r.yp, r.ym, 3 * nx, r.sy, dy);
+		detail::stencil_diff(r.zp, r.zm, 3 * nx, r.sz, dz);
+		E* o = dst + ((k * ny + j) * nx) * 3;
+		for (size_t i = 0; i < nx; ++i) {
+			const size_t t = i * 3;
+			o[t] = dy[t + 2] - dz[t + 1];
+			o[t + 1] = dz[t] - dx[t + 2];
+			o[t + 2] = dx[t + 1] - dy[t];
+		}
+	});
+}
+
+/*
+	@brief
+		Laplacian of a scalar or vector grid (per component).
+*/
+template<class T>
+EUCVECTORINLINE void euc_laplacian(const EucGrid3<T>& f, EucGrid3<T>& out, unsigned threads = 0) {
+	using E = typename EucGrid3<T>::ElemType;
+	constexpr size_t C = EucGrid3<T>::Components;
+	const size_t nx = f.size_x(), ny = f.size_y(), nz = f.size_z();
+	out.resize(nx, ny, nz);
+	out.set_spacing(f.spacing());
+	const E inv_h2 = E(1) / (f.spacing() * f.spacing());
+	const E* in = f.elements();
+	E* dst = out.elements();
+	detail::stencil_sweep<E>(nx, ny, nz, C * nx * sizeof(E), 0, threads, [&](size_t j, size_t k, E*) {
+		const auto r = detail::stencil_rows(in, C, nx, ny, nz, j, k, E(1));
+		E* o = dst + ((k * ny + j) * nx) * C;
+		if (nx == 1) {
+			detail::stencil_laplace(r.c, r.c, r.c, r.ym, r.yp, r.zm, r.zp, C, inv_h2, o);
+			return;
+		}
+		// Border cells see themselves in place of the missing neighbour.
+		detail::stencil_laplace(r.c, r.c, r.c + C, r.ym, r.yp, r.zm, r.zp, C, inv_h2, o);
+		const size_t inner = C * (nx - 2);
+		detail::stencil_laplace(r.c + C, r.c, r.c + 2 * C, r.ym + C, r.yp + C, r.zm + C, r.zp + C, inner, inv_h2, o + C);
+		const size_t last = C * (nx - 1);
+		detail::stencil_laplace(r.c + last, r.c + last - C, r.c + last, r.ym + last, r.yp + last, r.zm + last, r.zp + last, C, inv_h2, o + last);
+	});
+}
+
+//name space end.
+}
+
+#endif
@@ -0,0 +1,170 @@
+//
+//	EuclideanVector Traits
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Compile-time information shared by the batch modules (IO, kernels, containers).
+//	Every vector and ResultPacker type is described by its dimension and element type,
+//	and its elements can be read or written by index without knowing which family it belongs to.
+//.
+
+#ifndef THL_EUCLID_VECTOR_TRAITS_HPP
+#define THL_EUCLID_VECTOR_TRAITS_HPP
+
+#include "EuclideanVector.hpp"
+
+#include <cstddef>
+
+//name space begin.
+namespace thl::vector {
+
+//meta functions.
+namespace meta {
+
+	template<class V>
+	struct euc_vector_info {
+		static constexpr bool value = false;
+		static constexpr bool is_packer = false;
+		static constexpr size_t dimension = 0;
+		using elem_type = void;
+	};
+
+	template<class E, size_t D, bool P>
+	struct euc_vector_info_base {
+		static constexpr bool value = true;
+		static constexpr bool is_packer = P;
+		static constexpr size_t dimension = D;
+		using elem_type = E;
+	};
+
+	template<class E> struct euc_vector_info<EuclideanVector1<E>>		: euc_vector_info_base<E, 1, false> {};
+	template<class E> struct euc_vector_info<EuclideanRecVector2<E>>	: euc_vector_info_base<E, 2, false> {};
+	template<class E> struct euc_vector_info<EuclideanRecVector3<E>>	: euc_vector_info_base<E, 3, false> {};
+	template<class E> struct euc_vector_info<EuclideanRecVector4<E>>	: euc_vector_info_base<E, 4, false> {};
+	template<class E> struct euc_vector_info<EuclideanCmplVector2<E>>	: euc_vector_info_base<E, 2, false> {};
+	template<class E> struct euc_vector_info<EuclideanCmplVector3<E>>	: euc_vector_info_base<E, 3, false> {};
+	template<class E> struct euc_vector_info<EuclideanCmplVector4<E>>	: euc_vector_info_base<E, 4, false> {};
+	template<class E> struct euc_vector_info<detail::ResultPacker_1<E>>	: euc_vector_info_base<E, 1, true> {};
+	template<class E> struct euc_vector_info<detail::ResultPacker_2<E>>	: euc_vector_info_base<E, 2, true> {};
+	template<class E> struct euc_vector_info<detail::ResultPacker_3<E>>	: euc_vector_info_base<E, 3, true> {};
+	template<class E> struct euc_vector_info<detail::ResultPacker_4<E>>	: euc_vector_info_base<E, 4, true> {};
+
+	template<class V>
+	using euc_info = euc_vector_info<_STD remove_cv_t<no_ref<V>>>;
+
+	// vector or packer.
+	template<class V>
+	constexpr bool is_euc_vector_v = euc_info<V>::value;
+
+	// packer only.
+	template<class V>
+	constexpr bool is_euc_packer_v = euc_info<V>::is_packer;
+
+	template<class V>
+	constexpr size_t euc_dimension_v = euc_info<V>::dimension;
+
+	template<class V>
+	using euc_elem_t = typename euc_info<V>::elem_type;
+
+	/*
+		Complete vectors whose elements sit contiguously as E[D] and can be handed to batch kernels as raw arrays.
+	*/
+	template<class V>
+	struct is_euc_flat {
+		static constexpr bool value = false;
+	};
+	template<class E> struct is_euc_flat<EuclideanCmplVector2<E>> { static constexpr bool value = _STD is_arithmetic_v<E> && sizeof(EuclideanCmplVector2<E>) == sizeof(E) * 2; };
+	template<class E> struct is_euc_flat<EuclideanCmplVector3<E>> { static constexpr bool value = _STD is_arithmetic_v<E> && sizeof(EuclideanCmplVector3<E>) == sizeof(E) * 3; };
+	template<class E> struct is_euc_flat<EuclideanCmplVector4<E>> { static constexpr bool value = _STD is_arithmetic_v<E> && sizeof(EuclideanCmplVector4<E>) == sizeof(E) * 4; };
+
+	template<class V>
+	constexpr bool is_euc_flat_v = is_euc_flat<_STD remove_cv_t<no_ref<V>>>::value;
+
+	/*
+		Packer and complete vector of a given element type and dimension.
+	*/
+	template<class E, size_t D> struct euc_packer;
+	template<class E> struct euc_packer<E, 1> { using type = detail::ResultPacker_1<E>; };
+	template<class E> struct euc_packer<E, 2> { using type = detail::ResultPacker_2<E>; };
+	template<class E> struct euc_packer<E, 3> { using type = detail::ResultPacker_3<E>; };
+	template<class E> struct euc_packer<E, 4> { using type = detail::ResultPacker_4<E>; };
+
+	template<class E, size_t D>
+	using euc_packer_t = typename euc_packer<E, D>::type;
+
+	template<class E, size_t D> struct euc_cmpl_vector;
+	template<class E> struct euc_cmpl_vector<E, 1> { using type = EuclideanVector1<E>; };
+	template<class E> struct euc_cmpl_vector<E, 2> { using type = EuclideanCmplVector2<E>; };
+	template<class E> struct euc_cmpl_vector<E, 3> { using type = EuclideanCmplVector3<E>; };
+	template<class E> struct euc_cmpl_vector<E, 4> { using type = EuclideanCmplVector4<E>; };
+
+	template<class E, size_t D>
+	using euc_cmpl_vector_t = typename euc_cmpl_vector<E, D>::type;
+
+}
+
+//details.
+namespace detail {
+
+	/*
+		@brief
+			Access the I-th element of any vector or packer.
+	*/
+	template<size_t I, class V>
+	EUCNODISCARD EUCVECTORINLINE constexpr decltype(auto) euc_get(V& v) noexcept {
+		static_assert(I < meta::euc_dimension_v<V>, "Element index is out of the vector dimension");
+		if constexpr (meta::is_euc_packer_v<V>) {
+			if constexpr (I == 0) return (v.x);
+			else if constexpr (I == 1) return (v.y);
+			else if constexpr (I == 2) return (v.z);
+			else return (v.w);
+		}
+		else {
+			if constexpr (I == 0) return v.x();
+			else if constexpr (I == 1) return v.y();
+			else if constexpr (I == 2) return v.z();
+			else return v.w();
+		}
+	}
+
+	template<class V, class F, size_t... I>
+	EUCVECTORINLINE constexpr void euc_for_each_impl(V& v, F&& fn, _STD index_sequence<I...>) {
+		(fn(euc_get<I>(v)), ...);
+	}
+
+	/*
+		@brief
+			Call fn(element) for every element, in x, y, z, w order.
+	*/
+	template<class V, class F>
+	EUCVECTORINLINE constexpr void euc_for_each(V& v, F&& fn) {
+		euc_for_each_impl(v, _STD forward<F>(fn), _STD make_index_sequence<meta::euc_dimension_v<V>>());
+	}
+
+	template<class V, class E, size_t... I>
+	EUCNODISCARD EUCVECTORINLINE V euc_make_impl(const E* elems, _STD index_sequence<I...>) {
+		if constexpr (meta::is_euc_packer_v<V>) {
+			return V{ static_cast<meta::euc_elem_t<V>>(elems[I])... };
+		}
+		else {
+			return V(static_cast<meta::euc_elem_t<V>>(elems[I])...);
+		}
+	}
+
+	/*
+		@brief
+			Build a vector or packer from D consecutive elements.
+	*/
+	template<class V, class E>
+	EUCNODISCARD EUCVECTORINLINE V euc_make(const E* elems) {
+		return euc_make_impl<V>(elems, _STD make_index_sequence<meta::euc_dimension_v<V>>());
+	}
+
+}
+
+//name space end.
+}
+
+#endif
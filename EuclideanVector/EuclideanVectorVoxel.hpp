@@ -0,0 +1,377 @@
+//
+//	EuclideanVector Voxel
+//
+//	Git Hub : https://github.com/Rasukairosu/EuclideanVector.git
+//
+//	-English-
+//
+//	Voxel-grid downsampling and deduplication of 3D point clouds.
+//
+//	Points are quantized to integer voxel keys (EucCmplIntVector3), floor((p - origin) / size).
+//	For packed EuclideanCmplVector3<float> input, 8 points go through AVX per step: the interleaved x y z
+//	stream is processed as is, with the origin broadcast in its period-3 pattern.
+//	Each point also gets a hash of its key. The top bits of the hash select one of up to 256 partitions.
+//	Point indices are scattered into partition order (stable, in parallel per chunk). Then each partition is
+//	reduced on one thread with its own open-addressing table (linear probing), so no locks are needed.
+//
+//	Per voxel the filter outputs either the centroid (accumulated in double) or the first point in input order.
+//	Voxels come out in order of first appearance within each partition. The partition count depends only on the
+//	point count, so the output is identical for any number of threads.
+//	All buffers belong to the filter and are reused, so steady-state frames do not allocate.
+//
+//	Keys must fit in int: |p - origin| / size < 2^31.
+//.
+
+#ifndef THL_EUCLID_VECTOR_VOXEL_HPP
+#define THL_EUCLID_VECTOR_VOXEL_HPP
+
+#include "EuclideanVector.hpp"
+#include "EuclideanVectorTraits.hpp"
+#include "EuclideanVectorParallel.hpp"
+#include "EuclideanVectorSimd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+//name space begin.
+namespace thl::vector {
+
+enum class EucVoxelMode {
+	Centroid,	// mean of the points in the voxel.
+	First,		// first point of the voxel in input order.
+};
+
+//details.
+namespace detail {
+
+	constexpr size_t voxel_grain = 32768;
+	constexpr size_t voxel_partition_size = 65536;
+	constexpr size_t voxel_max_partition_bits = 8;
+	constexpr uint32_t voxel_empty = 0xffffffffu;
+
+	EUCNODISCARD EUCVECTORINLINE uint32_t voxel_hash(int x, int y, int z) noexcept {
+		uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(x)) * 0x9E3779B97F4A7C15ull;
+		h ^= static_cast<uint64_t>(static_cast<uint32_t>(y)) * 0xC2B2AE3D27D4EB4Full;
+		h ^= static_cast<uint64_t>(static_cast<uint32_t>(z)) * 0x165667B19E3779F9ull;
+		return static_cast<uint32_t>(h ^ (h >> 29) ^ (h >> 32));
+	}
+
+	/*
+		@brief
+			Quantize points [b, e). hashes may be null.
+	*/
+	template<class V, class E>
+	EUCVECTORINLINE void voxel_quantize_range(const V* points, size_t b, size_t e, E inv_size, const E* origin,
+		EuclideanCmplVector3<int>* keys, uint32_t* hashes) noexcept {
+		size_t i = b;
+#if defined(THL_EUC_AVX)
+		if constexpr (_STD is_same_v<V, EuclideanCmplVector3<float>> && meta::is_euc_flat_v<V> && meta::is_euc_flat_v<EuclideanCmplVector3<int>>) {
+			// 8 points = 24 floats = 3 registers; the origin repeats every 3 lanes.
+			const __m256 o0 = _mm256_setr_ps(origin[0], origin[1], origin[2], origin[0], origin[1], origin[2], origin[0], origin[1]);
+			const __m256 o1 = _mm256_setr_ps(origin[2], origin[0], origin[1], origin[2], origin[0], origin[1], origin[2], origin[0]);
+			const __m256 o2 = _mm256_setr_ps(origin[1], origin[2], origin[0], origin[1], origin[2], origin[0], origin[1], origin[2]);
+			const __m256 s = _mm256_set1_ps(inv_size);
+			for (; i + 8 <= e; i += 8) {
+				const float* src = reinterpret_cast<const float*>(points + i);
+				int* dst = reinterpret_cast<int*>(keys + i);
+				const __m256 q0 = _mm256_floor_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src), o0), s));
+				const __m256 q1 = _mm256_floor_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src + 8), o1), s));
+				const __m256 q2 = _mm256_floor_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src + 16), o2), s));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_cvttps_epi32(q0));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 8), _mm256_cvttps_epi32(q1));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 16), _mm256_cvttps_epi32(q2));
+				if (hashes) {
+					for (size_t k = 0; k < 8; ++k) hashes[i + k] = voxel_hash(dst[k * 3], dst[k * 3 + 1], dst[k * 3 + 2]);
+				}
+			}
+		}
+#endif
+		for (; i < e; ++i) {
+			const int x = static_cast<int>(_STD floor((static_cast<E>(euc_get<0>(points[i])) - origin[0]) * inv_size));
+			const int y = static_cast<int>(_STD floor((static_cast<E>(euc_get<1>(points[i])) - origin[1]) * inv_size));
+			const int z = static_cast<int>(_STD floor((static_cast<E>(euc_get<2>(points[i])) - origin[2]) * inv_size));
+			keys[i].x_ = x;
+			keys[i].y_ = y;
+			keys[i].z_ = z;
+			if (hashes) hashes[i] = voxel_hash(x, y, z);
+		}
+	}
+
+}
+
+/*
+	@brief
+		Voxel key of each point: floor((p - origin) / voxel_size).
+*/
+template<class V, class E, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCVECTORINLINE void euc_voxel_quantize(const V* points, size_t count, E voxel_size, const EuclideanCmplVector3<E>& origin,
+	EuclideanCmplVector3<int>* keys, unsigned threads = 0) {
+	const E o[3] = { origin.x_, origin.y_, origin.z_ };
+	const E inv = E(1) / voxel_size;
+	detail::parallel_for(count, detail::voxel_grain, threads, [&](size_t b, size_t e) {
+		detail::voxel_quantize_range(points, b, e, inv, o, keys, nullptr);
+	});
+}
+
+/*
+	Voxel-grid filter. E is the coordinate type of the output points.
+*/
+template<class E = float>
+class EucVoxelFilter {
+public:
+
+	static_assert(_STD is_floating_point_v<E>, "EucVoxelFilter needs a floating point coordinate type");
+
+	struct Options {
+		E voxel_size = E(1);
+		E origin[3] = { E(0), E(0), E(0) };
+		EucVoxelMode mode = EucVoxelMode::Centroid;
+		unsigned threads = 0;
+	};
+
+protected:
+
+	struct Slot {
+		int x, y, z;
+		uint32_t voxel;
+	};
+
+	struct Voxel {
+		double sum[3];
+		uint32_t count;
+		uint32_t first;
+	};
+
+	Options options_;
+	_STD vector<EuclideanCmplVector3<int>> keys_;
+	_STD vector<uint32_t> hash_;
+	_STD vector<uint32_t> perm_;
+	_STD vector<size_t> histogram_;		// chunk-major, partitions per chunk.
+	_STD vector<size_t> part_begin_;	// partition p holds perm_[part_begin_[p], part_begin_[p + 1]).
+	_STD vector<size_t> table_begin_;
+	_STD vector<Slot> table_;
+	_STD vector<Voxel> voxel_;			// partition p writes from voxel_[part_begin_[p]].
+	_STD vector<size_t> voxel_count_;
+	_STD vector<size_t> out_begin_;
+	_STD vector<uint32_t> first_;
+	_STD vector<uint32_t> counts_;
+	_STD vector<EuclideanCmplVector3<E>> converted_;
+
+	EUCNODISCARD static EUCVECTORINLINE size_t partition_bits(size_t count) noexcept {
+		size_t bits = 0;
+		while (bits < detail::voxel_max_partition_bits && (detail::voxel_partition_size << bits) < count) ++bits;
+		return bits;
+	}
+
+	EUCNODISCARD static EUCVECTORINLINE size_t table_size(size_t count) noexcept {
+		size_t n = 16;
+		while (n < count * 2) n <<= 1;
+		return n;
+	}
+
+	/*
+		@brief
+			Reduce the points of partition p in input order.
+	*/
+	EUCVECTORINLINE void reduce_partition(size_t p, size_t parts, bool centroid, const E* coords, size_t stride) noexcept {
+		const size_t b = part_begin_[p], e = part_begin_[p + 1];
+		Slot* table = table_.data() + table_begin_[p];
+		const size_t mask = table_begin_[p + 1] - table_begin_[p] - 1;
+		_STD fill(table, table + mask + 1, Slot{ 0, 0, 0, detail::voxel_empty });
+		Voxel* voxels = voxel_.data() + b;
+		size_t n = 0;
+		for (size_t k = b; k < e; ++k) {
+			const uint32_t i = parts > 1 ? perm_[k] : static_cast<uint32_t>(k);
+			const auto& key = keys_[i];
+			size_t h = hash_[i] & mask;
+			for (;; h = (h + 1) & mask) {
+				Slot& s = table[h];
+				if (s.voxel == detail::voxel_empty) {
+					s = Slot{ key.x_, key.y_, key.z_, static_cast<uint32_t>(n) };
+					Voxel& v = voxels[n++];
+					v.count = 1;
+					v.first = i;
+					if (centroid) {
+						for (size_t d = 0; d < 3; ++d) v.sum[d] = static_cast<double>(coords[i * stride + d]);
+					}
+					break;
+				}
+				if (s.x == key.x_ && s.y == key.y_ && s.z == key.z_) {
+					Voxel& v = voxels[s.voxel];
+					++v.count;
+					if (centroid) {
+						for (size_t d = 0; d < 3; ++d) v.sum[d] += static_cast<double>(coords[i * stride + d]);
+					}
+					break;
+				}
+			}
+		}
+		voxel_count_[p] = n;
+	}
+
+public:
+
+	explicit EucVoxelFilter(const Options& options = Options()) noexcept
+		: options_(options)
+	{}
+
+	EUCNODISCARD EUCVECTORINLINE const Options& options() const noexcept { return options_; }
+	EUCVECTORINLINE void set_options(const Options& options) noexcept { options_ = options; }
+
+	/*
+		@brief
+			Downsample count points to one point per occupied voxel. out is overwritten; returns the voxel count.
+	*/
+	template<class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+	EUCVECTORINLINE size_t apply(const V* points, size_t count, _STD vector<EuclideanCmplVector3<E>>& out) {
+		const unsigned threads = options_.threads;
+		const bool centroid = options_.mode == EucVoxelMode::Centroid;
+		const size_t bits = partition_bits(count);
+		const size_t parts = size_t(1) << bits;
+		const size_t chunks = detail::chunk_count(count, detail::voxel_grain, threads);
+
+		keys_.resize(count);
+		hash_.resize(count);
+		histogram_.assign(chunks * parts, 0);
+		const E inv = E(1) / options_.voxel_size;
+		const size_t shift = 32 - bits;
+		detail::parallel_invoke(chunks, [&](size_t ch) {
+			const size_t b = count * ch / chunks, e = count * (ch + 1) / chunks;
+			detail::voxel_quantize_range(points, b, e, inv, options_.origin, keys_.data(), hash_.data());
+			if (parts > 1) {
+				size_t* hist = histogram_.data() + ch * parts;
+				for (size_t i = b; i < e; ++i) ++hist[hash_[i] >> shift];
+			}
+		});
+
+		// Partition offsets, chunk by chunk so that the scatter is stable.
+		part_begin_.assign(parts + 1, 0);
+		if (parts > 1) {
+			size_t at = 0;
+			for (size_t p = 0; p < parts; ++p) {
+				part_begin_[p] = at;
+				for (size_t ch = 0; ch < chunks; ++ch) {
+					size_t& h = histogram_[ch * parts + p];
+					const size_t n = h;
+					h = at;
+					at += n;
+				}
+			}
+			part_begin_[parts] = at;
+			perm_.resize(count);
+			detail::parallel_invoke(chunks, [&](size_t ch) {
+				const size_t b = count * ch / chunks, e = count * (ch + 1) / chunks;
+				size_t* cursor = histogram_.data() + ch * parts;
+				for (size_t i = b; i < e; ++i) perm_[cursor[hash_[i] >> shift]++] = static_cast<uint32_t>(i);
+			});
+		}
+		else {
+			part_begin_[1] = count;
+		}
+
+		table_begin_.resize(parts + 1);
+		table_begin_[0] = 0;
+		for (size_t p = 0; p < parts; ++p) table_begin_[p + 1] = table_begin_[p] + table_size(part_begin_[p + 1] - part_begin_[p]);
+		table_.resize(table_begin_[parts]);
+		voxel_.resize(count);
+		voxel_count_.resize(parts);
+
+		// Centroids read the coordinates in place when the input is packed, otherwise from a converted copy.
+		const E* coords = nullptr;
+		size_t stride = 3;
+		if constexpr (meta::is_euc_flat_v<V> && _STD is_same_v<meta::euc_elem_t<V>, E>) {
+			coords = reinterpret_cast<const E*>(points);
+		}
+		else {
+			if (centroid) {
+				converted_.resize(count);
+				detail::parallel_for(count, detail::voxel_grain, threads, [&](size_t b, size_t e) {
+					for (size_t i = b; i < e; ++i) {
+						converted_[i] = EuclideanCmplVector3<E>(static_cast<E>(detail::euc_get<0>(points[i])),
+							static_cast<E>(detail::euc_get<1>(points[i])), static_cast<E>(detail::euc_get<2>(points[i])));
+					}
+				});
+				coords = &converted_.data()->x_;
+				stride = sizeof(EuclideanCmplVector3<E>) / sizeof(E);
+			}
+		}
+		detail::parallel_for(parts, 1, threads, [&](size_t b, size_t e) {
+			for (size_t p = b; p < e; ++p) reduce_partition(p, parts, centroid, coords, stride);
+		});
+
+		out_begin_.resize(parts + 1);
+		out_begin_[0] = 0;
+		for (size_t p = 0; p < parts; ++p) out_begin_[p + 1] = out_begin_[p] + voxel_count_[p];
+		const size_t total = out_begin_[parts];
+		first_.resize(total);
+		counts_.resize(total);
+		for (size_t p = 0; p < parts; ++p) {
+			const Voxel* voxels = voxel_.data() + part_begin_[p];
+			for (size_t v = 0; v < voxel_count_[p]; ++v) {
+				first_[out_begin_[p] + v] = voxels[v].first;
+				counts_[out_begin_[p] + v] = voxels[v].count;
+			}
+		}
+		if (centroid) {
+			out.resize(total);
+			detail::parallel_for(parts, 1, threads, [&](size_t b, size_t e) {
+				for (size_t p = b; p < e; ++p) {
+					const Voxel* voxels = voxel_.data() + part_begin_[p];
+					for (size_t v = 0; v < voxel_count_[p]; ++v) {
+						const double inv_n = 1.0 / static_cast<double>(voxels[v].count);
+						out[out_begin_[p] + v] = EuclideanCmplVector3<E>(static_cast<E>(voxels[v].sum[0] * inv_n),
+							static_cast<E>(voxels[v].sum[1] * inv_n), static_cast<E>(voxels[v].sum[2] * inv_n));
+					}
+				}
+			});
+		}
+		else {
+			out.resize(total);
+			detail::parallel_for(total, detail::voxel_grain, threads, [&](size_t b, size_t e) {
+				for (size_t v = b; v < e; ++v) {
+					const auto& p = points[first_[v]];
+					out[v] = EuclideanCmplVector3<E>(static_cast<E>(detail::euc_get<0>(p)),
+						static_cast<E>(detail::euc_get<1>(p)), static_cast<E>(detail::euc_get<2>(p)));
+				}
+			});
+		}
+		return total;
+	}
+
+	/*
+		@brief
+			Index of the first input point of each output voxel, and the number of points it merged (last apply()).
+	*/
+	EUCNODISCARD EUCVECTORINLINE const _STD vector<uint32_t>& first_indices() const noexcept { return first_; }
+	EUCNODISCARD EUCVECTORINLINE const _STD vector<uint32_t>& counts() const noexcept { return counts_; }
+
+	/*
+		@brief
+			Voxel key of each input point (last apply()).
+	*/
+	EUCNODISCARD EUCVECTORINLINE const _STD vector<EuclideanCmplVector3<int>>& keys() const noexcept { return keys_; }
+};
+
+/*
+	@brief
+		One-shot voxel downsampling; keep an EucVoxelFilter to reuse its buffers across frames.
+*/
+template<class E = float, class V, meta::if_t<meta::is_euc_vector_v<V> && meta::euc_dimension_v<V> == 3> = 0>
+EUCNODISCARD EUCVECTORINLINE _STD vector<EuclideanCmplVector3<E>> euc_voxel_downsample(const V* points, size_t count, E voxel_size,
+	EucVoxelMode mode = EucVoxelMode::Centroid, unsigned threads = 0) {
+	typename EucVoxelFilter<E>::Options options;
+	options.voxel_size = voxel_size;
+	options.mode = mode;
+	options.threads = threads;
+	EucVoxelFilter<E> filter(options);
+	_STD vector<EuclideanCmplVector3<E>> out;
+	filter.apply(points, count, out);
+	return out;
+}
+
+//name space end.
+}
+
+#endif